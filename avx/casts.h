@@ -297,6 +297,35 @@ Vc_INTRINSIC auto convert(typename AVX::VectorTypeHelper<From>::Type v)
 {
     return convert(lo128(v), ConvertTag<From, To>());
 }
+
+// binary16 <-> binary32 conversion
+Vc_INTRINSIC Vc_CONST __m256 cvtph_ps(__m128i v)
+{
+#ifdef Vc_IMPL_F16C
+    return _mm256_cvtph_ps(v);
+#else
+    return concat(SSE::cvtph_ps(v), SSE::cvtph_ps(_mm_unpackhi_epi64(v, v)));
+#endif
+}
+Vc_INTRINSIC Vc_CONST __m128i cvtps_ph(__m256 v)
+{
+#ifdef Vc_IMPL_F16C
+    return _mm256_cvtps_ph(v, _MM_FROUND_TO_NEAREST_INT);
+#else
+    return _mm_unpacklo_epi64(SSE::cvtps_ph(lo128(v)), SSE::cvtps_ph(hi128(v)));
+#endif
+}
+
+// bfloat16 <-> binary32 conversion
+Vc_INTRINSIC Vc_CONST __m256 cvtbf16_ps(__m128i v)
+{
+    return _mm256_castsi256_ps(concat(_mm_unpacklo_epi16(_mm_setzero_si128(), v),
+                                      _mm_unpackhi_epi16(_mm_setzero_si128(), v)));
+}
+Vc_INTRINSIC Vc_CONST __m128i cvtps_bf16(__m256 v)
+{
+    return _mm_unpacklo_epi64(SSE::cvtps_bf16(lo128(v)), SSE::cvtps_bf16(hi128(v)));
+}
 }  // namespace AVX
 }  // namespace Vc
 
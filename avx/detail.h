@@ -431,6 +431,16 @@ Vc_INTRINSIC __m256 load(const short *mem, Flags f, LoadTag<__m256, float>)
 {
     return AVX::convert<short, float>(load16(mem, f));
 }
+template <typename Flags>
+Vc_INTRINSIC __m256 load(const half *mem, Flags f, LoadTag<__m256, float>)
+{
+    return AVX::cvtph_ps(load16(reinterpret_cast<const ushort *>(mem), f));
+}
+template <typename Flags>
+Vc_INTRINSIC __m256 load(const bfloat16 *mem, Flags f, LoadTag<__m256, float>)
+{
+    return AVX::cvtbf16_ps(load16(reinterpret_cast<const ushort *>(mem), f));
+}
 /*
 template<typename Flags> struct LoadHelper<float, unsigned char, Flags> {
     static __m256 load(const unsigned char *mem, Flags)
@@ -602,6 +612,8 @@ Vc_INTRINSIC Vc_CONST __m256i one( short) { return AVX::setone_epi16(); }
 Vc_INTRINSIC Vc_CONST __m256i one(ushort) { return AVX::setone_epu16(); }
 Vc_INTRINSIC Vc_CONST __m256i one( schar) { return AVX::setone_epi8 (); }
 Vc_INTRINSIC Vc_CONST __m256i one( uchar) { return AVX::setone_epu8 (); }
+Vc_INTRINSIC Vc_CONST __m256i one( llong) { return _mm256_set1_epi64x(1); }
+Vc_INTRINSIC Vc_CONST __m256i one(ullong) { return _mm256_set1_epi64x(1); }
 
 // negate{{{1
 Vc_ALWAYS_INLINE Vc_CONST __m256 negate(__m256 v, std::integral_constant<std::size_t, 4>)
@@ -612,6 +624,10 @@ Vc_ALWAYS_INLINE Vc_CONST __m256d negate(__m256d v, std::integral_constant<std::
 {
     return _mm256_xor_pd(v, AVX::setsignmask_pd());
 }
+Vc_ALWAYS_INLINE Vc_CONST __m256i negate(__m256i v, std::integral_constant<std::size_t, 8>)
+{
+    return AVX::sub_epi64(_mm256_setzero_si256(), v);
+}
 Vc_ALWAYS_INLINE Vc_CONST __m256i negate(__m256i v, std::integral_constant<std::size_t, 4>)
 {
     return AVX::sign_epi32(v, Detail::allone<__m256i>());
@@ -620,6 +636,10 @@ Vc_ALWAYS_INLINE Vc_CONST __m256i negate(__m256i v, std::integral_constant<std::
 {
     return AVX::sign_epi16(v, Detail::allone<__m256i>());
 }
+Vc_ALWAYS_INLINE Vc_CONST __m256i negate(__m256i v, std::integral_constant<std::size_t, 1>)
+{
+    return AVX::sign_epi8(v, Detail::allone<__m256i>());
+}
 
 // xor_{{{1
 Vc_INTRINSIC __m256 xor_(__m256 a, __m256 b) { return _mm256_xor_ps(a, b); }
@@ -691,6 +711,11 @@ Vc_INTRINSIC __m256i abs(__m256i a,  short) { return AVX::abs_epi16(a); }
 Vc_INTRINSIC __m256i abs(__m256i a, ushort) { return a; }
 Vc_INTRINSIC __m256i abs(__m256i a,  schar) { return AVX::abs_epi8 (a); }
 Vc_INTRINSIC __m256i abs(__m256i a,  uchar) { return a; }
+Vc_INTRINSIC __m256i abs(__m256i a,  llong) {
+    const __m256i zero = _mm256_setzero_si256();
+    return blend(a, AVX::sub_epi64(zero, a), AVX::cmpgt_epi64(zero, a));
+}
+Vc_INTRINSIC __m256i abs(__m256i a, ullong) { return a; }
 
 // add{{{1
 Vc_INTRINSIC __m256  add(__m256  a, __m256  b,  float) { return _mm256_add_ps(a, b); }
@@ -699,6 +724,10 @@ Vc_INTRINSIC __m256i add(__m256i a, __m256i b,    int) { return AVX::add_epi32(a
 Vc_INTRINSIC __m256i add(__m256i a, __m256i b,   uint) { return AVX::add_epi32(a, b); }
 Vc_INTRINSIC __m256i add(__m256i a, __m256i b,  short) { return AVX::add_epi16(a, b); }
 Vc_INTRINSIC __m256i add(__m256i a, __m256i b, ushort) { return AVX::add_epi16(a, b); }
+Vc_INTRINSIC __m256i add(__m256i a, __m256i b,  schar) { return AVX::add_epi8 (a, b); }
+Vc_INTRINSIC __m256i add(__m256i a, __m256i b,  uchar) { return AVX::add_epi8 (a, b); }
+Vc_INTRINSIC __m256i add(__m256i a, __m256i b,  llong) { return AVX::add_epi64(a, b); }
+Vc_INTRINSIC __m256i add(__m256i a, __m256i b, ullong) { return AVX::add_epi64(a, b); }
 
 // sub{{{1
 Vc_INTRINSIC __m256  sub(__m256  a, __m256  b,  float) { return _mm256_sub_ps(a, b); }
@@ -707,6 +736,10 @@ Vc_INTRINSIC __m256i sub(__m256i a, __m256i b,    int) { return AVX::sub_epi32(a
 Vc_INTRINSIC __m256i sub(__m256i a, __m256i b,   uint) { return AVX::sub_epi32(a, b); }
 Vc_INTRINSIC __m256i sub(__m256i a, __m256i b,  short) { return AVX::sub_epi16(a, b); }
 Vc_INTRINSIC __m256i sub(__m256i a, __m256i b, ushort) { return AVX::sub_epi16(a, b); }
+Vc_INTRINSIC __m256i sub(__m256i a, __m256i b,  schar) { return AVX::sub_epi8 (a, b); }
+Vc_INTRINSIC __m256i sub(__m256i a, __m256i b,  uchar) { return AVX::sub_epi8 (a, b); }
+Vc_INTRINSIC __m256i sub(__m256i a, __m256i b,  llong) { return AVX::sub_epi64(a, b); }
+Vc_INTRINSIC __m256i sub(__m256i a, __m256i b, ullong) { return AVX::sub_epi64(a, b); }
 
 // mul{{{1
 Vc_INTRINSIC __m256  mul(__m256  a, __m256  b,  float) { return _mm256_mul_ps(a, b); }
@@ -715,8 +748,25 @@ Vc_INTRINSIC __m256i mul(__m256i a, __m256i b,    int) { return AVX::mullo_epi32
 Vc_INTRINSIC __m256i mul(__m256i a, __m256i b,   uint) { return AVX::mullo_epi32(a, b); }
 Vc_INTRINSIC __m256i mul(__m256i a, __m256i b,  short) { return AVX::mullo_epi16(a, b); }
 Vc_INTRINSIC __m256i mul(__m256i a, __m256i b, ushort) { return AVX::mullo_epi16(a, b); }
+Vc_INTRINSIC __m256i mul(__m256i a, __m256i b,  schar) {
+    // multiply even and odd bytes as 16-bit lanes and merge the low bytes of the products
+    using namespace AVX;
+    return or_(and_(mullo_epi16(a, b), srli_epi16<8>(setallone_si256())),
+               slli_epi16<8>(mullo_epi16(srli_epi16<8>(a), srli_epi16<8>(b))));
+}
+Vc_INTRINSIC __m256i mul(__m256i a, __m256i b,  uchar) { return mul(a, b, schar()); }
+#ifdef Vc_IMPL_AVX2
+Vc_INTRINSIC __m256i mul(__m256i a, __m256i b,  llong) {
+    // the low 64 bits of the product need lo*lo plus the two cross products shifted by 32
+    using namespace AVX;
+    const __m256i cross = add_epi64(_mm256_mul_epu32(a, srli_epi64<32>(b)),
+                                    _mm256_mul_epu32(srli_epi64<32>(a), b));
+    return add_epi64(_mm256_mul_epu32(a, b), slli_epi64<32>(cross));
+}
+Vc_INTRINSIC __m256i mul(__m256i a, __m256i b, ullong) { return mul(a, b, llong()); }
+#endif  // Vc_IMPL_AVX2
 
-// mul{{{1
+// div{{{1
 Vc_INTRINSIC __m256  div(__m256  a, __m256  b,  float) { return _mm256_div_ps(a, b); }
 Vc_INTRINSIC __m256d div(__m256d a, __m256d b, double) { return _mm256_div_pd(a, b); }
 Vc_INTRINSIC __m256i div(__m256i a, __m256i b,    int) {
@@ -756,6 +806,32 @@ Vc_INTRINSIC __m256i div(__m256i a, __m256i b,  short) {
         _mm256_div_ps(convert<short, float>(hi128(a)), convert<short, float>(hi128(b)));
     return concat(convert<float, short>(lo), convert<float, short>(hi));
 }
+#ifdef Vc_IMPL_AVX2
+Vc_INTRINSIC __m256i div(__m256i a, __m256i b,  schar) {
+    // divide as 16-bit lanes, truncate to bytes and undo the in-lane interleave of packus
+    using namespace AVX;
+    const __m256i mask = srli_epi16<8>(setallone_si256());
+    const __m256i lo = and_(div(cvtepi8_epi16(lo128(a)), cvtepi8_epi16(lo128(b)), short()), mask);
+    const __m256i hi = and_(div(cvtepi8_epi16(hi128(a)), cvtepi8_epi16(hi128(b)), short()), mask);
+    return _mm256_permute4x64_epi64(packus_epi16(lo, hi), 0xd8);
+}
+Vc_INTRINSIC __m256i div(__m256i a, __m256i b,  uchar) {
+    using namespace AVX;
+    const __m256i lo = div(cvtepu8_epi16(lo128(a)), cvtepu8_epi16(lo128(b)), short());
+    const __m256i hi = div(cvtepu8_epi16(hi128(a)), cvtepu8_epi16(hi128(b)), short());
+    return _mm256_permute4x64_epi64(packus_epi16(lo, hi), 0xd8);
+}
+#endif  // Vc_IMPL_AVX2
+template <typename T> Vc_INTRINSIC __m256i div_epi64(__m256i a, __m256i b)
+{
+    // there is no 64-bit integer division (or conversion to double without AVX-512DQ)
+    alignas(32) T x[4], y[4];
+    _mm256_store_si256(reinterpret_cast<__m256i *>(x), a);
+    _mm256_store_si256(reinterpret_cast<__m256i *>(y), b);
+    return _mm256_setr_epi64x(x[0] / y[0], x[1] / y[1], x[2] / y[2], x[3] / y[3]);
+}
+Vc_INTRINSIC __m256i div(__m256i a, __m256i b,  llong) { return div_epi64< llong>(a, b); }
+Vc_INTRINSIC __m256i div(__m256i a, __m256i b, ullong) { return div_epi64<ullong>(a, b); }
 
 // horizontal add{{{1
 template <typename T> Vc_INTRINSIC T add(Common::IntrinsicType<T, 32 / sizeof(T)> a, T)
@@ -890,30 +966,60 @@ template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a,    int) { return
 template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a,   uint) { return AVX::srli_epi32<shift>(a); }
 template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a,  short) { return AVX::srai_epi16<shift>(a); }
 template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a, ushort) { return AVX::srli_epi16<shift>(a); }
-//template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a,  schar) { return AVX::srai_epi8 <shift>(a); }
-//template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a,  uchar) { return AVX::srli_epi8 <shift>(a); }
+template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a,  uchar) {
+    return and_(AVX::srli_epi16<shift>(a), _mm256_set1_epi8(0xff >> shift));
+}
+template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a,  schar) {
+    // sign-extend the logical shift: (x ^ m) - m with m the shifted sign bit
+    const __m256i m = _mm256_set1_epi8(0x80 >> shift);
+    return AVX::sub_epi8(xor_(shiftRight<shift>(a, uchar()), m), m);
+}
+template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a, ullong) { return AVX::srli_epi64<shift>(a); }
+template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a,  llong) {
+    const __m256i m = AVX::srli_epi64<shift>(AVX::setmin_epi64());
+    return AVX::sub_epi64(xor_(AVX::srli_epi64<shift>(a), m), m);
+}
 
 Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift,    int) { return AVX::sra_epi32(a, _mm_cvtsi32_si128(shift)); }
 Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift,   uint) { return AVX::srl_epi32(a, _mm_cvtsi32_si128(shift)); }
 Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift,  short) { return AVX::sra_epi16(a, _mm_cvtsi32_si128(shift)); }
 Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift, ushort) { return AVX::srl_epi16(a, _mm_cvtsi32_si128(shift)); }
-//Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift,  schar) { return AVX::sra_epi8 (a, _mm_cvtsi32_si128(shift)); }
-//Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift,  uchar) { return AVX::srl_epi8 (a, _mm_cvtsi32_si128(shift)); }
+Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift,  uchar) {
+    return and_(AVX::srl_epi16(a, _mm_cvtsi32_si128(shift)), _mm256_set1_epi8(0xff >> shift));
+}
+Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift,  schar) {
+    const __m256i m = _mm256_set1_epi8(0x80 >> shift);
+    return AVX::sub_epi8(xor_(shiftRight(a, shift, uchar()), m), m);
+}
+Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift, ullong) { return AVX::srl_epi64(a, _mm_cvtsi32_si128(shift)); }
+Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift,  llong) {
+    const __m128i s = _mm_cvtsi32_si128(shift);
+    const __m256i m = AVX::srl_epi64(AVX::setmin_epi64(), s);
+    return AVX::sub_epi64(xor_(AVX::srl_epi64(a, s), m), m);
+}
 
 // shiftLeft{{{1
 template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a,    int) { return AVX::slli_epi32<shift>(a); }
 template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a,   uint) { return AVX::slli_epi32<shift>(a); }
 template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a,  short) { return AVX::slli_epi16<shift>(a); }
 template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a, ushort) { return AVX::slli_epi16<shift>(a); }
-//template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a,  schar) { return AVX::slli_epi8 <shift>(a); }
-//template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a,  uchar) { return AVX::slli_epi8 <shift>(a); }
+template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a,  schar) {
+    return and_(AVX::slli_epi16<shift>(a), _mm256_set1_epi8((0xff << shift) & 0xff));
+}
+template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a,  uchar) { return shiftLeft<shift>(a, schar()); }
+template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a,  llong) { return AVX::slli_epi64<shift>(a); }
+template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a, ullong) { return AVX::slli_epi64<shift>(a); }
 
 Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift,    int) { return AVX::sll_epi32(a, _mm_cvtsi32_si128(shift)); }
 Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift,   uint) { return AVX::sll_epi32(a, _mm_cvtsi32_si128(shift)); }
 Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift,  short) { return AVX::sll_epi16(a, _mm_cvtsi32_si128(shift)); }
 Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift, ushort) { return AVX::sll_epi16(a, _mm_cvtsi32_si128(shift)); }
-//Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift,  schar) { return AVX::sll_epi8 (a, _mm_cvtsi32_si128(shift)); }
-//Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift,  uchar) { return AVX::sll_epi8 (a, _mm_cvtsi32_si128(shift)); }
+Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift,  schar) {
+    return and_(AVX::sll_epi16(a, _mm_cvtsi32_si128(shift)), _mm256_set1_epi8((0xff << shift) & 0xff));
+}
+Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift,  uchar) { return shiftLeft(a, shift, schar()); }
+Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift,  llong) { return AVX::sll_epi64(a, _mm_cvtsi32_si128(shift)); }
+Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift, ullong) { return AVX::sll_epi64(a, _mm_cvtsi32_si128(shift)); }
 
 // zeroExtendIfNeeded{{{1
 Vc_INTRINSIC __m256  zeroExtendIfNeeded(__m256  x) { return x; }
@@ -933,6 +1039,8 @@ Vc_INTRINSIC __m256i avx_broadcast(ushort x) { return _mm256_set1_epi16(x); }
 Vc_INTRINSIC __m256i avx_broadcast(  char x) { return _mm256_set1_epi8(x); }
 Vc_INTRINSIC __m256i avx_broadcast( schar x) { return _mm256_set1_epi8(x); }
 Vc_INTRINSIC __m256i avx_broadcast( uchar x) { return _mm256_set1_epi8(x); }
+Vc_INTRINSIC __m256i avx_broadcast( llong x) { return _mm256_set1_epi64x(x); }
+Vc_INTRINSIC __m256i avx_broadcast(ullong x) { return _mm256_set1_epi64x(x); }
 
 // sorted{{{1
 template <Vc::Implementation Impl, typename T,
@@ -1197,6 +1305,93 @@ Vc_INTRINSIC Vc_CONST int movemask(__m128d a) { return _mm_movemask_pd(a); }
 Vc_INTRINSIC Vc_CONST int movemask(__m256  a) { return _mm256_movemask_ps(a); }
 Vc_INTRINSIC Vc_CONST int movemask(__m128  a) { return _mm_movemask_ps(a); }
 
+// compress_store{{{1
+/**\internal
+ * Stores the entries of \p x selected by \p bits contiguously to \p mem and returns
+ * their number. Writes up to 32 bytes.
+ */
+template <typename T>
+Vc_INTRINSIC std::size_t compress_store(T *mem, __m256i x, int bits,
+                                        enable_if<sizeof(T) != 4> = nullarg)
+{
+    // compress both halves with pshufb; the high half is stored right after the last
+    // selected entry of the low half
+    constexpr int Half = 16 / sizeof(T);
+    const int lo = bits & ((1 << Half) - 1);
+    const int hi = bits >> Half;
+    const std::size_t n = popcnt16(lo);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(mem),
+                     compress<sizeof(T)>(AVX::lo128(x), lo));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(mem + n),
+                     compress<sizeof(T)>(AVX::hi128(x), hi));
+    return n + popcnt16(hi);
+}
+
+template <typename T>
+Vc_INTRINSIC std::size_t compress_store(T *mem, __m256i x, int bits,
+                                        enable_if<sizeof(T) == 4> = nullarg)
+{
+#ifdef Vc_IMPL_AVX2
+    const __m256i idx = _mm256_and_si256(
+        _mm256_srlv_epi32(
+            _mm256_set1_epi32(Common::LanePermuteTable<false>::data[bits]),
+            _mm256_setr_epi32(0, 4, 8, 12, 16, 20, 24, 28)),
+        _mm256_set1_epi32(7));
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(mem),
+                        _mm256_permutevar8x32_epi32(x, idx));
+    return popcnt8(bits);
+#else
+    const int lo = bits & 0xf;
+    const std::size_t n = popcnt4(lo);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(mem), compress<4>(AVX::lo128(x), lo));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(mem + n),
+                     compress<4>(AVX::hi128(x), bits >> 4));
+    return n + popcnt4(bits >> 4);
+#endif
+}
+
+// expand_load{{{1
+/**\internal
+ * Loads consecutive values from \p mem into the entries selected by \p bits and zeroes
+ * the rest. Reads up to 32 bytes.
+ */
+template <typename T>
+Vc_INTRINSIC __m256i expand_load(const T *mem, int bits, enable_if<sizeof(T) != 4> = nullarg)
+{
+    constexpr int Half = 16 / sizeof(T);
+    const int lo = bits & ((1 << Half) - 1);
+    return AVX::concat(
+        expand<sizeof(T)>(_mm_loadu_si128(reinterpret_cast<const __m128i *>(mem)), lo),
+        expand<sizeof(T)>(
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(mem + popcnt16(lo))),
+            bits >> Half));
+}
+
+template <typename T>
+Vc_INTRINSIC __m256i expand_load(const T *mem, int bits, enable_if<sizeof(T) == 4> = nullarg)
+{
+#ifdef Vc_IMPL_AVX2
+    const __m256i shifts = _mm256_setr_epi32(0, 4, 8, 12, 16, 20, 24, 28);
+    const __m256i idx = _mm256_and_si256(
+        _mm256_srlv_epi32(_mm256_set1_epi32(Common::LanePermuteTable<true>::data[bits]),
+                          shifts),
+        _mm256_set1_epi32(7));
+    // bit i of the mask, moved to the sign bit of lane i
+    const __m256i k = _mm256_sllv_epi32(
+        _mm256_set1_epi32(bits), _mm256_setr_epi32(31, 30, 29, 28, 27, 26, 25, 24));
+    return _mm256_and_si256(
+        _mm256_srai_epi32(k, 31),
+        _mm256_permutevar8x32_epi32(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i *>(mem)), idx));
+#else
+    const int lo = bits & 0xf;
+    return AVX::concat(
+        expand<4>(_mm_loadu_si128(reinterpret_cast<const __m128i *>(mem)), lo),
+        expand<4>(_mm_loadu_si128(reinterpret_cast<const __m128i *>(mem + popcnt4(lo))),
+                  bits >> 4));
+#endif
+}
+
 // mask_store{{{1
 template <size_t N, typename Flags>
 Vc_INTRINSIC void mask_store(__m256i k, bool *mem, Flags)
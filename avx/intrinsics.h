@@ -149,6 +149,7 @@ namespace AvxIntrinsics
     static Vc_INTRINSIC m128i Vc_CONST _mm_setmin_epi32() { return _mm_castps_si128(_mm_broadcast_ss(reinterpret_cast<const float *>(&c_general::signMaskFloat[1]))); }
     static Vc_INTRINSIC m256i Vc_CONST setmin_epi16() { return _mm256_castps_si256(_mm256_broadcast_ss(reinterpret_cast<const float *>(c_general::minShort))); }
     static Vc_INTRINSIC m256i Vc_CONST setmin_epi32() { return _mm256_castps_si256(_mm256_broadcast_ss(reinterpret_cast<const float *>(&c_general::signMaskFloat[1]))); }
+    static Vc_INTRINSIC m256i Vc_CONST setmin_epi64() { return _mm256_castpd_si256(setsignmask_pd()); }
 
     template <int i>
     static Vc_INTRINSIC Vc_CONST unsigned char extract_epu8(__m128i x)
@@ -540,6 +541,9 @@ static Vc_INTRINSIC m256i cmplt_epu8(__m256i a, __m256i b) {
 static Vc_INTRINSIC m256i cmpgt_epu8(__m256i a, __m256i b) {
     return cmpgt_epi8(xor_si256(a, setmin_epi8()), xor_si256(b, setmin_epi8()));
 }
+static Vc_INTRINSIC m256i cmpgt_epu64(__m256i a, __m256i b) {
+    return cmpgt_epi64(xor_si256(a, setmin_epi64()), xor_si256(b, setmin_epi64()));
+}
 #if defined(Vc_IMPL_XOP)
     Vc_AVX_TO_SSE_2_NEW(comlt_epu32)
     Vc_AVX_TO_SSE_2_NEW(comgt_epu32)
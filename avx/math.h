@@ -40,10 +40,38 @@ Vc_ALWAYS_INLINE AVX2::int_v    min(const AVX2::int_v    &x, const AVX2::int_v
 Vc_ALWAYS_INLINE AVX2::uint_v   min(const AVX2::uint_v   &x, const AVX2::uint_v   &y) { return _mm256_min_epu32(x.data(), y.data()); }
 Vc_ALWAYS_INLINE AVX2::short_v  min(const AVX2::short_v  &x, const AVX2::short_v  &y) { return _mm256_min_epi16(x.data(), y.data()); }
 Vc_ALWAYS_INLINE AVX2::ushort_v min(const AVX2::ushort_v &x, const AVX2::ushort_v &y) { return _mm256_min_epu16(x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX2::schar_v  min(const AVX2::schar_v  &x, const AVX2::schar_v  &y) { return _mm256_min_epi8(x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX2::uchar_v  min(const AVX2::uchar_v  &x, const AVX2::uchar_v  &y) { return _mm256_min_epu8(x.data(), y.data()); }
 Vc_ALWAYS_INLINE AVX2::int_v    max(const AVX2::int_v    &x, const AVX2::int_v    &y) { return _mm256_max_epi32(x.data(), y.data()); }
 Vc_ALWAYS_INLINE AVX2::uint_v   max(const AVX2::uint_v   &x, const AVX2::uint_v   &y) { return _mm256_max_epu32(x.data(), y.data()); }
 Vc_ALWAYS_INLINE AVX2::short_v  max(const AVX2::short_v  &x, const AVX2::short_v  &y) { return _mm256_max_epi16(x.data(), y.data()); }
 Vc_ALWAYS_INLINE AVX2::ushort_v max(const AVX2::ushort_v &x, const AVX2::ushort_v &y) { return _mm256_max_epu16(x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX2::schar_v  max(const AVX2::schar_v  &x, const AVX2::schar_v  &y) { return _mm256_max_epi8(x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX2::uchar_v  max(const AVX2::uchar_v  &x, const AVX2::uchar_v  &y) { return _mm256_max_epu8(x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX2::llong_v  min(const AVX2::llong_v  &x, const AVX2::llong_v  &y) { return Detail::blend(x.data(), y.data(), AVX::cmpgt_epi64(x.data(), y.data())); }
+Vc_ALWAYS_INLINE AVX2::ullong_v min(const AVX2::ullong_v &x, const AVX2::ullong_v &y) { return Detail::blend(x.data(), y.data(), AVX::cmpgt_epu64(x.data(), y.data())); }
+Vc_ALWAYS_INLINE AVX2::llong_v  max(const AVX2::llong_v  &x, const AVX2::llong_v  &y) { return Detail::blend(y.data(), x.data(), AVX::cmpgt_epi64(x.data(), y.data())); }
+Vc_ALWAYS_INLINE AVX2::ullong_v max(const AVX2::ullong_v &x, const AVX2::ullong_v &y) { return Detail::blend(y.data(), x.data(), AVX::cmpgt_epu64(x.data(), y.data())); }
+
+Vc_ALWAYS_INLINE AVX2::short_v  add_sat(const AVX2::short_v  &x, const AVX2::short_v  &y) { return _mm256_adds_epi16(x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX2::ushort_v add_sat(const AVX2::ushort_v &x, const AVX2::ushort_v &y) { return _mm256_adds_epu16(x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX2::schar_v  add_sat(const AVX2::schar_v  &x, const AVX2::schar_v  &y) { return _mm256_adds_epi8 (x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX2::uchar_v  add_sat(const AVX2::uchar_v  &x, const AVX2::uchar_v  &y) { return _mm256_adds_epu8 (x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX2::short_v  sub_sat(const AVX2::short_v  &x, const AVX2::short_v  &y) { return _mm256_subs_epi16(x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX2::ushort_v sub_sat(const AVX2::ushort_v &x, const AVX2::ushort_v &y) { return _mm256_subs_epu16(x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX2::schar_v  sub_sat(const AVX2::schar_v  &x, const AVX2::schar_v  &y) { return _mm256_subs_epi8 (x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX2::uchar_v  sub_sat(const AVX2::uchar_v  &x, const AVX2::uchar_v  &y) { return _mm256_subs_epu8 (x.data(), y.data()); }
+
+// nibble_lookup {{{1
+template <typename T, typename = enable_if<sizeof(T) == 1>>
+Vc_INTRINSIC Vc_PURE AVX2::Vector<T> nibble_lookup(const AVX2::Vector<T> &x,
+                                                   const T (&table)[16])
+{
+    // vpshufb looks up within each 128-bit lane, so both lanes get the whole table
+    return _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(_mm_loadu_si128(
+                                   reinterpret_cast<const __m128i *>(&table[0]))),
+                               _mm256_and_si256(x.data(), _mm256_set1_epi8(0x0f)));
+}
 #endif
 Vc_ALWAYS_INLINE AVX2::float_v  min(const AVX2::float_v  &x, const AVX2::float_v  &y) { return _mm256_min_ps(x.data(), y.data()); }
 Vc_ALWAYS_INLINE AVX2::double_v min(const AVX2::double_v &x, const AVX2::double_v &y) { return _mm256_min_pd(x.data(), y.data()); }
@@ -96,6 +124,14 @@ Vc_INTRINSIC Vc_CONST AVX2::short_v abs(AVX2::short_v x)
 {
     return _mm256_abs_epi16(x.data());
 }
+Vc_INTRINSIC Vc_CONST AVX2::schar_v abs(AVX2::schar_v x)
+{
+    return _mm256_abs_epi8(x.data());
+}
+Vc_INTRINSIC Vc_CONST AVX2::llong_v abs(AVX2::llong_v x)
+{
+    return Detail::abs(x.data(), llong());
+}
 #endif
 
 // isfinite {{{1
@@ -258,17 +294,44 @@ inline AVX2::double_v ldexp(AVX2::double_v::AsArg v,
     return AVX::avx_cast<__m256d>(
         AVX::add_epi64(AVX::avx_cast<__m256i>(v.data()), exponentBits));
 }
-inline AVX2::float_v ldexp(AVX2::float_v::AsArg v, SimdArray<int, 8, SSE::int_v, 4> e)
+inline AVX2::float_v ldexp(AVX2::float_v::AsArg v, AVX2::float_v::IndexType e)
 {
     e.setZero(simd_cast<decltype(e == e)>(v == AVX2::float_v::Zero()));
     e <<= 23;
+#ifdef Vc_IMPL_AVX2
+    return {AVX::avx_cast<__m256>(
+        _mm256_add_epi32(AVX::avx_cast<__m256i>(v.data()), internal_data(e).data()))};
+#else
     return {AVX::avx_cast<__m256>(
         AVX::concat(_mm_add_epi32(AVX::avx_cast<__m128i>(AVX::lo128(v.data())),
                                   internal_data(internal_data0(e)).data()),
                     _mm_add_epi32(AVX::avx_cast<__m128i>(AVX::hi128(v.data())),
                                   internal_data(internal_data1(e)).data())))};
+#endif
 }
 
+#ifdef Vc_IMPL_AVX2
+// the counterpart to frexp above: without it the int argument is split via simd_cast into
+// two SSE halves for the two double_v ldexp calls
+inline SimdArray<double, 8, AVX2::double_v, 4> ldexp(
+    const SimdArray<double, 8, AVX2::double_v, 4> &v,
+    const SimdArray<int, 8, AVX2::int_v, 8> &_e)
+{
+    const auto zeroMask = simd_cast<AVX2::int_m>(v == v.Zero());
+    const __m256i e = Detail::andnot_(zeroMask.dataI(), internal_data(_e).data());
+    // sign-extend the eight exponents to 64 bits and shift them into the exponent field
+    const __m256i exponentBits[2] = {
+        _mm256_slli_epi64(_mm256_cvtepi32_epi64(AVX::lo128(e)), 52),
+        _mm256_slli_epi64(_mm256_cvtepi32_epi64(AVX::hi128(e)), 52)};
+    return {SimdArray<double, 4, AVX2::double_v, 4>(AVX::avx_cast<__m256d>(_mm256_add_epi64(
+                AVX::avx_cast<__m256i>(internal_data(internal_data0(v)).data()),
+                exponentBits[0]))),
+            SimdArray<double, 4, AVX2::double_v, 4>(AVX::avx_cast<__m256d>(_mm256_add_epi64(
+                AVX::avx_cast<__m256i>(internal_data(internal_data1(v)).data()),
+                exponentBits[1])))};
+}
+#endif  // Vc_IMPL_AVX2
+
 // trunc {{{1
 Vc_ALWAYS_INLINE AVX2::float_v trunc(AVX2::float_v::AsArg v)
 {
@@ -197,6 +197,23 @@ Vc_SIMD_CAST_AVX_2(   int_v, ushort_v);
 Vc_SIMD_CAST_AVX_2(  uint_v, ushort_v);
 Vc_SIMD_CAST_AVX_3(double_v, ushort_v);
 Vc_SIMD_CAST_AVX_4(double_v, ushort_v);
+
+Vc_SIMD_CAST_AVX_1(double_v,  llong_v);
+Vc_SIMD_CAST_AVX_1(   int_v,  llong_v);
+Vc_SIMD_CAST_AVX_1(  uint_v,  llong_v);
+Vc_SIMD_CAST_AVX_1(ullong_v,  llong_v);
+
+Vc_SIMD_CAST_AVX_1(double_v, ullong_v);
+Vc_SIMD_CAST_AVX_1(   int_v, ullong_v);
+Vc_SIMD_CAST_AVX_1(  uint_v, ullong_v);
+Vc_SIMD_CAST_AVX_1( llong_v, ullong_v);
+
+Vc_SIMD_CAST_AVX_1( llong_v, double_v);
+Vc_SIMD_CAST_AVX_1(ullong_v, double_v);
+Vc_SIMD_CAST_AVX_1( llong_v,    int_v);
+Vc_SIMD_CAST_AVX_1(ullong_v,    int_v);
+Vc_SIMD_CAST_AVX_1( llong_v,   uint_v);
+Vc_SIMD_CAST_AVX_1(ullong_v,   uint_v);
 #endif
 
 // 1 SSE::Vector to 1 AVX2::Vector {{{2
@@ -244,6 +261,11 @@ Vc_SIMD_CAST_1(SSE::   int_v, AVX2::ushort_v);
 Vc_SIMD_CAST_1(SSE::  uint_v, AVX2::ushort_v);
 Vc_SIMD_CAST_1(SSE:: short_v, AVX2::ushort_v);
 Vc_SIMD_CAST_1(SSE::ushort_v, AVX2::ushort_v);
+
+Vc_SIMD_CAST_1(SSE::   int_v, AVX2:: llong_v);
+Vc_SIMD_CAST_1(SSE::  uint_v, AVX2:: llong_v);
+Vc_SIMD_CAST_1(SSE::   int_v, AVX2::ullong_v);
+Vc_SIMD_CAST_1(SSE::  uint_v, AVX2::ullong_v);
 #endif
 
 // 2 SSE::Vector to 1 AVX2::Vector {{{2
@@ -387,6 +409,11 @@ Vc_SIMD_CAST_1(AVX2::ushort_v, SSE::   int_v);
 Vc_SIMD_CAST_1(AVX2::ushort_v, SSE::  uint_v);
 Vc_SIMD_CAST_1(AVX2::ushort_v, SSE:: short_v);
 Vc_SIMD_CAST_1(AVX2::ushort_v, SSE::ushort_v);
+
+Vc_SIMD_CAST_1(AVX2:: llong_v, SSE::   int_v);
+Vc_SIMD_CAST_1(AVX2:: llong_v, SSE::  uint_v);
+Vc_SIMD_CAST_1(AVX2::ullong_v, SSE::   int_v);
+Vc_SIMD_CAST_1(AVX2::ullong_v, SSE::  uint_v);
 #endif
 
 // 2 AVX2::Vector to 1 SSE::Vector {{{2
@@ -1415,6 +1442,47 @@ Vc_SIMD_CAST_AVX_4(double_v, ushort_v) {
 }
 #endif
 
+// 1: to llong_v and ullong_v {{{3
+#ifdef Vc_IMPL_AVX2
+Vc_SIMD_CAST_AVX_1(double_v,  llong_v) {
+    using namespace AVX;
+    return concat(SSE::convert<double, llong>(lo128(x.data())),
+                  SSE::convert<double, llong>(hi128(x.data())));
+}
+Vc_SIMD_CAST_AVX_1(   int_v,  llong_v) { return AVX::cvtepi32_epi64(AVX::lo128(x.data())); }
+Vc_SIMD_CAST_AVX_1(  uint_v,  llong_v) { return AVX::cvtepu32_epi64(AVX::lo128(x.data())); }
+Vc_SIMD_CAST_AVX_1(ullong_v,  llong_v) { return x.data(); }
+
+Vc_SIMD_CAST_AVX_1(double_v, ullong_v) {
+    using namespace AVX;
+    return concat(SSE::convert<double, ullong>(lo128(x.data())),
+                  SSE::convert<double, ullong>(hi128(x.data())));
+}
+Vc_SIMD_CAST_AVX_1(   int_v, ullong_v) { return AVX::cvtepi32_epi64(AVX::lo128(x.data())); }
+Vc_SIMD_CAST_AVX_1(  uint_v, ullong_v) { return AVX::cvtepu32_epi64(AVX::lo128(x.data())); }
+Vc_SIMD_CAST_AVX_1( llong_v, ullong_v) { return x.data(); }
+
+// 1: from llong_v and ullong_v {{{3
+Vc_SIMD_CAST_AVX_1( llong_v, double_v) {
+    using namespace AVX;
+    return concat(SSE::convert<llong, double>(lo128(x.data())),
+                  SSE::convert<llong, double>(hi128(x.data())));
+}
+Vc_SIMD_CAST_AVX_1(ullong_v, double_v) {
+    using namespace AVX;
+    return concat(SSE::convert<ullong, double>(lo128(x.data())),
+                  SSE::convert<ullong, double>(hi128(x.data())));
+}
+// keep the low 32 bits of every entry and move them into the low half
+Vc_SIMD_CAST_AVX_1( llong_v,    int_v) {
+    return AVX::zeroExtend(AVX::lo128(
+        _mm256_permutevar8x32_epi32(x.data(), _mm256_setr_epi32(0, 2, 4, 6, 0, 0, 0, 0))));
+}
+Vc_SIMD_CAST_AVX_1(ullong_v,    int_v) { return simd_cast<AVX2::int_v>(AVX2::llong_v(x.data())); }
+Vc_SIMD_CAST_AVX_1( llong_v,   uint_v) { return simd_cast<AVX2::int_v>(x).data(); }
+Vc_SIMD_CAST_AVX_1(ullong_v,   uint_v) { return simd_cast<AVX2::int_v>(AVX2::llong_v(x.data())).data(); }
+#endif
+
 // 1 SSE::Vector to 1 AVX2::Vector {{{2
 Vc_SIMD_CAST_1(SSE::double_v, AVX2::double_v) { return AVX::zeroExtend(x.data()); }
 Vc_SIMD_CAST_1(SSE:: float_v, AVX2::double_v) { return _mm256_cvtps_pd(x.data()); }
@@ -1460,6 +1528,11 @@ Vc_SIMD_CAST_1(SSE::   int_v, AVX2::ushort_v) { return AVX::zeroExtend(simd_cast
 Vc_SIMD_CAST_1(SSE::  uint_v, AVX2::ushort_v) { return AVX::zeroExtend(simd_cast<SSE::ushort_v>(x).data()); }
 Vc_SIMD_CAST_1(SSE:: short_v, AVX2::ushort_v) { return AVX::zeroExtend(x.data()); }
 Vc_SIMD_CAST_1(SSE::ushort_v, AVX2::ushort_v) { return AVX::zeroExtend(x.data()); }
+
+Vc_SIMD_CAST_1(SSE::   int_v, AVX2:: llong_v) { return AVX::cvtepi32_epi64(x.data()); }
+Vc_SIMD_CAST_1(SSE::  uint_v, AVX2:: llong_v) { return AVX::cvtepu32_epi64(x.data()); }
+Vc_SIMD_CAST_1(SSE::   int_v, AVX2::ullong_v) { return AVX::cvtepi32_epi64(x.data()); }
+Vc_SIMD_CAST_1(SSE::  uint_v, AVX2::ullong_v) { return AVX::cvtepu32_epi64(x.data()); }
 #endif
 
 // 2 SSE::Vector to 1 AVX2::Vector {{{2
@@ -1605,6 +1678,11 @@ Vc_SIMD_CAST_1(AVX2::ushort_v, SSE:: float_v) { return simd_cast<SSE:: float_v>(
 Vc_SIMD_CAST_1(AVX2::ushort_v, SSE::   int_v) { return simd_cast<SSE::   int_v>(simd_cast<SSE::ushort_v>(x)); }
 Vc_SIMD_CAST_1(AVX2::ushort_v, SSE::  uint_v) { return simd_cast<SSE::  uint_v>(simd_cast<SSE::ushort_v>(x)); }
 Vc_SIMD_CAST_1(AVX2::ushort_v, SSE:: short_v) { return simd_cast<SSE:: short_v>(simd_cast<SSE::ushort_v>(x)); }
+
+Vc_SIMD_CAST_1(AVX2:: llong_v, SSE::   int_v) { return AVX::lo128(simd_cast<AVX2::int_v>(x).data()); }
+Vc_SIMD_CAST_1(AVX2:: llong_v, SSE::  uint_v) { return AVX::lo128(simd_cast<AVX2::int_v>(x).data()); }
+Vc_SIMD_CAST_1(AVX2::ullong_v, SSE::   int_v) { return AVX::lo128(simd_cast<AVX2::int_v>(x).data()); }
+Vc_SIMD_CAST_1(AVX2::ullong_v, SSE::  uint_v) { return AVX::lo128(simd_cast<AVX2::int_v>(x).data()); }
 #endif
 
 // 2 AVX2::Vector to 1 SSE::Vector {{{2
@@ -38,6 +38,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <cmath>
 #include "../common/aliasingentryhelper.h"
 #include "../common/memoryfwd.h"
+#include "../common/scalarization.h"
 #include "../common/where.h"
 #include "macros.h"
 
@@ -327,10 +328,12 @@ public:
         Vc_INTRINSIC_L Vector shifted(int amount) const Vc_INTRINSIC_R;
         Vc_INTRINSIC_L Vector rotated(int amount) const Vc_INTRINSIC_R;
         Vc_INTRINSIC_L Vc_PURE_L Vector reversed() const Vc_INTRINSIC_R Vc_PURE_R;
+        Vc_INTRINSIC_L Vc_PURE_L Vector permute(const IndexType &idx) const Vc_INTRINSIC_R Vc_PURE_R;
         Vc_ALWAYS_INLINE_L Vc_PURE_L Vector sorted() const Vc_ALWAYS_INLINE_R Vc_PURE_R;
 
         template <typename F> void callWithValuesSorted(F &&f)
         {
+            Common::scalarized_callWithValuesSorted(this);
             EntryType value = d.m(0);
             f(value);
             for (size_t i = 1; i < Size; ++i) {
@@ -343,11 +346,13 @@ public:
 
         template <typename F> Vc_INTRINSIC void call(F &&f) const
         {
+            Common::scalarized_apply(this);
             Common::for_all_vector_entries<Size>([&](size_t i) { f(EntryType(d.m(i))); });
         }
 
         template <typename F> Vc_INTRINSIC void call(F &&f, const Mask &mask) const
         {
+            Common::scalarized_apply(this);
             for (size_t i : where(mask)) {
                 f(EntryType(d.m(i)));
             }
@@ -355,6 +360,7 @@ public:
 
         template <typename F> Vc_INTRINSIC Vector apply(F &&f) const
         {
+            Common::scalarized_apply(this);
             Vector r;
             Common::for_all_vector_entries<Size>(
                 [&](size_t i) { r.d.set(i, f(EntryType(d.m(i)))); });
@@ -363,6 +369,7 @@ public:
 
         template <typename F> Vc_INTRINSIC Vector apply(F &&f, const Mask &mask) const
         {
+            Common::scalarized_apply(this);
             Vector r(*this);
             for (size_t i : where(mask)) {
                 r.d.set(i, f(EntryType(r.d.m(i))));
@@ -44,6 +44,10 @@ Vc_INTRINSIC AVX2::   int_m operator==(AVX2::   int_v a, AVX2::   int_v b) { ret
 Vc_INTRINSIC AVX2::  uint_m operator==(AVX2::  uint_v a, AVX2::  uint_v b) { return AVX::cmpeq_epi32(a.data(), b.data()); }
 Vc_INTRINSIC AVX2:: short_m operator==(AVX2:: short_v a, AVX2:: short_v b) { return AVX::cmpeq_epi16(a.data(), b.data()); }
 Vc_INTRINSIC AVX2::ushort_m operator==(AVX2::ushort_v a, AVX2::ushort_v b) { return AVX::cmpeq_epi16(a.data(), b.data()); }
+Vc_INTRINSIC AVX2:: schar_m operator==(AVX2:: schar_v a, AVX2:: schar_v b) { return AVX::cmpeq_epi8(a.data(), b.data()); }
+Vc_INTRINSIC AVX2:: uchar_m operator==(AVX2:: uchar_v a, AVX2:: uchar_v b) { return AVX::cmpeq_epi8(a.data(), b.data()); }
+Vc_INTRINSIC AVX2:: llong_m operator==(AVX2:: llong_v a, AVX2:: llong_v b) { return AVX::cmpeq_epi64(a.data(), b.data()); }
+Vc_INTRINSIC AVX2::ullong_m operator==(AVX2::ullong_v a, AVX2::ullong_v b) { return AVX::cmpeq_epi64(a.data(), b.data()); }
 
 Vc_INTRINSIC AVX2::double_m operator!=(AVX2::double_v a, AVX2::double_v b) { return AVX::cmpneq_pd(a.data(), b.data()); }
 Vc_INTRINSIC AVX2:: float_m operator!=(AVX2:: float_v a, AVX2:: float_v b) { return AVX::cmpneq_ps(a.data(), b.data()); }
@@ -51,6 +55,10 @@ Vc_INTRINSIC AVX2::   int_m operator!=(AVX2::   int_v a, AVX2::   int_v b) { ret
 Vc_INTRINSIC AVX2::  uint_m operator!=(AVX2::  uint_v a, AVX2::  uint_v b) { return not_(AVX::cmpeq_epi32(a.data(), b.data())); }
 Vc_INTRINSIC AVX2:: short_m operator!=(AVX2:: short_v a, AVX2:: short_v b) { return not_(AVX::cmpeq_epi16(a.data(), b.data())); }
 Vc_INTRINSIC AVX2::ushort_m operator!=(AVX2::ushort_v a, AVX2::ushort_v b) { return not_(AVX::cmpeq_epi16(a.data(), b.data())); }
+Vc_INTRINSIC AVX2:: schar_m operator!=(AVX2:: schar_v a, AVX2:: schar_v b) { return not_(AVX::cmpeq_epi8(a.data(), b.data())); }
+Vc_INTRINSIC AVX2:: uchar_m operator!=(AVX2:: uchar_v a, AVX2:: uchar_v b) { return not_(AVX::cmpeq_epi8(a.data(), b.data())); }
+Vc_INTRINSIC AVX2:: llong_m operator!=(AVX2:: llong_v a, AVX2:: llong_v b) { return not_(AVX::cmpeq_epi64(a.data(), b.data())); }
+Vc_INTRINSIC AVX2::ullong_m operator!=(AVX2::ullong_v a, AVX2::ullong_v b) { return not_(AVX::cmpeq_epi64(a.data(), b.data())); }
 
 Vc_INTRINSIC AVX2::double_m operator>=(AVX2::double_v a, AVX2::double_v b) { return AVX::cmpnlt_pd(a.data(), b.data()); }
 Vc_INTRINSIC AVX2:: float_m operator>=(AVX2:: float_v a, AVX2:: float_v b) { return AVX::cmpnlt_ps(a.data(), b.data()); }
@@ -58,6 +66,10 @@ Vc_INTRINSIC AVX2::   int_m operator>=(AVX2::   int_v a, AVX2::   int_v b) { ret
 Vc_INTRINSIC AVX2::  uint_m operator>=(AVX2::  uint_v a, AVX2::  uint_v b) { return not_(AVX::cmplt_epu32(a.data(), b.data())); }
 Vc_INTRINSIC AVX2:: short_m operator>=(AVX2:: short_v a, AVX2:: short_v b) { return not_(AVX::cmplt_epi16(a.data(), b.data())); }
 Vc_INTRINSIC AVX2::ushort_m operator>=(AVX2::ushort_v a, AVX2::ushort_v b) { return not_(AVX::cmplt_epu16(a.data(), b.data())); }
+Vc_INTRINSIC AVX2:: schar_m operator>=(AVX2:: schar_v a, AVX2:: schar_v b) { return not_(AVX::cmplt_epi8(a.data(), b.data())); }
+Vc_INTRINSIC AVX2:: uchar_m operator>=(AVX2:: uchar_v a, AVX2:: uchar_v b) { return not_(AVX::cmplt_epu8(a.data(), b.data())); }
+Vc_INTRINSIC AVX2:: llong_m operator>=(AVX2:: llong_v a, AVX2:: llong_v b) { return not_(AVX::cmplt_epi64(a.data(), b.data())); }
+Vc_INTRINSIC AVX2::ullong_m operator>=(AVX2::ullong_v a, AVX2::ullong_v b) { return not_(AVX::cmpgt_epu64(b.data(), a.data())); }
 
 Vc_INTRINSIC AVX2::double_m operator<=(AVX2::double_v a, AVX2::double_v b) { return AVX::cmple_pd(a.data(), b.data()); }
 Vc_INTRINSIC AVX2:: float_m operator<=(AVX2:: float_v a, AVX2:: float_v b) { return AVX::cmple_ps(a.data(), b.data()); }
@@ -65,6 +77,10 @@ Vc_INTRINSIC AVX2::   int_m operator<=(AVX2::   int_v a, AVX2::   int_v b) { ret
 Vc_INTRINSIC AVX2::  uint_m operator<=(AVX2::  uint_v a, AVX2::  uint_v b) { return not_(AVX::cmpgt_epu32(a.data(), b.data())); }
 Vc_INTRINSIC AVX2:: short_m operator<=(AVX2:: short_v a, AVX2:: short_v b) { return not_(AVX::cmpgt_epi16(a.data(), b.data())); }
 Vc_INTRINSIC AVX2::ushort_m operator<=(AVX2::ushort_v a, AVX2::ushort_v b) { return not_(AVX::cmpgt_epu16(a.data(), b.data())); }
+Vc_INTRINSIC AVX2:: schar_m operator<=(AVX2:: schar_v a, AVX2:: schar_v b) { return not_(AVX::cmpgt_epi8(a.data(), b.data())); }
+Vc_INTRINSIC AVX2:: uchar_m operator<=(AVX2:: uchar_v a, AVX2:: uchar_v b) { return not_(AVX::cmpgt_epu8(a.data(), b.data())); }
+Vc_INTRINSIC AVX2:: llong_m operator<=(AVX2:: llong_v a, AVX2:: llong_v b) { return not_(AVX::cmpgt_epi64(a.data(), b.data())); }
+Vc_INTRINSIC AVX2::ullong_m operator<=(AVX2::ullong_v a, AVX2::ullong_v b) { return not_(AVX::cmpgt_epu64(a.data(), b.data())); }
 
 Vc_INTRINSIC AVX2::double_m operator> (AVX2::double_v a, AVX2::double_v b) { return AVX::cmpgt_pd(a.data(), b.data()); }
 Vc_INTRINSIC AVX2:: float_m operator> (AVX2:: float_v a, AVX2:: float_v b) { return AVX::cmpgt_ps(a.data(), b.data()); }
@@ -72,6 +88,10 @@ Vc_INTRINSIC AVX2::   int_m operator> (AVX2::   int_v a, AVX2::   int_v b) { ret
 Vc_INTRINSIC AVX2::  uint_m operator> (AVX2::  uint_v a, AVX2::  uint_v b) { return AVX::cmpgt_epu32(a.data(), b.data()); }
 Vc_INTRINSIC AVX2:: short_m operator> (AVX2:: short_v a, AVX2:: short_v b) { return AVX::cmpgt_epi16(a.data(), b.data()); }
 Vc_INTRINSIC AVX2::ushort_m operator> (AVX2::ushort_v a, AVX2::ushort_v b) { return AVX::cmpgt_epu16(a.data(), b.data()); }
+Vc_INTRINSIC AVX2:: schar_m operator> (AVX2:: schar_v a, AVX2:: schar_v b) { return AVX::cmpgt_epi8(a.data(), b.data()); }
+Vc_INTRINSIC AVX2:: uchar_m operator> (AVX2:: uchar_v a, AVX2:: uchar_v b) { return AVX::cmpgt_epu8(a.data(), b.data()); }
+Vc_INTRINSIC AVX2:: llong_m operator> (AVX2:: llong_v a, AVX2:: llong_v b) { return AVX::cmpgt_epi64(a.data(), b.data()); }
+Vc_INTRINSIC AVX2::ullong_m operator> (AVX2::ullong_v a, AVX2::ullong_v b) { return AVX::cmpgt_epu64(a.data(), b.data()); }
 
 Vc_INTRINSIC AVX2::double_m operator< (AVX2::double_v a, AVX2::double_v b) { return AVX::cmplt_pd(a.data(), b.data()); }
 Vc_INTRINSIC AVX2:: float_m operator< (AVX2:: float_v a, AVX2:: float_v b) { return AVX::cmplt_ps(a.data(), b.data()); }
@@ -79,6 +99,10 @@ Vc_INTRINSIC AVX2::   int_m operator< (AVX2::   int_v a, AVX2::   int_v b) { ret
 Vc_INTRINSIC AVX2::  uint_m operator< (AVX2::  uint_v a, AVX2::  uint_v b) { return AVX::cmplt_epu32(a.data(), b.data()); }
 Vc_INTRINSIC AVX2:: short_m operator< (AVX2:: short_v a, AVX2:: short_v b) { return AVX::cmplt_epi16(a.data(), b.data()); }
 Vc_INTRINSIC AVX2::ushort_m operator< (AVX2::ushort_v a, AVX2::ushort_v b) { return AVX::cmplt_epu16(a.data(), b.data()); }
+Vc_INTRINSIC AVX2:: schar_m operator< (AVX2:: schar_v a, AVX2:: schar_v b) { return AVX::cmplt_epi8(a.data(), b.data()); }
+Vc_INTRINSIC AVX2:: uchar_m operator< (AVX2:: uchar_v a, AVX2:: uchar_v b) { return AVX::cmplt_epu8(a.data(), b.data()); }
+Vc_INTRINSIC AVX2:: llong_m operator< (AVX2:: llong_v a, AVX2:: llong_v b) { return AVX::cmplt_epi64(a.data(), b.data()); }
+Vc_INTRINSIC AVX2::ullong_m operator< (AVX2::ullong_v a, AVX2::ullong_v b) { return AVX::cmpgt_epu64(b.data(), a.data()); }
 
 // bitwise operators {{{1
 template <typename T>
@@ -114,7 +138,9 @@ Vc_INTRINSIC AVX2::Vector<T> operator*(AVX2::Vector<T> a, AVX2::Vector<T> b)
     return mul(a.data(), b.data(), T());
 }
 template <typename T>
-Vc_INTRINSIC AVX2::Vector<T> operator/(AVX2::Vector<T> a, AVX2::Vector<T> b)
+Vc_INTRINSIC enable_if<!std::is_same<llong, T>::value && !std::is_same<ullong, T>::value,
+                       AVX2::Vector<T>>
+operator/(AVX2::Vector<T> a, AVX2::Vector<T> b)
 {
     return div(a.data(), b.data(), T());
 }
@@ -137,6 +163,15 @@ Vc_INTRINSIC AVX2::Vector<ushort> operator/(AVX2::Vector<ushort> a,
     return concat(loShort, hiShort);
 }
 template <typename T>
+Vc_INTRINSIC enable_if<std::is_same<llong, T>::value || std::is_same<ullong, T>::value,
+                       AVX2::Vector<T>>
+operator/(AVX2::Vector<T> a, AVX2::Vector<T> b)
+{
+    // there is no 64-bit integer division: div_epi64 divides one entry at a time
+    Common::scalarized_operation(&a);
+    return div(a.data(), b.data(), T());
+}
+template <typename T>
 Vc_INTRINSIC enable_if<std::is_integral<T>::value, AVX2::Vector<T>> operator%(
     AVX2::Vector<T> a, AVX2::Vector<T> b)
 {
@@ -231,6 +266,38 @@ template <> template <typename G> Vc_INTRINSIC AVX2::ushort_v AVX2::ushort_v::ge
     const auto tmp15 = gen(15);
     return _mm256_setr_epi16(tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp7, tmp8, tmp9, tmp10, tmp11, tmp12, tmp13, tmp14, tmp15);
 }
+template <> template <typename G> Vc_INTRINSIC AVX2::schar_v AVX2::schar_v::generate(G gen)
+{
+    alignas(32) schar tmp[32];
+    for (int i = 0; i < 32; ++i) {
+        tmp[i] = gen(i);
+    }
+    return _mm256_load_si256(reinterpret_cast<const __m256i *>(&tmp[0]));
+}
+template <> template <typename G> Vc_INTRINSIC AVX2::uchar_v AVX2::uchar_v::generate(G gen)
+{
+    alignas(32) uchar tmp[32];
+    for (int i = 0; i < 32; ++i) {
+        tmp[i] = gen(i);
+    }
+    return _mm256_load_si256(reinterpret_cast<const __m256i *>(&tmp[0]));
+}
+template <> template <typename G> Vc_INTRINSIC AVX2::llong_v AVX2::llong_v::generate(G gen)
+{
+    const auto tmp0 = gen(0);
+    const auto tmp1 = gen(1);
+    const auto tmp2 = gen(2);
+    const auto tmp3 = gen(3);
+    return _mm256_setr_epi64x(tmp0, tmp1, tmp2, tmp3);
+}
+template <> template <typename G> Vc_INTRINSIC AVX2::ullong_v AVX2::ullong_v::generate(G gen)
+{
+    const auto tmp0 = gen(0);
+    const auto tmp1 = gen(1);
+    const auto tmp2 = gen(2);
+    const auto tmp3 = gen(3);
+    return _mm256_setr_epi64x(tmp0, tmp1, tmp2, tmp3);
+}
 #endif
 
 // constants {{{1
@@ -245,6 +312,8 @@ template <> Vc_INTRINSIC Vector< short, VectorAbi::Avx>::Vector(VectorSpecialIni
 template <> Vc_INTRINSIC Vector<ushort, VectorAbi::Avx>::Vector(VectorSpecialInitializerOne) : d(AVX::setone_epu16()) {}
 template <> Vc_INTRINSIC Vector< schar, VectorAbi::Avx>::Vector(VectorSpecialInitializerOne) : d(AVX::setone_epi8()) {}
 template <> Vc_INTRINSIC Vector< uchar, VectorAbi::Avx>::Vector(VectorSpecialInitializerOne) : d(AVX::setone_epu8()) {}
+template <> Vc_INTRINSIC Vector< llong, VectorAbi::Avx>::Vector(VectorSpecialInitializerOne) : d(Detail::one(llong())) {}
+template <> Vc_INTRINSIC Vector<ullong, VectorAbi::Avx>::Vector(VectorSpecialInitializerOne) : d(Detail::one(ullong())) {}
 #endif
 
 template <typename T>
@@ -264,6 +333,20 @@ Vc_ALWAYS_INLINE Vector<double, VectorAbi::Avx>::Vector(VectorSpecialInitializer
     : Vector(AVX::IndexesFromZeroData<int>::address(), Vc::Aligned)
 {
 }
+#ifdef Vc_IMPL_AVX2
+template <>
+Vc_ALWAYS_INLINE Vector<llong, VectorAbi::Avx>::Vector(VectorSpecialInitializerIndexesFromZero)
+    : d(AVX::cvtepu32_epi64(_mm_load_si128(
+          reinterpret_cast<const __m128i *>(AVX::IndexesFromZeroData<uint>::address()))))
+{
+}
+template <>
+Vc_ALWAYS_INLINE Vector<ullong, VectorAbi::Avx>::Vector(VectorSpecialInitializerIndexesFromZero)
+    : d(AVX::cvtepu32_epi64(_mm_load_si128(
+          reinterpret_cast<const __m128i *>(AVX::IndexesFromZeroData<uint>::address()))))
+{
+}
+#endif
 
 ///////////////////////////////////////////////////////////////////////////////////////////
 // load member functions {{{1
@@ -334,6 +417,22 @@ Vc_INTRINSIC void Vector<T, VectorAbi::Avx>::store(U *mem, Mask mask, Flags flag
     HV::template store<Flags>(mem, data(), AVX::avx_cast<VectorType>(mask.data()));
 }
 
+///////////////////////////////////////////////////////////////////////////////////////////
+// compressStore / expandLoad {{{1
+template <typename T>
+Vc_INTRINSIC std::size_t Vector<T, VectorAbi::Avx>::compressStore(EntryType *mem,
+                                                                  Mask mask) const
+{
+    return Detail::compress_store(mem, AVX::avx_cast<__m256i>(data()), mask.toInt());
+}
+
+template <typename T>
+Vc_INTRINSIC Vector<T, VectorAbi::Avx> Vector<T, VectorAbi::Avx>::expandLoad(
+    const EntryType *mem, Mask mask)
+{
+    return AVX::avx_cast<VectorType>(Detail::expand_load(mem, mask.toInt()));
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////
 // integer ops {{{1
 #ifdef Vc_IMPL_AVX2
@@ -345,6 +444,15 @@ template <> Vc_ALWAYS_INLINE AVX2::Vector< short> Vector< short, VectorAbi::Avx>
 template <> Vc_ALWAYS_INLINE AVX2::Vector<ushort> Vector<ushort, VectorAbi::Avx>::operator<<(AsArg x) const { return generate([&](int i) { return get(*this, i) << get(x, i); }); }
 template <> Vc_ALWAYS_INLINE AVX2::Vector< short> Vector< short, VectorAbi::Avx>::operator>>(AsArg x) const { return generate([&](int i) { return get(*this, i) >> get(x, i); }); }
 template <> Vc_ALWAYS_INLINE AVX2::Vector<ushort> Vector<ushort, VectorAbi::Avx>::operator>>(AsArg x) const { return generate([&](int i) { return get(*this, i) >> get(x, i); }); }
+template <> Vc_ALWAYS_INLINE AVX2::Vector< llong> Vector< llong, VectorAbi::Avx>::operator<<(AsArg x) const { return _mm256_sllv_epi64(d.v(), x.d.v()); }
+template <> Vc_ALWAYS_INLINE AVX2::Vector<ullong> Vector<ullong, VectorAbi::Avx>::operator<<(AsArg x) const { return _mm256_sllv_epi64(d.v(), x.d.v()); }
+template <> Vc_ALWAYS_INLINE AVX2::Vector< llong> Vector< llong, VectorAbi::Avx>::operator>>(AsArg x) const
+{
+    // there is no srav_epi64: shift the one's complement of negative entries logically
+    const __m256i m = _mm256_cmpgt_epi64(_mm256_setzero_si256(), d.v());
+    return _mm256_xor_si256(_mm256_srlv_epi64(_mm256_xor_si256(d.v(), m), x.d.v()), m);
+}
+template <> Vc_ALWAYS_INLINE AVX2::Vector<ullong> Vector<ullong, VectorAbi::Avx>::operator>>(AsArg x) const { return _mm256_srlv_epi64(d.v(), x.d.v()); }
 template <typename T>
 Vc_ALWAYS_INLINE AVX2::Vector<T> &Vector<T, VectorAbi::Avx>::operator<<=(AsArg x)
 {
@@ -451,6 +559,22 @@ inline void AVX2::ushort_v::gatherImplementation(const MT *mem, IT &&indexes)
                               mem[indexes[12]], mem[indexes[13]], mem[indexes[14]],
                               mem[indexes[15]]);
 }
+
+template <>
+template <typename MT, typename IT>
+inline void AVX2::llong_v::gatherImplementation(const MT *mem, IT &&indexes)
+{
+    d.v() = _mm256_setr_epi64x(mem[indexes[0]], mem[indexes[1]], mem[indexes[2]],
+                               mem[indexes[3]]);
+}
+
+template <>
+template <typename MT, typename IT>
+inline void AVX2::ullong_v::gatherImplementation(const MT *mem, IT &&indexes)
+{
+    d.v() = _mm256_setr_epi64x(mem[indexes[0]], mem[indexes[1]], mem[indexes[2]],
+                               mem[indexes[3]]);
+}
 #endif
 
 template <typename T>
@@ -873,23 +997,122 @@ Vc_INTRINSIC Vc_PURE AVX2::ushort_v AVX2::ushort_v::operator[](
         AVX::avx_cast<__m256d>(Mem::permuteHi<X7, X6, X5, X4>(d.v())),
         AVX::avx_cast<__m256d>(Mem::permuteLo<X3, X2, X1, X0>(d.v())))));
 }
+template <>
+Vc_INTRINSIC Vc_PURE AVX2::schar_v AVX2::schar_v::operator[](
+    Permutation::ReversedTag) const
+{
+    return Mem::permute128<X1, X0>(_mm256_shuffle_epi8(
+        d.v(), _mm256_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 15,
+                                14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0)));
+}
+template <>
+Vc_INTRINSIC Vc_PURE AVX2::uchar_v AVX2::uchar_v::operator[](
+    Permutation::ReversedTag) const
+{
+    return AVX2::schar_v(d.v())[Permutation::Reversed].data();
+}
+template <>
+Vc_INTRINSIC Vc_PURE AVX2::llong_v AVX2::llong_v::operator[](Permutation::ReversedTag) const
+{
+    return Mem::permute4x64<X3, X2, X1, X0>(d.v());
+}
+template <>
+Vc_INTRINSIC Vc_PURE AVX2::ullong_v AVX2::ullong_v::operator[](Permutation::ReversedTag) const
+{
+    return Mem::permute4x64<X3, X2, X1, X0>(d.v());
+}
+#endif
+
+// permute {{{1
+namespace Detail
+{
+// vpermilps/vpermilpd/vpshufb only permute within 128-bit lanes. Without a cross-lane
+// instruction the input is permuted twice, once with swapped lanes, and the second
+// result is taken where the index refers to the other lane.
+template <typename I> Vc_INTRINSIC __m256 permute(__m256 x, const I &idx)
+{
+#ifdef Vc_IMPL_AVX2
+    return _mm256_permutevar8x32_ps(x, internal_data(idx).data());
+#else
+    const __m128i lo = internal_data(internal_data0(idx)).data();
+    const __m128i hi = internal_data(internal_data1(idx)).data();
+    const __m256i i = AVX::concat(lo, hi);
+    const __m256 a = _mm256_permutevar_ps(x, i);
+    const __m256 b = _mm256_permutevar_ps(_mm256_permute2f128_ps(x, x, 1), i);
+    return _mm256_blendv_ps(
+        a, b, AVX::avx_cast<__m256>(AVX::concat(
+                  _mm_slli_epi32(lo, 29),
+                  _mm_slli_epi32(_mm_xor_si128(hi, _mm_set1_epi32(4)), 29))));
 #endif
-template <> Vc_INTRINSIC AVX2::float_v Vector<float, VectorAbi::Avx>::operator[](const IndexType &/*perm*/) const
+}
+
+template <typename I> Vc_INTRINSIC __m256d permute(__m256d x, const I &idx)
 {
-    // TODO
-    return *this;
+    const __m128i j = internal_data(idx).data();
 #ifdef Vc_IMPL_AVX2
+    // 64-bit entry j consists of the 32-bit entries 2j and 2j + 1
+    const __m256i j64 = _mm256_cvtepi32_epi64(j);
+    const __m256i ctrl =
+        _mm256_add_epi32(_mm256_or_si256(_mm256_slli_epi64(j64, 1), _mm256_slli_epi64(j64, 33)),
+                         _mm256_setr_epi32(0, 1, 0, 1, 0, 1, 0, 1));
+    return AVX::avx_cast<__m256d>(
+        _mm256_permutevar8x32_ps(AVX::avx_cast<__m256>(x), ctrl));
 #else
-    /*
-    const int_m cross128 = AVX::concat(_mm_cmpgt_epi32(AVX::lo128(perm.data()), _mm_set1_epi32(3)),
-                                  _mm_cmplt_epi32(AVX::hi128(perm.data()), _mm_set1_epi32(4)));
-    if (cross128.isNotEmpty()) {
-    AVX2::float_v x = _mm256_permutevar_ps(d.v(), perm.data());
-        x(cross128) = _mm256_permutevar_ps(Mem::permute128<X1, X0>(d.v()), perm.data());
-        return x;
-    } else {
-    */
+    const __m128i lo = _mm_cvtepi32_epi64(j);
+    const __m128i hi = _mm_cvtepi32_epi64(_mm_srli_si128(j, 8));
+    // vpermilpd reads bit 1 of the control
+    const __m256i i = AVX::concat(_mm_slli_epi64(lo, 1), _mm_slli_epi64(hi, 1));
+    const __m256d a = _mm256_permutevar_pd(x, i);
+    const __m256d b = _mm256_permutevar_pd(_mm256_permute2f128_pd(x, x, 1), i);
+    return _mm256_blendv_pd(
+        a, b, AVX::avx_cast<__m256d>(AVX::concat(
+                  _mm_slli_epi64(lo, 62),
+                  _mm_slli_epi64(_mm_xor_si128(hi, _mm_set1_epi64x(2)), 62))));
+#endif
+}
+
+#ifdef Vc_IMPL_AVX2
+template <typename I> Vc_INTRINSIC __m256i permute(__m256i x, const I &idx)
+{
+    const __m256i j = _mm256_permute4x64_epi64(
+        _mm256_packs_epi32(internal_data(internal_data0(idx)).data(),
+                           internal_data(internal_data1(idx)).data()),
+        0xd8);
+    // byte k of 16-bit entry j is byte 2j + k; vpshufb ignores the lane bit (2j >= 16)
+    const __m256i ctrl = _mm256_add_epi8(
+        _mm256_shuffle_epi8(_mm256_slli_epi16(j, 1),
+                            _mm256_setr_epi8(0, 0, 2, 2, 4, 4, 6, 6, 8, 8, 10, 10, 12, 12,
+                                             14, 14, 0, 0, 2, 2, 4, 4, 6, 6, 8, 8, 10, 10,
+                                             12, 12, 14, 14)),
+        _mm256_set1_epi16(0x0100));
+    const __m256i a = _mm256_shuffle_epi8(x, ctrl);
+    const __m256i b = _mm256_shuffle_epi8(_mm256_permute2x128_si256(x, x, 1), ctrl);
+    const __m256i other = _mm256_srai_epi16(
+        _mm256_slli_epi16(
+            _mm256_xor_si256(j, _mm256_setr_epi16(0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 8, 8, 8,
+                                                  8, 8, 8)),
+            12),
+        15);
+    return _mm256_blendv_epi8(a, b, other);
+}
 #endif
+}  // namespace Detail
+
+template <typename T>
+Vc_INTRINSIC Vc_PURE Vector<T, VectorAbi::Avx> Vector<T, VectorAbi::Avx>::permute(
+    const IndexType &idx) const
+{
+    using R = typename std::conditional<
+        sizeof(T) == 8, __m256d,
+        typename std::conditional<sizeof(T) == 4, __m256, __m256i>::type>::type;
+    return AVX::avx_cast<VectorType>(Detail::permute(AVX::avx_cast<R>(data()), idx));
+}
+
+template <typename T>
+Vc_INTRINSIC Vc_PURE Vector<T, VectorAbi::Avx> Vector<T, VectorAbi::Avx>::operator[](
+    const IndexType &perm) const
+{
+    return permute(perm);
 }
 
 // reversed {{{1
@@ -51,6 +51,20 @@ namespace AVX
 
             template<typename Flags> static Vc_ALWAYS_INLINE void store(float *mem, VTArg x, VTArg m, typename std::enable_if<!Flags::IsStreaming, void *>::type = nullptr) { _mm256_maskstore(mem, m, x); }
             template<typename Flags> static Vc_ALWAYS_INLINE void store(float *mem, VTArg x, VTArg m, typename std::enable_if< Flags::IsStreaming, void *>::type = nullptr) { AvxIntrinsics::stream_store(mem, x, m); }
+
+            // converting stores to binary16
+            template<typename Flags> static Vc_ALWAYS_INLINE void store(half *mem, VTArg x) { _mm_storeu_si128(reinterpret_cast<__m128i *>(mem), cvtps_ph(x)); }
+            template<typename Flags> static Vc_ALWAYS_INLINE void store(half *mem, VTArg x, VTArg m) { _mm_maskmoveu_si128(cvtps_ph(x), _mm_packs_epi32(lo128(_mm256_castps_si256(m)), hi128(_mm256_castps_si256(m))), reinterpret_cast<char *>(mem)); }
+            template<typename Flags> static Vc_ALWAYS_INLINE void store(bfloat16 *mem, VTArg x) { _mm_storeu_si128(reinterpret_cast<__m128i *>(mem), cvtps_bf16(x)); }
+            template<typename Flags> static Vc_ALWAYS_INLINE void store(bfloat16 *mem, VTArg x, VTArg m) { _mm_maskmoveu_si128(cvtps_bf16(x), _mm_packs_epi32(lo128(_mm256_castps_si256(m)), hi128(_mm256_castps_si256(m))), reinterpret_cast<char *>(mem)); }
+
+            // converting stores to 8-bit integers (truncating, saturating)
+            static Vc_ALWAYS_INLINE __m128i packs_epi16(VTArg x) { const __m256i tmp = _mm256_cvttps_epi32(x); return _mm_packs_epi32(lo128(tmp), hi128(tmp)); }
+            static Vc_ALWAYS_INLINE __m128i mask_epi8(VTArg m) { const __m128i tmp = _mm_packs_epi32(lo128(_mm256_castps_si256(m)), hi128(_mm256_castps_si256(m))); return _mm_packs_epi16(tmp, _mm_setzero_si128()); }
+            template<typename Flags> static Vc_ALWAYS_INLINE void store(schar *mem, VTArg x) { _mm_storel_epi64(reinterpret_cast<__m128i *>(mem), _mm_packs_epi16(packs_epi16(x), packs_epi16(x))); }
+            template<typename Flags> static Vc_ALWAYS_INLINE void store(uchar *mem, VTArg x) { _mm_storel_epi64(reinterpret_cast<__m128i *>(mem), _mm_packus_epi16(packs_epi16(x), packs_epi16(x))); }
+            template<typename Flags> static Vc_ALWAYS_INLINE void store(schar *mem, VTArg x, VTArg m) { _mm_maskmoveu_si128(_mm_packs_epi16(packs_epi16(x), _mm_setzero_si128()), mask_epi8(m), reinterpret_cast<char *>(mem)); }
+            template<typename Flags> static Vc_ALWAYS_INLINE void store(uchar *mem, VTArg x, VTArg m) { _mm_maskmoveu_si128(_mm_packus_epi16(packs_epi16(x), _mm_setzero_si128()), mask_epi8(m), reinterpret_cast<char *>(mem)); }
         };
 
         template<> struct VectorHelper<__m256d>
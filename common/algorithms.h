@@ -28,6 +28,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifndef VC_COMMON_ALGORITHMS_H_
 #define VC_COMMON_ALGORITHMS_H_
 
+#include <algorithm>
+#include <iterator>
 #include "macros.h"
 
 namespace Vc_VERSIONED_NAMESPACE
@@ -205,6 +207,277 @@ simd_for_each_n(InputIt first, std::size_t count, UnaryFunction f)
 }
 #endif
 
+///////////////////////////////////////////////////////////////////////////////
+// stream filtering {{{1
+/**
+ * \ingroup Utilities
+ *
+ * Copies the entries in [\p first, \p last) for which \p pred is \c true to the range
+ * starting at \p d_first, preserving their order. Returns the end of the destination
+ * range.
+ *
+ * The predicate is called with `Vector<T>` objects and returns the corresponding mask.
+ * The fewer than `Vector<T>::Size` entries at the end are passed as `Scalar::Vector<T>`,
+ * so \p pred must accept both (e.g. a generic lambda):
+ * \code
+ * auto end = Vc::simd_copy_if(in.begin(), in.end(), out.begin(),
+ *                             [](auto x) { return x > 0.f; });
+ * \endcode
+ *
+ * The selected entries are compacted with Vector::compressStore. \p InputIt must be a
+ * contiguous iterator. Only complete vectors (and the final remainder) are written to
+ * \p d_first, so the destination needs room only for the copied entries.
+ */
+template <typename InputIt, typename OutputIt, typename UnaryPredicate>
+inline enable_if<
+    std::is_arithmetic<typename std::iterator_traits<InputIt>::value_type>::value,
+    OutputIt>
+simd_copy_if(InputIt first, InputIt last, OutputIt d_first, UnaryPredicate pred)
+{
+    typedef typename std::iterator_traits<InputIt>::value_type T;
+    typedef Vector<T> V;
+    typedef Scalar::Vector<T> V1;
+    // compressStore writes a full vector, thus the survivors are collected in buf and
+    // only leave it one complete vector at a time
+    T buf[2 * V::Size] = {};
+    std::size_t n = 0;
+    for (; last - first >= std::ptrdiff_t(V::Size); first += V::Size) {
+        const V x(std::addressof(*first), Vc::Unaligned);
+        n += x.compressStore(&buf[n], pred(x));
+        if (n >= V::Size) {
+            d_first = std::copy(&buf[0], &buf[V::Size], d_first);
+            V(&buf[V::Size], Vc::Unaligned).store(&buf[0], Vc::Unaligned);
+            n -= V::Size;
+        }
+    }
+    for (; first != last; ++first) {
+        if (all_of(pred(V1(*first)))) {
+            buf[n++] = *first;
+        }
+    }
+    return std::copy(&buf[0], &buf[n], d_first);
+}
+
+template <typename InputIt, typename OutputIt, typename UnaryPredicate>
+inline enable_if<
+    !std::is_arithmetic<typename std::iterator_traits<InputIt>::value_type>::value,
+    OutputIt>
+simd_copy_if(InputIt first, InputIt last, OutputIt d_first, UnaryPredicate pred)
+{
+    return std::copy_if(first, last, d_first, std::move(pred));
+}
+
+/**
+ * \ingroup Utilities
+ *
+ * Removes the entries in [\p first, \p last) for which \p pred is \c true, preserving the
+ * order of the remaining entries. Returns the new end of the range; the entries after it
+ * have unspecified values.
+ *
+ * \p pred is called as for simd_copy_if. \p ForwardIt must be a contiguous iterator.
+ */
+template <typename ForwardIt, typename UnaryPredicate>
+inline enable_if<
+    std::is_arithmetic<typename std::iterator_traits<ForwardIt>::value_type>::value,
+    ForwardIt>
+simd_remove_if(ForwardIt first, ForwardIt last, UnaryPredicate pred)
+{
+    typedef typename std::iterator_traits<ForwardIt>::value_type T;
+    typedef Vector<T> V;
+    typedef Scalar::Vector<T> V1;
+    // the output never overtakes the input, so the full vector written by compressStore
+    // only touches entries that have already been loaded
+    ForwardIt out = first;
+    for (; last - first >= std::ptrdiff_t(V::Size); first += V::Size) {
+        const V x(std::addressof(*first), Vc::Unaligned);
+        out += x.compressStore(std::addressof(*out), !pred(x));
+    }
+    for (; first != last; ++first) {
+        if (!all_of(pred(V1(*first)))) {
+            *out = *first;
+            ++out;
+        }
+    }
+    return out;
+}
+
+template <typename ForwardIt, typename UnaryPredicate>
+inline enable_if<
+    !std::is_arithmetic<typename std::iterator_traits<ForwardIt>::value_type>::value,
+    ForwardIt>
+simd_remove_if(ForwardIt first, ForwardIt last, UnaryPredicate pred)
+{
+    return std::remove_if(first, last, std::move(pred));
+}
+
+/**
+ * \ingroup Utilities
+ *
+ * Reorders the entries in [\p first, \p last) such that all entries for which \p pred is
+ * \c true precede the ones for which it is \c false. Returns the first entry of the
+ * second group. Like std::partition the relative order is not preserved.
+ *
+ * \p pred is called as for simd_copy_if. \p BidirIt must be a contiguous iterator.
+ */
+template <typename BidirIt, typename UnaryPredicate>
+inline enable_if<
+    std::is_arithmetic<typename std::iterator_traits<BidirIt>::value_type>::value,
+    BidirIt>
+simd_partition(BidirIt first, BidirIt last, UnaryPredicate pred)
+{
+    typedef typename std::iterator_traits<BidirIt>::value_type T;
+    typedef Vector<T> V;
+    typedef Scalar::Vector<T> V1;
+    constexpr std::ptrdiff_t Size = V::Size;
+    if (last - first < 2 * Size) {
+        return std::partition(first, last,
+                              [&](const T &x) { return all_of(pred(V1(x))); });
+    }
+    T *const begin = std::addressof(*first);
+    T *readL = begin + Size;
+    T *readR = begin + (last - first) - Size;
+    T *writeL = begin;
+    T *writeR = readR + Size;
+
+    // The first and the last vector are held in registers. Thus there always are 2 * Size
+    // entries between the write and read positions that may be overwritten, split
+    // between the two sides. Loading from the side with less room keeps at least Size
+    // entries on both sides, which is what the full-vector stores need.
+    const V head(begin, Vc::Unaligned);
+    const V tail(readR, Vc::Unaligned);
+    T buf[2 * Size] = {};
+    while (readR - readL >= Size) {
+        V x;
+        if (readL - writeL <= Size) {
+            x.load(readL, Vc::Unaligned);
+            readL += Size;
+        } else {
+            readR -= Size;
+            x.load(readR, Vc::Unaligned);
+        }
+        const auto k = pred(x);
+        const std::ptrdiff_t nFalse = Size - k.count();
+        writeL += x.compressStore(writeL, k);
+        // move the other entries to the end of a vector, which then ends at writeR
+        x.compressStore(&buf[Size - nFalse], !k);
+        writeR -= Size;
+        V(&buf[0], Vc::Unaligned).store(writeR, Vc::Unaligned);
+        writeR += Size - nFalse;
+    }
+
+    // The remaining entries exactly fill [writeL, writeR). They are collected in local
+    // buffers first, since full-vector stores no longer fit.
+    T trues[3 * Size], falses[3 * Size];
+    std::size_t nTrue = 0, nFalse = 0;
+    for (const V &x : {head, tail}) {
+        const auto k = pred(x);
+        nTrue += x.compressStore(&trues[nTrue], k);
+        nFalse += x.compressStore(&falses[nFalse], !k);
+    }
+    for (; readL != readR; ++readL) {
+        if (all_of(pred(V1(*readL)))) {
+            trues[nTrue++] = *readL;
+        } else {
+            falses[nFalse++] = *readL;
+        }
+    }
+    writeL = std::copy(&trues[0], &trues[nTrue], writeL);
+    std::copy(&falses[0], &falses[nFalse], writeL);
+    return first + (writeL - begin);
+}
+
+template <typename BidirIt, typename UnaryPredicate>
+inline enable_if<
+    !std::is_arithmetic<typename std::iterator_traits<BidirIt>::value_type>::value,
+    BidirIt>
+simd_partition(BidirIt first, BidirIt last, UnaryPredicate pred)
+{
+    return std::partition(first, last, std::move(pred));
+}
+
+/**
+ * \ingroup Utilities
+ *
+ * Drives an iterative kernel with divergent iteration counts over the work items
+ * `0, 1, ..., n - 1` such that all lanes of \p V stay busy.
+ *
+ * A plain vectorized loop like `while (any_of(!done)) { ... }` runs until its slowest
+ * lane has finished. Instead, simd_iterate_until retires lanes as soon as they are done
+ * and refills them with the next work items from the queue. The per-lane variables live
+ * in \p state, which the three functors access:
+ * \li `init(state, idx, mask)` initializes the lanes selected by \p mask for the work
+ *     items \p idx (of type `V::IndexType`). The other lanes must be left untouched, i.e.
+ *     use masked assignment or masked gathers.
+ * \li `step(state)` executes one iteration on all lanes and returns the `V::Mask` of the
+ *     lanes that have finished. Lanes without a work item (after the queue has run dry)
+ *     are computed as well, but their results are ignored.
+ * \li `retire(state, idx, mask)` stores the results of the lanes selected by \p mask,
+ *     usually with a masked scatter to \p idx.
+ *
+ * \code
+ * struct State { float_v zr, zi, cr, ci; float_v::IndexType n; };
+ * State s;
+ * Vc::simd_iterate_until<float_v>(
+ *     count, s,
+ *     [&](State &s, float_v::IndexType idx, float_m k) {
+ *         s.cr.gather(re, idx, k);
+ *         s.ci.gather(im, idx, k);
+ *         s.zr(k) = 0.f;
+ *         s.zi(k) = 0.f;
+ *         s.n(simd_cast<float_v::IndexType::mask_type>(k)) = 0;
+ *     },
+ *     [&](State &s) {
+ *         const float_v zr = s.zr * s.zr - s.zi * s.zi + s.cr;
+ *         s.zi = 2.f * s.zr * s.zi + s.ci;
+ *         s.zr = zr;
+ *         s.n += 1;
+ *         return s.zr * s.zr + s.zi * s.zi > 4.f ||
+ *                simd_cast<float_m>(s.n >= maxIterations);
+ *     },
+ *     [&](const State &s, float_v::IndexType idx, float_m k) {
+ *         s.n.scatter(iterations, idx, simd_cast<float_v::IndexType::mask_type>(k));
+ *     });
+ * \endcode
+ *
+ * The new work items are distributed to the free lanes with an expand load; the work item
+ * indexes must fit into \c int.
+ */
+template <typename V, typename State, typename Init, typename Step, typename Retire>
+inline void simd_iterate_until(std::size_t n, State &state, Init &&init, Step &&step,
+                               Retire &&retire)
+{
+    typedef typename V::IndexType IV;
+    typedef typename V::Mask M;
+    typedef typename IV::mask_type IM;
+    IV idx = IV::Zero();
+    M active(false);
+    std::size_t next = 0;
+    for (;;) {
+        if (next < n && !all_of(active)) {
+            // hand out the next work items to the free lanes, in lane order
+            int queue[IV::Size];
+            (IV::IndexesFromZero() + int(next)).store(&queue[0], Vc::Unaligned);
+            const IM free = simd_cast<IM>(!active);
+            const IV fresh = IV::expandLoad(&queue[0], free);
+            const IM take = free && fresh < int(n);
+            idx(take) = fresh;
+            const M refill = simd_cast<M>(take);
+            init(state, static_cast<const IV &>(idx), refill);
+            active |= refill;
+            next += refill.count();
+        }
+        if (none_of(active)) {
+            return;
+        }
+        const M done = active && step(state);
+        if (any_of(done)) {
+            retire(static_cast<const State &>(state), static_cast<const IV &>(idx), done);
+            active = active && !done;
+        }
+    }
+}
+//}}}1
+
 }  // namespace Vc
 
 #endif // VC_COMMON_ALGORITHMS_H_
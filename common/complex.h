@@ -0,0 +1,353 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_COMPLEX_H_
+#define VC_COMMON_COMPLEX_H_
+
+#include <complex>
+#include <cstddef>
+#include <Vc/type_traits>
+#include "polynomial.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+/**\internal
+ * `sqrt(x * x + y * y)` without intermediate overflow or underflow.
+ */
+template <typename V> Vc_INTRINSIC V hypot(const V &x, const V &y)
+{
+    const V ax = abs(x), ay = abs(y);
+    const V hi = max(ax, ay), lo = min(ax, ay);
+    V r = lo / hi;
+    r = hi * sqrt(muladd(r, r, V::One()));
+    r(hi == V::Zero()) = V::Zero();
+    r(isinf(hi)) = hi;
+    return r;
+}
+
+/**\internal
+ * Loads \p re and \p im from `V::Size` interleaved (re, im) pairs at \p mem, using the
+ * deinterleave implementation of the backend. SimdArray arguments recurse into their
+ * storage.
+ */
+template <typename T, typename V>
+Vc_INTRINSIC enable_if<!Traits::isSimdArray<V>::value, void> deinterleaveComplex(
+    const T *mem, V &re, V &im)
+{
+    Detail::deinterleave(re, im, mem, Vc::Unaligned);
+}
+template <typename T, std::size_t N, typename V>
+Vc_INTRINSIC void deinterleaveComplex(const T *mem, SimdArray<T, N, V, N> &re,
+                                      SimdArray<T, N, V, N> &im)
+{
+    deinterleaveComplex(mem, internal_data(re), internal_data(im));
+}
+template <typename T, std::size_t N, typename V, std::size_t VN>
+Vc_INTRINSIC enable_if<(N != VN), void> deinterleaveComplex(const T *mem,
+                                                            SimdArray<T, N, V, VN> &re,
+                                                            SimdArray<T, N, V, VN> &im)
+{
+    deinterleaveComplex(mem, internal_data0(re), internal_data0(im));
+    deinterleaveComplex(mem + 2 * SimdArrayTraits<T, N>::N0, internal_data1(re),
+                        internal_data1(im));
+}
+
+/**\internal
+ * The inverse of deinterleaveComplex: interleaves \p re and \p im in registers and
+ * stores the result with two (unaligned) vector stores.
+ */
+template <typename T, typename V>
+Vc_INTRINSIC enable_if<!Traits::isSimdArray<V>::value, void> interleaveComplex(
+    T *mem, const V &re, const V &im)
+{
+    re.interleaveLow(im).store(mem, Vc::Unaligned);
+    re.interleaveHigh(im).store(mem + V::Size, Vc::Unaligned);
+}
+template <typename T, std::size_t N, typename V>
+Vc_INTRINSIC void interleaveComplex(T *mem, const SimdArray<T, N, V, N> &re,
+                                    const SimdArray<T, N, V, N> &im)
+{
+    interleaveComplex(mem, internal_data(re), internal_data(im));
+}
+template <typename T, std::size_t N, typename V, std::size_t VN>
+Vc_INTRINSIC enable_if<(N != VN), void> interleaveComplex(
+    T *mem, const SimdArray<T, N, V, VN> &re, const SimdArray<T, N, V, VN> &im)
+{
+    interleaveComplex(mem, internal_data0(re), internal_data0(im));
+    interleaveComplex(mem + 2 * SimdArrayTraits<T, N>::N0, internal_data1(re),
+                      internal_data1(im));
+}
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ *
+ * A vector of `V::size()` complex numbers in structure-of-arrays layout: the real and
+ * the imaginary parts are stored in separate vectors, so that complex arithmetic needs
+ * no shuffles. load() and store() convert from and to arrays of `std::complex<T>` with
+ * the deinterleave implementation of the backend and interleaveLow/interleaveHigh, i.e.
+ * with vector loads and stores and in-register shuffles only.
+ *
+ * \p V can be any floating-point Vc::Vector or Vc::SimdArray type. The multiplications
+ * use FMA instructions where available. Like `std::complex`, division and norm() do not
+ * guard against intermediate overflow; abs() does.
+ *
+ * \code
+ * for (std::size_t i = 0; i < n; i += float_v::size()) {
+ *     Vc::complex<float_v> z(&samples[i]);  // std::complex<float> *samples
+ *     z *= Vc::polar(float_v::One(), phase);
+ *     z.store(&samples[i]);
+ * }
+ * \endcode
+ */
+template <typename V> class complex
+{
+    static_assert(Traits::is_simd_vector<V>::value &&
+                      std::is_floating_point<typename V::EntryType>::value,
+                  "Vc::complex requires a floating-point Vc::Vector or Vc::SimdArray");
+
+public:
+    using value_type = V;
+    using EntryType = typename V::EntryType;
+    using MaskType = typename V::MaskType;
+
+    /// The number of complex numbers in the vector.
+    static constexpr std::size_t size() { return V::size(); }
+
+    /// Initializes all entries to zero.
+    Vc_INTRINSIC complex() : m_real(V::Zero()), m_imag(V::Zero()) {}
+    /// Initializes the entries with the real parts \p re and the imaginary parts \p im.
+    Vc_INTRINSIC complex(const V &re, const V &im = V::Zero()) : m_real(re), m_imag(im) {}
+    /// Broadcasts \p z to all entries.
+    Vc_INTRINSIC complex(const std::complex<EntryType> &z)
+        : m_real(z.real()), m_imag(z.imag())
+    {
+    }
+    /// Loads `size()` consecutive complex numbers from \p mem.
+    explicit Vc_INTRINSIC complex(const std::complex<EntryType> *mem) { load(mem); }
+
+    /// Loads `size()` consecutive complex numbers from \p mem, which need not be aligned.
+    Vc_INTRINSIC void load(const std::complex<EntryType> *mem)
+    {
+        Detail::deinterleaveComplex(reinterpret_cast<const EntryType *>(mem), m_real,
+                                    m_imag);
+    }
+    /// Stores the entries to `size()` consecutive complex numbers at \p mem.
+    Vc_INTRINSIC void store(std::complex<EntryType> *mem) const
+    {
+        Detail::interleaveComplex(reinterpret_cast<EntryType *>(mem), m_real, m_imag);
+    }
+
+    /// Returns the real parts.
+    Vc_INTRINSIC const V &real() const { return m_real; }
+    /// Returns the imaginary parts.
+    Vc_INTRINSIC const V &imag() const { return m_imag; }
+    /// Sets the real parts to \p re.
+    Vc_INTRINSIC void real(const V &re) { m_real = re; }
+    /// Sets the imaginary parts to \p im.
+    Vc_INTRINSIC void imag(const V &im) { m_imag = im; }
+
+    /// Returns the complex number in lane \p i.
+    Vc_INTRINSIC std::complex<EntryType> operator[](std::size_t i) const
+    {
+        return {m_real[i], m_imag[i]};
+    }
+
+    Vc_INTRINSIC complex &operator+=(const complex &z)
+    {
+        m_real += z.m_real;
+        m_imag += z.m_imag;
+        return *this;
+    }
+    Vc_INTRINSIC complex &operator-=(const complex &z)
+    {
+        m_real -= z.m_real;
+        m_imag -= z.m_imag;
+        return *this;
+    }
+    Vc_INTRINSIC complex &operator*=(const complex &z)
+    {
+        const V re = Detail::muladd(m_real, z.m_real, -(m_imag * z.m_imag));
+        m_imag = Detail::muladd(m_real, z.m_imag, m_imag * z.m_real);
+        m_real = re;
+        return *this;
+    }
+    Vc_INTRINSIC complex &operator/=(const complex &z)
+    {
+        const V scale =
+            V::One() / Detail::muladd(z.m_real, z.m_real, z.m_imag * z.m_imag);
+        const V re = Detail::muladd(m_real, z.m_real, m_imag * z.m_imag);
+        m_imag = Detail::muladd(m_imag, z.m_real, -(m_real * z.m_imag)) * scale;
+        m_real = re * scale;
+        return *this;
+    }
+
+    Vc_INTRINSIC complex &operator+=(const V &x)
+    {
+        m_real += x;
+        return *this;
+    }
+    Vc_INTRINSIC complex &operator-=(const V &x)
+    {
+        m_real -= x;
+        return *this;
+    }
+    Vc_INTRINSIC complex &operator*=(const V &x)
+    {
+        m_real *= x;
+        m_imag *= x;
+        return *this;
+    }
+    Vc_INTRINSIC complex &operator/=(const V &x)
+    {
+        const V scale = V::One() / x;
+        m_real *= scale;
+        m_imag *= scale;
+        return *this;
+    }
+
+private:
+    V m_real, m_imag;
+};
+
+// arithmetic operators {{{1
+template <typename V> Vc_INTRINSIC complex<V> operator+(const complex<V> &z)
+{
+    return z;
+}
+template <typename V> Vc_INTRINSIC complex<V> operator-(const complex<V> &z)
+{
+    return {-z.real(), -z.imag()};
+}
+
+#define Vc_COMPLEX_OPERATOR_(op_)                                                        \
+    template <typename V>                                                                \
+    Vc_INTRINSIC complex<V> operator op_(complex<V> a, const complex<V> &b)              \
+    {                                                                                    \
+        return a op_## = b;                                                              \
+    }                                                                                    \
+    template <typename V>                                                                \
+    Vc_INTRINSIC complex<V> operator op_(complex<V> a, const V &b)                       \
+    {                                                                                    \
+        return a op_## = b;                                                              \
+    }                                                                                    \
+    template <typename V>                                                                \
+    Vc_INTRINSIC complex<V> operator op_(const V &a, const complex<V> &b)                \
+    {                                                                                    \
+        return complex<V>(a) op_## = b;                                                  \
+    }
+Vc_COMPLEX_OPERATOR_(+)
+Vc_COMPLEX_OPERATOR_(-)
+Vc_COMPLEX_OPERATOR_(*)
+Vc_COMPLEX_OPERATOR_(/)
+#undef Vc_COMPLEX_OPERATOR_
+
+template <typename V>
+Vc_INTRINSIC typename V::MaskType operator==(const complex<V> &a, const complex<V> &b)
+{
+    return a.real() == b.real() && a.imag() == b.imag();
+}
+template <typename V>
+Vc_INTRINSIC typename V::MaskType operator!=(const complex<V> &a, const complex<V> &b)
+{
+    return a.real() != b.real() || a.imag() != b.imag();
+}
+
+/**
+ * \ingroup Utilities
+ * Returns `a * b + c`, with FMA instructions where available.
+ */
+template <typename V>
+Vc_INTRINSIC complex<V> fma(const complex<V> &a, const complex<V> &b,
+                            const complex<V> &c)
+{
+    return {Detail::muladd(a.real(), b.real(),
+                           Detail::muladd(-a.imag(), b.imag(), c.real())),
+            Detail::muladd(a.real(), b.imag(),
+                           Detail::muladd(a.imag(), b.real(), c.imag()))};
+}
+
+// functions {{{1
+/// \ingroup Utilities
+/// Returns the real parts of \p z.
+template <typename V> Vc_INTRINSIC V real(const complex<V> &z) { return z.real(); }
+/// \ingroup Utilities
+/// Returns the imaginary parts of \p z.
+template <typename V> Vc_INTRINSIC V imag(const complex<V> &z) { return z.imag(); }
+
+/// \ingroup Utilities
+/// Returns the complex conjugates of \p z.
+template <typename V> Vc_INTRINSIC complex<V> conj(const complex<V> &z)
+{
+    return {z.real(), -z.imag()};
+}
+
+/// \ingroup Utilities
+/// Returns the squared magnitudes of \p z.
+template <typename V> Vc_INTRINSIC V norm(const complex<V> &z)
+{
+    return Detail::muladd(z.real(), z.real(), z.imag() * z.imag());
+}
+
+/// \ingroup Utilities
+/// Returns the magnitudes of \p z, without overflow for large parts.
+template <typename V> Vc_INTRINSIC V abs(const complex<V> &z)
+{
+    return Detail::hypot(z.real(), z.imag());
+}
+
+/// \ingroup Utilities
+/// Returns the phase angles of \p z in the range [-π, π].
+template <typename V> Vc_INTRINSIC V arg(const complex<V> &z)
+{
+    return atan2(z.imag(), z.real());
+}
+
+/// \ingroup Utilities
+/// Returns the complex numbers with magnitudes \p rho and phase angles \p theta.
+template <typename V> Vc_INTRINSIC complex<V> polar(const V &rho, const V &theta)
+{
+    V s, c;
+    sincos(theta, &s, &c);
+    return {rho * c, rho * s};
+}
+
+/// \ingroup Utilities
+/// Returns `e` raised to the powers \p z.
+template <typename V> Vc_INTRINSIC complex<V> exp(const complex<V> &z)
+{
+    return polar(exp(z.real()), z.imag());
+}
+//}}}1
+}  // namespace Vc
+
+#endif  // VC_COMMON_COMPLEX_H_
+
+// vim: foldmethod=marker
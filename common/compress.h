@@ -0,0 +1,137 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2016 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#ifndef VC_COMMON_COMPRESS_H_
+#define VC_COMMON_COMPRESS_H_
+
+#include "indexsequence.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Common
+{
+// source entries {{{1
+/**\internal
+ * Returns the index of the \p k-th (counting from 0) set bit in \p bits, or -1 if \p bits
+ * has less than \p k + 1 bits set.
+ */
+constexpr int nth_set_bit(unsigned int bits, int k, int i = 0)
+{
+    return i >= 16 ? -1 : ((bits >> i) & 1u) == 0 ? nth_set_bit(bits, k, i + 1)
+                          : k == 0 ? i : nth_set_bit(bits, k - 1, i + 1);
+}
+
+/**\internal
+ * Returns the number of set bits in \p bits below bit \p i.
+ */
+constexpr int popcount_below(unsigned int bits, int i)
+{
+    return i == 0 ? 0 : int((bits >> (i - 1)) & 1u) + popcount_below(bits, i - 1);
+}
+
+/**\internal
+ * Returns the entry of the input that entry \p i of the result of a compress (\p Expand =
+ * false) or expand (\p Expand = true) with the mask \p bits reads from. Entries without
+ * a source return -1.
+ */
+template <bool Expand> constexpr int compress_source(unsigned int bits, int i)
+{
+    return Expand ? (((bits >> i) & 1u) ? popcount_below(bits, i) : -1)
+                  : nth_set_bit(bits, i);
+}
+
+// ByteShuffleTable {{{1
+/**\internal
+ * One pshufb control vector. Bytes without a source are 0x80, which makes pshufb write
+ * zero.
+ */
+struct alignas(16) ByteShuffle
+{
+    unsigned char bytes[16];
+};
+
+template <std::size_t EntrySize, bool Expand, std::size_t... J>
+constexpr ByteShuffle make_byte_shuffle(unsigned int bits, index_sequence<J...>)
+{
+    return {{static_cast<unsigned char>(
+        compress_source<Expand>(bits, J / EntrySize) < 0
+            ? 0x80
+            : compress_source<Expand>(bits, J / EntrySize) * EntrySize +
+                  J % EntrySize)...}};
+}
+
+/**\internal
+ * The byte shuffles that compress (or expand) a 16-byte vector with entries of \p
+ * EntrySize bytes, indexed with the bitmask of the selecting mask. The tables are built
+ * at compile time; the largest one (2-byte entries) has 256 rows.
+ */
+template <std::size_t EntrySize, bool Expand,
+          typename = make_index_sequence<(1u << (16 / EntrySize))>>
+struct ByteShuffleTable;
+template <std::size_t EntrySize, bool Expand, std::size_t... Bits>
+struct ByteShuffleTable<EntrySize, Expand, index_sequence<Bits...>>
+{
+    static const ByteShuffle data[sizeof...(Bits)];
+};
+template <std::size_t EntrySize, bool Expand, std::size_t... Bits>
+const ByteShuffle
+    ByteShuffleTable<EntrySize, Expand, index_sequence<Bits...>>::data[sizeof...(Bits)] = {
+        make_byte_shuffle<EntrySize, Expand>(Bits, make_index_sequence<16>())...};
+
+// LanePermuteTable {{{1
+template <bool Expand>
+constexpr unsigned int make_lane_permute(unsigned int bits, int i = 0)
+{
+    return i == 8 ? 0u : ((static_cast<unsigned int>(compress_source<Expand>(bits, i)) & 7u)
+                          << (4 * i)) |
+                             make_lane_permute<Expand>(bits, i + 1);
+}
+
+/**\internal
+ * The 32-bit lane permutations (for vpermd) that compress (or expand) a vector of eight
+ * 32-bit entries, indexed with the bitmask of the selecting mask. Each row stores the
+ * eight source lanes in consecutive nibbles. Lanes without a source read an arbitrary
+ * lane.
+ */
+template <bool Expand, typename = make_index_sequence<256>> struct LanePermuteTable;
+template <bool Expand, std::size_t... Bits>
+struct LanePermuteTable<Expand, index_sequence<Bits...>>
+{
+    alignas(64) static const unsigned int data[256];
+};
+template <bool Expand, std::size_t... Bits>
+alignas(64) const unsigned int LanePermuteTable<Expand, index_sequence<Bits...>>::data[256] = {
+    make_lane_permute<Expand>(Bits)...};
+//}}}1
+}  // namespace Common
+}  // namespace Vc
+
+#endif  // VC_COMMON_COMPRESS_H_
+
+// vim: foldmethod=marker
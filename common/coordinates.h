@@ -0,0 +1,242 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_COORDINATES_H_
+#define VC_COMMON_COORDINATES_H_
+
+#include <array>
+#include <cstddef>
+#include <Vc/type_traits>
+#include "complex.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+// Conversions between Cartesian, polar (2-D), spherical and cylindrical (3-D)
+// coordinates. Angles are in radians: the azimuth phi is measured from the x axis in
+// (-π, π], the polar angle theta of spherical coordinates from the z axis in [0, π].
+// Every conversion evaluates each atan2 and sincos only once per point and computes the
+// radii with an overflow-free hypot.
+//
+// Each conversion exists in three forms:
+// - on vectors, with points as std::array<V, N> (e.g. simdize<std::array<T, N>>),
+// - on structure-of-arrays data, with one input and one output array per component,
+// - on arrays of std::array<T, N> points, which are gathered and scattered.
+// The array forms split large inputs over OpenMP threads when compiled with OpenMP
+// support. Their output may be the same as the input.
+
+// vector kernels {{{1
+/// \ingroup Utilities
+/// Returns `{r, phi}` of the points \p p = `{x, y}`.
+template <typename V>
+Vc_INTRINSIC std::array<V, 2> cartesianToPolar(const std::array<V, 2> &p)
+{
+    return {{Detail::hypot(p[0], p[1]), atan2(p[1], p[0])}};
+}
+
+/// \ingroup Utilities
+/// Returns `{x, y}` of the points \p p = `{r, phi}`.
+template <typename V>
+Vc_INTRINSIC std::array<V, 2> polarToCartesian(const std::array<V, 2> &p)
+{
+    V s, c;
+    sincos(p[1], &s, &c);
+    return {{p[0] * c, p[0] * s}};
+}
+
+/// \ingroup Utilities
+/// Returns `{r, theta, phi}` of the points \p p = `{x, y, z}`.
+template <typename V>
+Vc_INTRINSIC std::array<V, 3> cartesianToSpherical(const std::array<V, 3> &p)
+{
+    const V rho = Detail::hypot(p[0], p[1]);
+    return {{Detail::hypot(rho, p[2]), atan2(rho, p[2]), atan2(p[1], p[0])}};
+}
+
+/// \ingroup Utilities
+/// Returns `{x, y, z}` of the points \p p = `{r, theta, phi}`.
+template <typename V>
+Vc_INTRINSIC std::array<V, 3> sphericalToCartesian(const std::array<V, 3> &p)
+{
+    V sinTheta, cosTheta, sinPhi, cosPhi;
+    sincos(p[1], &sinTheta, &cosTheta);
+    sincos(p[2], &sinPhi, &cosPhi);
+    const V rho = p[0] * sinTheta;
+    return {{rho * cosPhi, rho * sinPhi, p[0] * cosTheta}};
+}
+
+/// \ingroup Utilities
+/// Returns `{rho, phi, z}` of the points \p p = `{x, y, z}`.
+template <typename V>
+Vc_INTRINSIC std::array<V, 3> cartesianToCylindrical(const std::array<V, 3> &p)
+{
+    return {{Detail::hypot(p[0], p[1]), atan2(p[1], p[0]), p[2]}};
+}
+
+/// \ingroup Utilities
+/// Returns `{x, y, z}` of the points \p p = `{rho, phi, z}`.
+template <typename V>
+Vc_INTRINSIC std::array<V, 3> cylindricalToCartesian(const std::array<V, 3> &p)
+{
+    V s, c;
+    sincos(p[1], &s, &c);
+    return {{p[0] * c, p[0] * s, p[2]}};
+}
+
+// drivers {{{1
+namespace Detail
+{
+/**\internal
+ * Applies the vector kernel \p f to \p n points in structure-of-arrays layout. The last
+ * incomplete vector is processed on a zero-padded copy.
+ */
+template <typename T, std::size_t N, typename F>
+void transformCoordinates(const std::array<const T *, N> &in,
+                          const std::array<T *, N> &out, std::size_t n, F &&f)
+{
+    using V = Vector<T>;
+    const std::ptrdiff_t vectors = n / V::Size;
+    Vc_OMP_PRAGMA_(omp parallel for if (vectors >= 4096) schedule(static))
+    for (std::ptrdiff_t c = 0; c < vectors; ++c) {
+        const std::size_t i = c * V::Size;
+        std::array<V, N> p;
+        for (std::size_t k = 0; k < N; ++k) {
+            p[k].load(in[k] + i, Vc::Unaligned);
+        }
+        p = f(p);
+        for (std::size_t k = 0; k < N; ++k) {
+            p[k].store(out[k] + i, Vc::Unaligned);
+        }
+    }
+    const std::size_t i = vectors * V::Size;
+    if (i < n) {
+        std::array<V, N> p;
+        for (std::size_t k = 0; k < N; ++k) {
+            p[k] = V::Zero();
+            for (std::size_t j = 0; i + j < n; ++j) {
+                p[k][j] = in[k][i + j];
+            }
+        }
+        p = f(p);
+        for (std::size_t k = 0; k < N; ++k) {
+            for (std::size_t j = 0; i + j < n; ++j) {
+                out[k][i + j] = p[k][j];
+            }
+        }
+    }
+}
+
+/**\internal
+ * Applies the vector kernel \p f to \p n points stored as `std::array<T, N>`.
+ */
+template <typename T, std::size_t N, typename F>
+void transformCoordinates(const std::array<T, N> *in, std::array<T, N> *out,
+                          std::size_t n, F &&f)
+{
+    static_assert(sizeof(std::array<T, N>) == N * sizeof(T),
+                  "std::array<T, N> must not contain padding");
+    using V = Vector<T>;
+    using I = typename V::IndexType;
+    const I stride = I::IndexesFromZero() * int(N);
+    const std::ptrdiff_t vectors = n / V::Size;
+    Vc_OMP_PRAGMA_(omp parallel for if (vectors >= 4096) schedule(static))
+    for (std::ptrdiff_t c = 0; c < vectors; ++c) {
+        const T *src = in[c * V::Size].data();
+        std::array<V, N> p;
+        for (std::size_t k = 0; k < N; ++k) {
+            p[k].gather(src + k, stride);
+        }
+        p = f(p);
+        T *dst = out[c * V::Size].data();
+        for (std::size_t k = 0; k < N; ++k) {
+            p[k].scatter(dst + k, stride);
+        }
+    }
+    const std::size_t i = vectors * V::Size;
+    if (i < n) {
+        std::array<V, N> p;
+        for (std::size_t k = 0; k < N; ++k) {
+            p[k] = V::Zero();
+            for (std::size_t j = 0; i + j < n; ++j) {
+                p[k][j] = in[i + j][k];
+            }
+        }
+        p = f(p);
+        for (std::size_t k = 0; k < N; ++k) {
+            for (std::size_t j = 0; i + j < n; ++j) {
+                out[i + j][k] = p[k][j];
+            }
+        }
+    }
+}
+}  // namespace Detail
+
+// array forms {{{1
+#define Vc_COORDINATES_2D_(name_, a_, b_, c_, d_)                                        \
+    template <typename T>                                                                \
+    inline void name_(const T *a_, const T *b_, T *c_, T *d_, std::size_t n)             \
+    {                                                                                    \
+        Detail::transformCoordinates<T, 2>(                                              \
+            {{a_, b_}}, {{c_, d_}}, n,                                                   \
+            [](const std::array<Vector<T>, 2> &p) { return name_(p); });                 \
+    }                                                                                    \
+    template <typename T>                                                                \
+    inline void name_(const std::array<T, 2> *in, std::array<T, 2> *out, std::size_t n)  \
+    {                                                                                    \
+        Detail::transformCoordinates(                                                    \
+            in, out, n, [](const std::array<Vector<T>, 2> &p) { return name_(p); });     \
+    }
+#define Vc_COORDINATES_3D_(name_, a_, b_, c_, d_, e_, f_)                                \
+    template <typename T>                                                                \
+    inline void name_(const T *a_, const T *b_, const T *c_, T *d_, T *e_, T *f_,        \
+                      std::size_t n)                                                     \
+    {                                                                                    \
+        Detail::transformCoordinates<T, 3>(                                              \
+            {{a_, b_, c_}}, {{d_, e_, f_}}, n,                                           \
+            [](const std::array<Vector<T>, 3> &p) { return name_(p); });                 \
+    }                                                                                    \
+    template <typename T>                                                                \
+    inline void name_(const std::array<T, 3> *in, std::array<T, 3> *out, std::size_t n)  \
+    {                                                                                    \
+        Detail::transformCoordinates(                                                    \
+            in, out, n, [](const std::array<Vector<T>, 3> &p) { return name_(p); });     \
+    }
+
+Vc_COORDINATES_2D_(cartesianToPolar, x, y, r, phi)
+Vc_COORDINATES_2D_(polarToCartesian, r, phi, x, y)
+Vc_COORDINATES_3D_(cartesianToSpherical, x, y, z, r, theta, phi)
+Vc_COORDINATES_3D_(sphericalToCartesian, r, theta, phi, x, y, z)
+Vc_COORDINATES_3D_(cartesianToCylindrical, x, y, z, rho, phi, zOut)
+Vc_COORDINATES_3D_(cylindricalToCartesian, rho, phi, z, x, y, zOut)
+#undef Vc_COORDINATES_2D_
+#undef Vc_COORDINATES_3D_
+//}}}1
+}  // namespace Vc
+
+#endif  // VC_COMMON_COORDINATES_H_
+
+// vim: foldmethod=marker
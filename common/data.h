@@ -36,6 +36,7 @@ namespace Common
 
 alignas(64) extern unsigned int RandomState[];
 alignas(32) extern const unsigned int AllBitsSet[8];
+alignas(64) extern const double TwoOverPiBits[48];
 
 }  // namespace Common
 }  // namespace Vc
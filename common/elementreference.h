@@ -28,6 +28,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifndef VC_COMMON_ELEMENTREFERENCE_H_
 #define VC_COMMON_ELEMENTREFERENCE_H_
 
+#include "scalarization.h"
 #include "macros.h"
 
 namespace Vc_VERSIONED_NAMESPACE
@@ -39,7 +40,10 @@ template <typename U, typename Accessor = U> class ElementReference
     using value_type = typename U::value_type;
     friend U;
     friend Accessor;
-    Vc_INTRINSIC ElementReference(U &o, int i) noexcept : index(i), obj(o) {}
+    Vc_INTRINSIC ElementReference(U &o, int i) noexcept : index(i), obj(o)
+    {
+        Common::scalarized_element_access(&o);
+    }
 
     static constexpr bool get_noexcept =
         noexcept(Accessor::get(std::declval<U &>(), int()));
@@ -59,19 +59,14 @@ inline Vector<float, Abi> exp(Vector<float, Abi> x)
         // => y  = x - n * ln(2)       | recall that: ln(2) * log₂(e) == 1
         // <=> eˣ = 2ⁿ * eʸ
         V z = floor(C::log2_e() * x + 0.5f);
-        const auto n = static_cast<Vc::SimdArray<int, V::Size>>(z);
+        const auto n = static_cast<typename V::IndexType>(z);
         x -= z * C::ln2_large();
         x -= z * C::ln2_small();
 
         /* Theoretical peak relative error in [-0.5, +0.5] is 4.2e-9. */
-        z = ((((( 1.9875691500E-4f  * x
-                + 1.3981999507E-3f) * x
-                + 8.3334519073E-3f) * x
-                + 4.1665795894E-2f) * x
-                + 1.6666665459E-1f) * x
-                + 5.0000001201E-1f) * (x * x)
-                + x
-                + 1.0f;
+        const float P[] = {5.0000001201E-1f, 1.6666665459E-1f, 4.1665795894E-2f,
+                           8.3334519073E-3f, 1.3981999507E-3f, 1.9875691500E-4f};
+        z = polyvalHorner(x, P) * (x * x) + x + 1.0f;
 
         x = ldexp(z, n); // == z * 2ⁿ
 
@@ -0,0 +1,438 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_FFT_H_
+#define VC_COMMON_FFT_H_
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <vector>
+#include <Vc/Allocator>
+#include "complex.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+/**
+ * \ingroup Utilities
+ *
+ * A precomputed plan for complex discrete Fourier transforms of a power-of-two size \p n:
+ * \f[ X_k = \sum_{j=0}^{n-1} x_j e^{-2\pi i jk/n} \f]
+ *
+ * The transform is an iterative radix-2 decimation-in-time FFT on split (real and
+ * imaginary) work arrays, with:
+ * \li the bit-reversal permutation done by a gather while loading the input,
+ * \li the butterflies that combine lanes of the same vector done in registers with
+ *     shifted() and iif(), and
+ * \li the remaining stages fused pairwise into radix-4 passes, halving the passes over
+ *     memory.
+ *
+ * Interleaved `std::complex<T>` arrays and split real/imaginary arrays are supported,
+ * in place or out of place. inverse() includes the 1/n normalization, so that it
+ * reverses forward(). The plan owns the work arrays, so one plan must not execute
+ * concurrent transforms; use one plan per thread instead.
+ *
+ * \code
+ * Vc::Fft<float> fft(1024);
+ * fft.forward(signal);  // std::complex<float> signal[1024]
+ * \endcode
+ */
+template <typename T> class Fft
+{
+    static_assert(std::is_floating_point<T>::value, "Fft requires a floating-point type");
+    using V = Vector<T>;
+    using Buffer = std::vector<T, Allocator<T>>;
+
+public:
+    /// Precomputes the twiddle factors and the bit-reversal permutation for size \p n.
+    explicit Fft(std::size_t n)
+        : m_size(n), m_re(n), m_im(n), m_twiddleRe(n), m_twiddleIm(n), m_reversed(n)
+    {
+        Vc_ASSERT(n > 0 && (n & (n - 1)) == 0);
+        // the butterflies of span h use the factors exp(-iπk/h), stored at [h, 2h)
+        for (std::size_t h = 1; h < n; h *= 2) {
+            for (std::size_t k = 0; k < h; ++k) {
+                const double phi = -3.14159265358979323846 * double(k) / double(h);
+                m_twiddleRe[h + k] = T(std::cos(phi));
+                m_twiddleIm[h + k] = T(std::sin(phi));
+            }
+        }
+        std::size_t bits = 0;
+        while ((std::size_t(1) << bits) < n) {
+            ++bits;
+        }
+        for (std::size_t i = 0; i < n; ++i) {
+            std::size_t r = 0;
+            for (std::size_t b = 0; b < bits; ++b) {
+                r |= ((i >> b) & 1) << (bits - 1 - b);
+            }
+            m_reversed[i] = int(r);
+        }
+    }
+
+    /// Returns the transform size.
+    std::size_t size() const { return m_size; }
+
+    /// Transforms \p in to \p out, which may be the same array.
+    void forward(const std::complex<T> *in, std::complex<T> *out)
+    {
+        const T *mem = reinterpret_cast<const T *>(in);
+        run(mem, mem + 1, 2, false);
+        storeInterleaved(reinterpret_cast<T *>(out), false);
+    }
+    /// Transforms \p data in place.
+    void forward(std::complex<T> *data) { forward(data, data); }
+    /// Transforms the split arrays \p re, \p im to \p outRe, \p outIm, which may be the
+    /// same arrays.
+    void forward(const T *re, const T *im, T *outRe, T *outIm)
+    {
+        run(re, im, 1, false);
+        storeSplit(outRe, outIm);
+    }
+
+    /// Applies the inverse transform, including the 1/n normalization.
+    void inverse(const std::complex<T> *in, std::complex<T> *out)
+    {
+        // swapping real and imaginary parts before and after the forward transform
+        // yields the inverse transform
+        const T *mem = reinterpret_cast<const T *>(in);
+        run(mem + 1, mem, 2, true);
+        storeInterleaved(reinterpret_cast<T *>(out), true);
+    }
+    /// Applies the inverse transform in place, including the 1/n normalization.
+    void inverse(std::complex<T> *data) { inverse(data, data); }
+    /// Applies the inverse transform to split arrays, including the 1/n normalization.
+    void inverse(const T *re, const T *im, T *outRe, T *outIm)
+    {
+        run(im, re, 1, true);
+        storeSplit(outIm, outRe);
+    }
+
+private:
+    void run(const T *re, const T *im, int stride, bool scale)
+    {
+        if (m_size >= V::Size) {
+            transform<V>(re, im, stride, scale);
+        } else {
+            transform<Scalar::Vector<T>>(re, im, stride, scale);
+        }
+    }
+
+    template <typename W>
+    void transform(const T *inRe, const T *inIm, int stride, bool scale)
+    {
+        using I = typename W::IndexType;
+        const std::size_t n = m_size;
+        T *re = m_re.data();
+        T *im = m_im.data();
+        const W factor = scale ? W(T(1) / T(n)) : W::One();
+
+        for (std::size_t i = 0; i < n; i += W::Size) {
+            const I idx = I(&m_reversed[i], Vc::Aligned) * stride;
+            (W(inRe, idx) * factor).store(&re[i], Vc::Aligned);
+            (W(inIm, idx) * factor).store(&im[i], Vc::Aligned);
+        }
+        inRegisterStages<W>(re, im);
+        std::size_t h = W::Size;
+        for (; 4 * h <= n; h *= 4) {
+            radix4Pass<W>(re, im, h);
+        }
+        if (h < n) {
+            radix2Pass<W>(re, im, h);
+        }
+    }
+
+    // The stages of span h < W::Size combine lanes of one vector. Lane i of the result is
+    // u + w * v, where for the lower lane of a pair (i & h == 0) u is the lane itself
+    // and v its partner i + h, and for the upper lane u is the partner i - h and v the
+    // lane itself with the twiddle factor negated.
+    template <typename W>
+    enable_if<(W::Size > 1), void> inRegisterStages(T *re, T *im)
+    {
+        static_assert(W::Size <= 16, "more in-register stages than expected");
+        typename W::MaskType lower[4];
+        complex<W> twiddle[4];
+        for (std::size_t l = 0, h = 1; h < W::Size; ++l, h *= 2) {
+            W wRe, wIm, sel;
+            for (std::size_t i = 0; i < W::Size; ++i) {
+                const bool isLower = (i & h) == 0;
+                const T sign = isLower ? T(1) : T(-1);
+                wRe[i] = sign * m_twiddleRe[h + i % h];
+                wIm[i] = sign * m_twiddleIm[h + i % h];
+                sel[i] = isLower ? T(1) : T(0);
+            }
+            lower[l] = sel > W::Zero();
+            twiddle[l] = {wRe, wIm};
+        }
+        for (std::size_t i = 0; i < m_size; i += W::Size) {
+            W xRe(&re[i], Vc::Aligned), xIm(&im[i], Vc::Aligned);
+            for (std::size_t l = 0, h = 1; h < W::Size; ++l, h *= 2) {
+                const int s = int(h);
+                const complex<W> u(iif(lower[l], xRe, xRe.shifted(-s)),
+                                   iif(lower[l], xIm, xIm.shifted(-s)));
+                const complex<W> v(iif(lower[l], xRe.shifted(s), xRe),
+                                   iif(lower[l], xIm.shifted(s), xIm));
+                const complex<W> r = fma(twiddle[l], v, u);
+                xRe = r.real();
+                xIm = r.imag();
+            }
+            xRe.store(&re[i], Vc::Aligned);
+            xIm.store(&im[i], Vc::Aligned);
+        }
+    }
+    template <typename W>
+    enable_if<(W::Size == 1), void> inRegisterStages(T *, T *)
+    {
+    }
+
+    template <typename W> complex<W> load(const T *re, const T *im, std::size_t i) const
+    {
+        return {W(&re[i], Vc::Aligned), W(&im[i], Vc::Aligned)};
+    }
+    template <typename W>
+    static void store(T *re, T *im, std::size_t i, const complex<W> &z)
+    {
+        z.real().store(&re[i], Vc::Aligned);
+        z.imag().store(&im[i], Vc::Aligned);
+    }
+
+    // the butterflies of span h
+    template <typename W> void radix2Pass(T *re, T *im, std::size_t h)
+    {
+        for (std::size_t b = 0; b < m_size; b += 2 * h) {
+            for (std::size_t k = 0; k < h; k += W::Size) {
+                const complex<W> w =
+                    load<W>(m_twiddleRe.data(), m_twiddleIm.data(), h + k);
+                const complex<W> x0 = load<W>(re, im, b + k);
+                const complex<W> t = load<W>(re, im, b + k + h) * w;
+                store(re, im, b + k, x0 + t);
+                store(re, im, b + k + h, x0 - t);
+            }
+        }
+    }
+
+    // the butterflies of span h and 2h in one pass
+    template <typename W> void radix4Pass(T *re, T *im, std::size_t h)
+    {
+        const T *twRe = m_twiddleRe.data();
+        const T *twIm = m_twiddleIm.data();
+        for (std::size_t b = 0; b < m_size; b += 4 * h) {
+            for (std::size_t k = 0; k < h; k += W::Size) {
+                const std::size_t j = b + k;
+                const complex<W> w1 = load<W>(twRe, twIm, h + k);
+                const complex<W> x0 = load<W>(re, im, j);
+                const complex<W> x2 = load<W>(re, im, j + 2 * h);
+                const complex<W> t1 = load<W>(re, im, j + h) * w1;
+                const complex<W> t3 = load<W>(re, im, j + 3 * h) * w1;
+                const complex<W> y0 = x0 + t1, y1 = x0 - t1;
+                const complex<W> y2 = x2 + t3, y3 = x2 - t3;
+                const complex<W> t2 = y2 * load<W>(twRe, twIm, 2 * h + k);
+                const complex<W> t4 = y3 * load<W>(twRe, twIm, 3 * h + k);
+                store(re, im, j, y0 + t2);
+                store(re, im, j + h, y1 + t4);
+                store(re, im, j + 2 * h, y0 - t2);
+                store(re, im, j + 3 * h, y1 - t4);
+            }
+        }
+    }
+
+    void storeInterleaved(T *out, bool swap) const
+    {
+        const T *re = swap ? m_im.data() : m_re.data();
+        const T *im = swap ? m_re.data() : m_im.data();
+        std::size_t i = 0;
+        if (m_size >= V::Size) {
+            for (; i < m_size; i += V::Size) {
+                Detail::interleaveComplex(out + 2 * i, V(&re[i], Vc::Aligned),
+                                          V(&im[i], Vc::Aligned));
+            }
+        }
+        for (; i < m_size; ++i) {
+            out[2 * i] = re[i];
+            out[2 * i + 1] = im[i];
+        }
+    }
+
+    void storeSplit(T *outRe, T *outIm) const
+    {
+        std::copy(m_re.begin(), m_re.end(), outRe);
+        std::copy(m_im.begin(), m_im.end(), outIm);
+    }
+
+    std::size_t m_size;
+    Buffer m_re, m_im;
+    Buffer m_twiddleRe, m_twiddleIm;
+    std::vector<int, Allocator<int>> m_reversed;
+};
+
+/**
+ * \ingroup Utilities
+ *
+ * Computes the full linear convolution of \p x (\p n values) with the filter \p h (\p m
+ * values) directly:
+ * \f[ y_i = \sum_j h_j x_{i-j}, \quad 0 \le i < n + m - 1 \f]
+ * and writes the `n + m - 1` values to \p y. Each output vector is accumulated with one
+ * multiply-add per filter coefficient. For long filters FftConvolution is faster.
+ */
+template <typename T>
+void simd_convolve(const T *x, std::size_t n, const T *h, std::size_t m, T *y)
+{
+    using V = Vector<T>;
+    if (n == 0 || m == 0) {
+        return;
+    }
+    const std::size_t outSize = n + m - 1;
+    // x with m - 1 leading and m - 1 + V::Size trailing zeros, and h reversed, turn
+    // every output into a forward running dot product
+    std::vector<T, Allocator<T>> padded(outSize + m - 1 + V::Size, T(0));
+    std::copy(x, x + n, padded.begin() + (m - 1));
+    std::vector<T> reversed(h, h + m);
+    std::reverse(reversed.begin(), reversed.end());
+
+    std::size_t i = 0;
+    for (; i + V::Size <= outSize; i += V::Size) {
+        V acc = V::Zero();
+        for (std::size_t j = 0; j < m; ++j) {
+            acc = Detail::muladd(V(reversed[j]), V(&padded[i + j], Vc::Unaligned), acc);
+        }
+        acc.store(&y[i], Vc::Unaligned);
+    }
+    if (i < outSize) {
+        V acc = V::Zero();
+        for (std::size_t j = 0; j < m; ++j) {
+            acc = Detail::muladd(V(reversed[j]), V(&padded[i + j], Vc::Unaligned), acc);
+        }
+        for (std::size_t k = 0; i + k < outSize; ++k) {
+            y[i + k] = acc[k];
+        }
+    }
+}
+
+/**
+ * \ingroup Utilities
+ *
+ * Convolution with a fixed filter by the overlap-add method: the signal is cut into
+ * blocks, each block is convolved by multiplication with the precomputed spectrum of the
+ * filter, and the overlapping results are summed. Since signal and filter are real, two
+ * blocks share one complex transform, one as real and one as imaginary part.
+ *
+ * The result equals the one of simd_convolve (up to rounding) at O(log m) instead of
+ * O(m) operations per output value.
+ */
+template <typename T> class FftConvolution
+{
+    using V = Vector<T>;
+    using Buffer = std::vector<T, Allocator<T>>;
+
+    static std::size_t transformSize(std::size_t m)
+    {
+        std::size_t size = 64;
+        while (size < 4 * m) {
+            size *= 2;
+        }
+        return size;
+    }
+
+public:
+    /// Precomputes the spectrum of the filter \p h with \p m coefficients.
+    FftConvolution(const T *h, std::size_t m)
+        : m_filterSize(m)
+        , m_fft(transformSize(m))
+        , m_filterRe(m_fft.size(), T(0))
+        , m_filterIm(m_fft.size(), T(0))
+        , m_re(m_fft.size())
+        , m_im(m_fft.size())
+    {
+        Vc_ASSERT(m > 0);
+        std::copy(h, h + m, m_filterRe.begin());
+        m_fft.forward(m_filterRe.data(), m_filterIm.data(), m_filterRe.data(),
+                      m_filterIm.data());
+    }
+
+    /// Returns the number of filter coefficients.
+    std::size_t filterSize() const { return m_filterSize; }
+
+    /// Writes the `n + m - 1` values of the full convolution of \p x with the filter to
+    /// \p y.
+    void operator()(const T *x, std::size_t n, T *y)
+    {
+        const std::size_t size = m_fft.size();
+        const std::size_t block = size - m_filterSize + 1;
+        const std::size_t outSize = n + m_filterSize - 1;
+        std::fill(y, y + outSize, T(0));
+        for (std::size_t start = 0; start < n; start += 2 * block) {
+            const std::size_t len0 = std::min(block, n - start);
+            const std::size_t len1 =
+                start + block < n ? std::min(block, n - start - block) : 0;
+            std::fill(m_re.begin(), m_re.end(), T(0));
+            std::fill(m_im.begin(), m_im.end(), T(0));
+            std::copy(x + start, x + start + len0, m_re.begin());
+            std::copy(x + start + block, x + start + block + len1, m_im.begin());
+
+            m_fft.forward(m_re.data(), m_im.data(), m_re.data(), m_im.data());
+            for (std::size_t i = 0; i < size; i += V::Size) {
+                complex<V> z(V(&m_re[i], Vc::Aligned), V(&m_im[i], Vc::Aligned));
+                z *= complex<V>(V(&m_filterRe[i], Vc::Aligned),
+                                V(&m_filterIm[i], Vc::Aligned));
+                z.real().store(&m_re[i], Vc::Aligned);
+                z.imag().store(&m_im[i], Vc::Aligned);
+            }
+            m_fft.inverse(m_re.data(), m_im.data(), m_re.data(), m_im.data());
+
+            accumulate(y + start, m_re.data(), std::min(size, outSize - start));
+            if (len1 > 0) {
+                accumulate(y + start + block, m_im.data(),
+                           std::min(size, outSize - start - block));
+            }
+        }
+    }
+
+private:
+    static void accumulate(T *y, const T *partial, std::size_t count)
+    {
+        std::size_t i = 0;
+        for (; i + V::Size <= count; i += V::Size) {
+            (V(&y[i], Vc::Unaligned) + V(&partial[i], Vc::Aligned))
+                .store(&y[i], Vc::Unaligned);
+        }
+        for (; i < count; ++i) {
+            y[i] += partial[i];
+        }
+    }
+
+    std::size_t m_filterSize;
+    Fft<T> m_fft;
+    Buffer m_filterRe, m_filterIm;
+    Buffer m_re, m_im;
+};
+}  // namespace Vc
+
+#endif  // VC_COMMON_FFT_H_
+
+// vim: foldmethod=marker
@@ -0,0 +1,330 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_GEMM_H_
+#define VC_COMMON_GEMM_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <Vc/cpuid.h>
+#include "malloc.h"
+#include "polynomial.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+// GemmTraits {{{1
+/**\internal
+ * The register block of the micro-kernel: \c MR rows of A times \c NR columns of B,
+ * accumulated in `MR * 2` vector registers.
+ */
+template <typename T> struct GemmTraits {
+    using V = Vector<T>;
+    static constexpr std::size_t MR = 4;
+    static constexpr std::size_t NR = 2 * V::Size;
+};
+
+// GemmBlocking {{{1
+/**\internal
+ * The cache blocking parameters, derived from the CpuId cache sizes:
+ * \li a \c kc x \c NR panel of packed B and a \c MR x \c kc panel of packed A fill half
+ *     of the L1 data cache,
+ * \li a \c mc x \c kc block of packed A fills half of the L2 cache,
+ * \li a \c kc x \c nc block of packed B fills half of the L3 cache.
+ */
+template <typename T> struct GemmBlocking {
+    std::size_t kc, mc, nc;
+
+    GemmBlocking()
+    {
+        using Tr = GemmTraits<T>;
+        CpuId::init();
+        const std::size_t l1 = CpuId::L1Data() ? CpuId::L1Data() : 32 * 1024;
+        const std::size_t l2 = CpuId::L2Data() ? CpuId::L2Data() : 256 * 1024;
+        const std::size_t l3 = CpuId::L3Data() ? CpuId::L3Data() : 4 * 1024 * 1024;
+        kc = std::max<std::size_t>(
+            16, std::min<std::size_t>(1024, l1 / 2 / ((Tr::MR + Tr::NR) * sizeof(T))));
+        mc = std::max<std::size_t>(l2 / 2 / (kc * sizeof(T)) / Tr::MR, 1) * Tr::MR;
+        nc = std::max<std::size_t>(l3 / 2 / (kc * sizeof(T)) / Tr::NR, 1) * Tr::NR;
+    }
+
+    static const GemmBlocking &get()
+    {
+        static const GemmBlocking b;
+        return b;
+    }
+};
+
+// GemmBuffer {{{1
+/**\internal
+ * Owns a vector-aligned packing buffer for \p n entries of type \p T.
+ */
+template <typename T> class GemmBuffer
+{
+public:
+    explicit GemmBuffer(std::size_t n)
+        : m_data(static_cast<T *>(Common::malloc<AlignOnVector>(n * sizeof(T))))
+    {
+    }
+    ~GemmBuffer() { Common::free(m_data); }
+    GemmBuffer(const GemmBuffer &) = delete;
+    GemmBuffer &operator=(const GemmBuffer &) = delete;
+
+    T *get() const { return m_data; }
+
+private:
+    T *m_data;
+};
+
+// gemm_pack_a {{{1
+/**\internal
+ * Copies the \p mb x \p kb block of \p a into \p packed, scaled by \p alpha. Each strip of
+ * \c MR rows is stored column by column; rows past \p mb are filled with zeros.
+ */
+template <typename T>
+inline void gemm_pack_a(std::size_t mb, std::size_t kb, T alpha, const T *a,
+                        std::size_t lda, T *packed)
+{
+    constexpr std::size_t MR = GemmTraits<T>::MR;
+    for (std::size_t i = 0; i < mb; i += MR) {
+        const std::size_t rows = std::min(MR, mb - i);
+        for (std::size_t p = 0; p < kb; ++p) {
+            std::size_t r = 0;
+            for (; r < rows; ++r) {
+                packed[r] = alpha * a[(i + r) * lda + p];
+            }
+            for (; r < MR; ++r) {
+                packed[r] = T(0);
+            }
+            packed += MR;
+        }
+    }
+}
+
+// gemm_pack_b {{{1
+/**\internal
+ * Copies the \p kb x \p nb block of \p b starting at column \p j into the strip of \c NR
+ * columns at \p packed. Each strip is stored row by row; columns past \p nb are filled
+ * with zeros.
+ */
+template <typename T>
+inline void gemm_pack_b(std::size_t kb, std::size_t nb, std::size_t j, const T *b,
+                        std::size_t ldb, T *packed)
+{
+    using V = typename GemmTraits<T>::V;
+    constexpr std::size_t NR = GemmTraits<T>::NR;
+    const std::size_t cols = std::min(NR, nb - j);
+    b += j;
+    if (cols == NR) {
+        for (std::size_t p = 0; p < kb; ++p) {
+            V(b + p * ldb, Vc::Unaligned).store(packed, Vc::Aligned);
+            V(b + p * ldb + V::Size, Vc::Unaligned).store(packed + V::Size, Vc::Aligned);
+            packed += NR;
+        }
+    } else {
+        for (std::size_t p = 0; p < kb; ++p) {
+            std::size_t c = 0;
+            for (; c < cols; ++c) {
+                packed[c] = b[p * ldb + c];
+            }
+            for (; c < NR; ++c) {
+                packed[c] = T(0);
+            }
+            packed += NR;
+        }
+    }
+}
+
+// gemm_micro_kernel {{{1
+/**\internal
+ * Computes the \c MR x \c NR product of a packed strip of A and a packed strip of B over
+ * \p kb steps and combines it with the \p mr x \p nr tile at \p c: `c = acc + beta * c`.
+ * \p c is not read if \p beta is zero.
+ */
+template <typename T>
+Vc_ALWAYS_INLINE void gemm_micro_kernel(std::size_t kb, const T *Vc_RESTRICT a,
+                                        const T *Vc_RESTRICT b, T beta, T *c,
+                                        std::size_t ldc, std::size_t mr, std::size_t nr)
+{
+    using V = typename GemmTraits<T>::V;
+    constexpr std::size_t MR = GemmTraits<T>::MR;
+    constexpr std::size_t NR = GemmTraits<T>::NR;
+
+    V acc[MR][2];
+    for (std::size_t r = 0; r < MR; ++r) {
+        acc[r][0] = V::Zero();
+        acc[r][1] = V::Zero();
+    }
+    for (std::size_t p = 0; p < kb; ++p) {
+        const V b0(b, Vc::Aligned);
+        const V b1(b + V::Size, Vc::Aligned);
+        for (std::size_t r = 0; r < MR; ++r) {
+            const V ar = a[r];
+            acc[r][0] = muladd(ar, b0, acc[r][0]);
+            acc[r][1] = muladd(ar, b1, acc[r][1]);
+        }
+        a += MR;
+        b += NR;
+    }
+
+    if (mr == MR && nr == NR) {
+        for (std::size_t r = 0; r < MR; ++r) {
+            T *row = c + r * ldc;
+            if (beta != T(0)) {
+                acc[r][0] += beta * V(row, Vc::Unaligned);
+                acc[r][1] += beta * V(row + V::Size, Vc::Unaligned);
+            }
+            acc[r][0].store(row, Vc::Unaligned);
+            acc[r][1].store(row + V::Size, Vc::Unaligned);
+        }
+    } else {
+        alignas(V::MemoryAlignment) T tmp[MR][NR];
+        for (std::size_t r = 0; r < mr; ++r) {
+            acc[r][0].store(&tmp[r][0], Vc::Aligned);
+            acc[r][1].store(&tmp[r][V::Size], Vc::Aligned);
+            T *row = c + r * ldc;
+            for (std::size_t j = 0; j < nr; ++j) {
+                row[j] = beta != T(0) ? tmp[r][j] + beta * row[j] : tmp[r][j];
+            }
+        }
+    }
+}
+//}}}1
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ *
+ * Computes the matrix product `C = alpha * A * B + beta * C` for row-major matrices with
+ * runtime dimensions, where \c A is an \p m x \p k matrix, \c B is a \p k x \p n matrix,
+ * and \c C is an \p m x \p n matrix. The parameters follow the BLAS \c gemm convention:
+ * \p lda, \p ldb, and \p ldc are the distances (in elements) between the starts of two
+ * consecutive rows. The matrices need no alignment or padding. If \p beta is zero, \p c
+ * is not read, i.e. it may be uninitialized.
+ *
+ * The implementation packs blocks of \c A and \c B into vector-aligned buffers, sized
+ * from the CpuId cache sizes to keep the working set of the inner loops in the L1 and L2
+ * caches. The innermost kernel accumulates a tile of four rows times two Vector<T> in
+ * registers and uses fused multiply-add instructions where the target supports them.
+ * If the translation unit is compiled with OpenMP enabled, the loop over row blocks of
+ * \c A is distributed over the threads of a parallel region. For many small products it
+ * is usually more efficient to compile without OpenMP and call gemm from multiple
+ * threads instead.
+ *
+ * \code
+ * std::vector<float> a(m * k), b(k * n), c(m * n);
+ * Vc::gemm(m, n, k, 1.f, a.data(), k, b.data(), n, 0.f, c.data(), n);
+ * \endcode
+ *
+ * \tparam T Either \c float or \c double.
+ */
+template <typename T>
+inline void gemm(std::size_t m, std::size_t n, std::size_t k, T alpha, const T *a,
+                 std::size_t lda, const T *b, std::size_t ldb, T beta, T *c,
+                 std::size_t ldc)
+{
+    static_assert(std::is_floating_point<T>::value,
+                  "Vc::gemm is only implemented for float and double");
+    using Tr = Detail::GemmTraits<T>;
+    if (m == 0 || n == 0) {
+        return;
+    }
+    if (k == 0 || alpha == T(0)) {
+        for (std::size_t i = 0; i < m; ++i) {
+            for (std::size_t j = 0; j < n; ++j) {
+                c[i * ldc + j] = beta == T(0) ? T(0) : beta * c[i * ldc + j];
+            }
+        }
+        return;
+    }
+
+    const auto &blocking = Detail::GemmBlocking<T>::get();
+    const std::size_t kc = std::min(blocking.kc, k);
+    const std::size_t mc = std::min(blocking.mc, (m + Tr::MR - 1) / Tr::MR * Tr::MR);
+    const std::size_t nc = std::min(blocking.nc, (n + Tr::NR - 1) / Tr::NR * Tr::NR);
+    Detail::GemmBuffer<T> packedB(kc * nc);
+
+    Vc_OMP_PRAGMA_(omp parallel if (m * n * k >= 64 * 64 * 64 && m > mc))
+    {
+        Detail::GemmBuffer<T> packedA(mc * kc);
+        for (std::size_t jc = 0; jc < n; jc += nc) {
+            const std::size_t nb = std::min(nc, n - jc);
+            const std::ptrdiff_t nStrips = (nb + Tr::NR - 1) / Tr::NR;
+            for (std::size_t pc = 0; pc < k; pc += kc) {
+                const std::size_t kb = std::min(kc, k - pc);
+                const T betaBlock = pc == 0 ? beta : T(1);
+
+                Vc_OMP_PRAGMA_(omp for schedule(static))
+                for (std::ptrdiff_t s = 0; s < nStrips; ++s) {
+                    Detail::gemm_pack_b(kb, nb, s * Tr::NR, b + pc * ldb + jc, ldb,
+                                        packedB.get() + s * Tr::NR * kb);
+                }
+
+                const std::ptrdiff_t mBlocks = (m + mc - 1) / mc;
+                Vc_OMP_PRAGMA_(omp for schedule(dynamic))
+                for (std::ptrdiff_t blk = 0; blk < mBlocks; ++blk) {
+                    const std::size_t ic = blk * mc;
+                    const std::size_t mb = std::min(mc, m - ic);
+                    Detail::gemm_pack_a(mb, kb, alpha, a + ic * lda + pc, lda,
+                                        packedA.get());
+                    for (std::size_t jr = 0; jr < nb; jr += Tr::NR) {
+                        const T *bStrip = packedB.get() + jr * kb;
+                        for (std::size_t ir = 0; ir < mb; ir += Tr::MR) {
+                            Detail::gemm_micro_kernel(
+                                kb, packedA.get() + ir * kb, bStrip, betaBlock,
+                                c + (ic + ir) * ldc + jc + jr, ldc,
+                                std::min(Tr::MR, mb - ir), std::min(Tr::NR, nb - jr));
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+/**
+ * \ingroup Utilities
+ *
+ * Computes `C = A * B` for contiguous row-major matrices: \p a is \p m x \p k, \p b is
+ * \p k x \p n, and \p c is \p m x \p n.
+ *
+ * \see gemm(std::size_t, std::size_t, std::size_t, T, const T *, std::size_t, const T *, std::size_t, T, T *, std::size_t)
+ */
+template <typename T>
+inline void gemm(std::size_t m, std::size_t n, std::size_t k, const T *a, const T *b,
+                 T *c)
+{
+    gemm(m, n, k, T(1), a, k, b, n, T(0), c, n);
+}
+}  // namespace Vc
+
+#endif  // VC_COMMON_GEMM_H_
+
+// vim: foldmethod=marker
@@ -0,0 +1,463 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_GEOMETRY_H_
+#define VC_COMMON_GEOMETRY_H_
+
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <cstddef>
+#include <limits>
+#include <vector>
+#include <Vc/Allocator>
+#include <Vc/type_traits>
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+/**\internal
+ * The entry type of \p T if it is a SIMD vector, otherwise \p T.
+ */
+template <typename T, bool = Traits::is_simd_vector<T>::value> struct GeometryScalar {
+    using type = T;
+};
+template <typename T> struct GeometryScalar<T, true> {
+    using type = typename T::EntryType;
+};
+
+/**\internal
+ * The vector type that results from combining a shape with entries of type \p A and
+ * query objects with entries of type \p B. One of them is a SIMD vector type.
+ */
+template <typename A, typename B>
+using GeometryVector = Traits::decay<decltype(std::declval<A>() - std::declval<B>())>;
+}  // namespace Detail
+
+// shapes {{{1
+/**
+ * \ingroup Utilities
+ *
+ * An axis-aligned box spanning from \c lower to \c upper (inclusive). The entry type
+ * \p T is either a scalar, for a single box, or a SIMD vector, for a batch of boxes in
+ * structure-of-arrays layout.
+ *
+ * All shapes and the Ray class follow this convention: one shape can be tested against a
+ * batch of points or rays (`std::array<V, 3>` or `simdize<std::array<T, 3>>`), a batch of
+ * shapes against one point or ray, or a batch of shapes lane by lane against a batch of
+ * points or rays.
+ */
+template <typename T> struct Aabb {
+    std::array<T, 3> lower, upper;
+};
+
+/// \ingroup Utilities
+/// A ball around \c center.
+template <typename T> struct Sphere {
+    std::array<T, 3> center;
+    T radius;
+};
+
+/**
+ * \ingroup Utilities
+ * An oriented box: the orthonormal rows of \c axes span the box frame, \c halfExtents
+ * are the distances from \c center to the faces along these axes.
+ */
+template <typename T> struct Obb {
+    std::array<T, 3> center;
+    std::array<std::array<T, 3>, 3> axes;
+    std::array<T, 3> halfExtents;
+};
+
+/**
+ * \ingroup Utilities
+ * The points \c p with `dot(normal, p) <= offset`.
+ */
+template <typename T> struct HalfSpace {
+    std::array<T, 3> normal;
+    T offset;
+};
+
+/**
+ * \ingroup Utilities
+ *
+ * A ray segment `origin + t * direction` with \c t in `[tmin, tmax]`. The inverse
+ * direction is precomputed for the slab test. Zero direction components are allowed;
+ * their inverse is +inf.
+ */
+template <typename T> struct Ray {
+    std::array<T, 3> origin, direction, invDirection;
+    T tmin, tmax;
+
+    Ray(const std::array<T, 3> &origin_, const std::array<T, 3> &direction_,
+        T tmin_ = T(0),
+        T tmax_ = T(std::numeric_limits<
+                    typename Detail::GeometryScalar<T>::type>::infinity()))
+        : origin(origin_), direction(direction_), tmin(tmin_), tmax(tmax_)
+    {
+        for (int a = 0; a < 3; ++a) {
+            // adding +0 turns -0 into +0, so that the inverse is never -inf
+            invDirection[a] = T(1) / (direction[a] + T(0));
+        }
+    }
+};
+
+// contains {{{1
+/**
+ * \ingroup Utilities
+ * Returns the mask of the points \p p that lie inside (or on the boundary of) \p box.
+ */
+template <typename T, typename U, typename V = Detail::GeometryVector<U, T>>
+inline typename V::MaskType contains(const Aabb<T> &box, const std::array<U, 3> &p)
+{
+    return V(p[0]) >= V(box.lower[0]) && V(p[0]) <= V(box.upper[0]) &&
+           V(p[1]) >= V(box.lower[1]) && V(p[1]) <= V(box.upper[1]) &&
+           V(p[2]) >= V(box.lower[2]) && V(p[2]) <= V(box.upper[2]);
+}
+
+/// \ingroup Utilities
+/// Returns the mask of the points \p p that lie inside (or on the surface of) \p s.
+template <typename T, typename U, typename V = Detail::GeometryVector<U, T>>
+inline typename V::MaskType contains(const Sphere<T> &s, const std::array<U, 3> &p)
+{
+    const V dx = V(p[0]) - V(s.center[0]);
+    const V dy = V(p[1]) - V(s.center[1]);
+    const V dz = V(p[2]) - V(s.center[2]);
+    return dx * dx + dy * dy + dz * dz <= V(s.radius) * V(s.radius);
+}
+
+/// \ingroup Utilities
+/// Returns the mask of the points \p p that lie inside (or on the boundary of) \p box.
+template <typename T, typename U, typename V = Detail::GeometryVector<U, T>>
+inline typename V::MaskType contains(const Obb<T> &box, const std::array<U, 3> &p)
+{
+    const V d[3] = {V(p[0]) - V(box.center[0]), V(p[1]) - V(box.center[1]),
+                    V(p[2]) - V(box.center[2])};
+    typename V::MaskType inside(true);
+    for (int i = 0; i < 3; ++i) {
+        const V proj = V(box.axes[i][0]) * d[0] + V(box.axes[i][1]) * d[1] +
+                       V(box.axes[i][2]) * d[2];
+        inside = inside && abs(proj) <= V(box.halfExtents[i]);
+    }
+    return inside;
+}
+
+/// \ingroup Utilities
+/// Returns the mask of the points \p p that lie in the half-space \p h.
+template <typename T, typename U, typename V = Detail::GeometryVector<U, T>>
+inline typename V::MaskType contains(const HalfSpace<T> &h, const std::array<U, 3> &p)
+{
+    return V(h.normal[0]) * V(p[0]) + V(h.normal[1]) * V(p[1]) +
+               V(h.normal[2]) * V(p[2]) <=
+           V(h.offset);
+}
+
+// intersects {{{1
+/**
+ * \ingroup Utilities
+ *
+ * The slab test: returns the mask of the rays that hit the boxes within their
+ * `[tmin, tmax]` range. If \p tnear is not \c nullptr, it receives the ray parameters of
+ * the entry points (or \c tmin if the origin lies inside the box).
+ */
+template <typename T, typename U, typename V = Detail::GeometryVector<T, U>>
+inline typename V::MaskType intersects(const Aabb<T> &box, const Ray<U> &ray,
+                                       V *tnear = nullptr)
+{
+    V lo(ray.tmin), hi(ray.tmax);
+    for (int a = 0; a < 3; ++a) {
+        V t0 = (V(box.lower[a]) - V(ray.origin[a])) * V(ray.invDirection[a]);
+        V t1 = (V(box.upper[a]) - V(ray.origin[a])) * V(ray.invDirection[a]);
+        // 0 * inf: the origin lies on a face of a slab the ray runs parallel to, which
+        // must not restrict the ray. Since invDirection is never -inf (see Ray), t0 is
+        // the lower and t1 the upper bound in this case.
+        t0(isnan(t0)) = V(-std::numeric_limits<typename V::EntryType>::infinity());
+        t1(isnan(t1)) = V(std::numeric_limits<typename V::EntryType>::infinity());
+        lo = max(lo, min(t0, t1));
+        hi = min(hi, max(t0, t1));
+    }
+    if (tnear) {
+        *tnear = lo;
+    }
+    return lo <= hi;
+}
+
+// overlaps {{{1
+/**
+ * \ingroup Utilities
+ * Returns the mask of the boxes \p a that overlap (or touch) the boxes \p b.
+ */
+template <typename T, typename U, typename V = Detail::GeometryVector<T, U>>
+inline typename V::MaskType overlaps(const Aabb<T> &a, const Aabb<U> &b)
+{
+    return V(a.lower[0]) <= V(b.upper[0]) && V(a.upper[0]) >= V(b.lower[0]) &&
+           V(a.lower[1]) <= V(b.upper[1]) && V(a.upper[1]) >= V(b.lower[1]) &&
+           V(a.lower[2]) <= V(b.upper[2]) && V(a.upper[2]) >= V(b.lower[2]);
+}
+
+/// \ingroup Utilities
+/// Returns the mask of the boxes \p a that overlap (or touch) the spheres \p s.
+template <typename T, typename U, typename V = Detail::GeometryVector<T, U>>
+inline typename V::MaskType overlaps(const Aabb<T> &a, const Sphere<U> &s)
+{
+    V dist2 = V::Zero();
+    for (int i = 0; i < 3; ++i) {
+        const V c(s.center[i]);
+        const V d = max(max(V(a.lower[i]) - c, c - V(a.upper[i])), V::Zero());
+        dist2 += d * d;
+    }
+    return dist2 <= V(s.radius) * V(s.radius);
+}
+
+// simd_select_inside {{{1
+/**
+ * \ingroup Utilities
+ *
+ * Writes the indexes \c i in `[0, n)` of the points `{x[i], y[i], z[i]}` that \p shape
+ * contains to \p indexes, in increasing order, and returns their number. \p shape can be
+ * any shape that the \c contains functions accept. The indexes are compacted with
+ * compressStore; \p indexes needs room only for the selected points.
+ */
+template <typename Shape, typename T>
+inline std::size_t simd_select_inside(const Shape &shape, const T *x, const T *y,
+                                      const T *z, std::size_t n, int *indexes)
+{
+    using V = Vector<T>;
+    using I = typename V::IndexType;
+    // as in simd_copy_if, the compressStore output is collected in buf and leaves it
+    // one complete vector at a time
+    int buf[2 * V::Size] = {};
+    std::size_t count = 0, k = 0;
+    I index = I::IndexesFromZero();
+    std::size_t i = 0;
+    for (; i + V::Size <= n; i += V::Size, index += int(V::Size)) {
+        const std::array<V, 3> p = {{V(x + i, Vc::Unaligned), V(y + i, Vc::Unaligned),
+                                     V(z + i, Vc::Unaligned)}};
+        k += index.compressStore(&buf[k],
+                                 simd_cast<typename I::mask_type>(contains(shape, p)));
+        if (k >= V::Size) {
+            std::copy(&buf[0], &buf[V::Size], indexes + count);
+            std::copy(&buf[V::Size], &buf[2 * V::Size], &buf[0]);
+            count += V::Size;
+            k -= V::Size;
+        }
+    }
+    for (; i < n; ++i) {
+        const std::array<Scalar::Vector<T>, 3> p = {{x[i], y[i], z[i]}};
+        if (all_of(contains(shape, p))) {
+            buf[k++] = int(i);
+        }
+    }
+    std::copy(&buf[0], &buf[k], indexes + count);
+    return count + k;
+}
+
+// Bvh {{{1
+/**
+ * \ingroup Utilities
+ *
+ * A bounding volume hierarchy with four children per node over a set of axis-aligned
+ * boxes (e.g. the bounds of triangles or of other objects). The four child boxes of a
+ * node are stored as one `Aabb<SimdArray<T, 4>>`, so that a query tests all children of
+ * a node with one vectorized slab or overlap test. The hierarchy is built top-down by
+ * median splits along the axis of largest centroid extent.
+ *
+ * \code
+ * Vc::Bvh<float> bvh(triangleBounds);
+ * bvh.intersect(Vc::Ray<float>(origin, direction), [&](int i) { hitTriangle(i); });
+ * \endcode
+ */
+template <typename T> class Bvh
+{
+    using V4 = SimdArray<T, 4>;
+
+    struct Node {
+        Aabb<V4> bounds;
+        // >= 0: index of a child node, < 0: primitive -(child + 1), INT_MIN: empty
+        std::array<int, 4> child;
+    };
+
+public:
+    /// Builds the hierarchy over the boxes in [\p first, \p last).
+    template <typename It> Bvh(It first, It last) : m_boxes(first, last)
+    {
+        if (m_boxes.empty()) {
+            return;
+        }
+        std::vector<int> order(m_boxes.size());
+        for (std::size_t i = 0; i < order.size(); ++i) {
+            order[i] = int(i);
+        }
+        build(order, 0, order.size());
+    }
+    /// Builds the hierarchy over \p boxes.
+    explicit Bvh(const std::vector<Aabb<T>> &boxes) : Bvh(boxes.begin(), boxes.end()) {}
+
+    /// Returns the number of primitives.
+    std::size_t size() const { return m_boxes.size(); }
+
+    /**
+     * Calls `f(i)` for every primitive \c i whose box \p ray hits.
+     */
+    template <typename F> void intersect(const Ray<T> &ray, F &&f) const
+    {
+        traverse([&](const Aabb<V4> &b) { return intersects(b, ray); }, f);
+    }
+
+    /**
+     * Calls `f(i)` for every primitive \c i whose box overlaps \p region, which can be an
+     * Aabb<T> or a Sphere<T>.
+     */
+    template <typename Region, typename F> void query(const Region &region, F &&f) const
+    {
+        traverse([&](const Aabb<V4> &b) { return overlaps(b, region); }, f);
+    }
+
+private:
+    template <typename Test, typename F> void traverse(Test &&test, F &&f) const
+    {
+        if (m_nodes.empty()) {
+            return;
+        }
+        // the median splits bound the depth by log2(size) / 2 + 1
+        int stack[128];
+        int top = 0;
+        stack[top++] = 0;
+        while (top > 0) {
+            const Node &node = m_nodes[stack[--top]];
+            const auto hit = test(node.bounds);
+            for (int i = 0; i < 4; ++i) {
+                if (hit[i]) {
+                    const int c = node.child[i];
+                    if (c >= 0) {
+                        stack[top++] = c;
+                    } else if (c != INT_MIN) {
+                        f(-(c + 1));
+                    }
+                }
+            }
+        }
+    }
+
+    int build(std::vector<int> &order, std::size_t first, std::size_t last)
+    {
+        const int nodeIndex = int(m_nodes.size());
+        m_nodes.emplace_back();
+
+        // split the range into up to four parts, always halving the largest one
+        std::size_t bounds[5] = {first, last};
+        std::size_t parts = 1;
+        while (parts < 4) {
+            std::size_t largest = 0;
+            for (std::size_t p = 1; p < parts; ++p) {
+                if (bounds[p + 1] - bounds[p] > bounds[largest + 1] - bounds[largest]) {
+                    largest = p;
+                }
+            }
+            const std::size_t b = bounds[largest], e = bounds[largest + 1];
+            if (e - b < 2) {
+                break;
+            }
+            const int axis = largestCentroidAxis(order, b, e);
+            const std::size_t mid = b + (e - b) / 2;
+            std::nth_element(order.begin() + b, order.begin() + mid, order.begin() + e,
+                             [&](int l, int r) {
+                                 return centroid(l, axis) < centroid(r, axis);
+                             });
+            std::copy_backward(&bounds[largest + 1], &bounds[parts + 1],
+                               &bounds[parts + 2]);
+            bounds[largest + 1] = mid;
+            ++parts;
+        }
+
+        // empty slots get inverted boxes; the slab test may still report them as hit
+        Node node;
+        for (int a = 0; a < 3; ++a) {
+            node.bounds.lower[a] = V4(std::numeric_limits<T>::infinity());
+            node.bounds.upper[a] = V4(-std::numeric_limits<T>::infinity());
+        }
+        for (std::size_t p = 0; p < 4; ++p) {
+            if (p >= parts) {
+                node.child[p] = INT_MIN;
+                continue;
+            }
+            const std::size_t b = bounds[p], e = bounds[p + 1];
+            for (std::size_t i = b; i < e; ++i) {
+                const Aabb<T> &box = m_boxes[order[i]];
+                for (int a = 0; a < 3; ++a) {
+                    if (i == b || box.lower[a] < node.bounds.lower[a][p]) {
+                        node.bounds.lower[a][p] = box.lower[a];
+                    }
+                    if (i == b || box.upper[a] > node.bounds.upper[a][p]) {
+                        node.bounds.upper[a][p] = box.upper[a];
+                    }
+                }
+            }
+            node.child[p] = e - b == 1 ? -(order[b] + 1) : build(order, b, e);
+        }
+        m_nodes[nodeIndex] = node;
+        return nodeIndex;
+    }
+
+    T centroid(int i, int axis) const
+    {
+        return m_boxes[i].lower[axis] + m_boxes[i].upper[axis];
+    }
+
+    int largestCentroidAxis(const std::vector<int> &order, std::size_t b,
+                            std::size_t e) const
+    {
+        std::array<T, 3> lo, hi;
+        for (int a = 0; a < 3; ++a) {
+            lo[a] = hi[a] = centroid(order[b], a);
+        }
+        for (std::size_t i = b + 1; i < e; ++i) {
+            for (int a = 0; a < 3; ++a) {
+                lo[a] = std::min(lo[a], centroid(order[i], a));
+                hi[a] = std::max(hi[a], centroid(order[i], a));
+            }
+        }
+        int axis = 0;
+        for (int a = 1; a < 3; ++a) {
+            if (hi[a] - lo[a] > hi[axis] - lo[axis]) {
+                axis = a;
+            }
+        }
+        return axis;
+    }
+
+    std::vector<Aabb<T>> m_boxes;
+    std::vector<Node, Allocator<Node>> m_nodes;
+};
+//}}}1
+}  // namespace Vc
+
+#endif  // VC_COMMON_GEOMETRY_H_
+
+// vim: foldmethod=marker
@@ -0,0 +1,228 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2016 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_HALF_H_
+#define VC_COMMON_HALF_H_
+
+#include <cstdint>
+#include <cstring>
+#include <Vc/global.h>
+#include "../traits/type_traits.h"
+#include "macros.h"
+
+#ifdef Vc_IMPL_F16C
+#ifdef Vc_MSVC
+#include <intrin.h>
+#else
+#include <immintrin.h>
+#endif
+#endif
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+// scalar binary16 <-> binary32 conversions {{{1
+Vc_INTRINSIC std::uint32_t float_bits(float x)
+{
+    std::uint32_t r;
+    std::memcpy(&r, &x, sizeof(r));
+    return r;
+}
+Vc_INTRINSIC float bits_to_float(std::uint32_t x)
+{
+    float r;
+    std::memcpy(&r, &x, sizeof(r));
+    return r;
+}
+
+/**\internal
+ * Converts the binary16 bit pattern \p h to float. The conversion is exact.
+ */
+Vc_INTRINSIC float half_to_float(std::uint16_t h)
+{
+#ifdef Vc_IMPL_F16C
+    return _cvtsh_ss(h);
+#else
+    // Shift exponent and mantissa into place and rebias the exponent by multiplying
+    // with 2^112. This handles normals and denormals. Inf and NaN get the maximum
+    // float exponent.
+    const std::uint32_t expmant = h & 0x7fffu;
+    std::uint32_t r = float_bits(bits_to_float(expmant << 13) * bits_to_float(239u << 23));
+    if (expmant > 0x7bffu) {
+        r |= 255u << 23;
+    }
+    return bits_to_float(r | (std::uint32_t(h & 0x8000u) << 16));
+#endif
+}
+
+/**\internal
+ * Converts \p x to the binary16 bit pattern with round-to-nearest-even. Values that are
+ * too large for binary16 are converted to infinity, NaNs stay (quiet) NaNs.
+ */
+Vc_INTRINSIC std::uint16_t float_to_half(float x)
+{
+#ifdef Vc_IMPL_F16C
+    return _cvtss_sh(x, 0);
+#else
+    std::uint32_t f = float_bits(x);
+    const std::uint32_t sign = f & 0x80000000u;
+    f ^= sign;
+    std::uint32_t r;
+    if (f >= (143u << 23)) {  // overflow, Inf, or NaN
+        r = f > (255u << 23) ? 0x7e00u : 0x7c00u;
+    } else if (f < (113u << 23)) {  // denormal or zero
+        // adding 0.5 lets the FPU do the rounding of the denormal mantissa
+        r = float_bits(bits_to_float(f) + bits_to_float(126u << 23)) - (126u << 23);
+    } else {
+        const std::uint32_t mantOdd = (f >> 13) & 1;
+        r = (f + (std::uint32_t(15 - 127) << 23) + 0xfffu + mantOdd) >> 13;
+    }
+    return static_cast<std::uint16_t>(r | (sign >> 16));
+#endif
+}
+
+// scalar bfloat16 <-> binary32 conversions {{{1
+/**\internal
+ * Converts the bfloat16 bit pattern \p h to float. The conversion is exact.
+ */
+Vc_INTRINSIC float bfloat16_to_float(std::uint16_t h)
+{
+    return bits_to_float(std::uint32_t(h) << 16);
+}
+
+/**\internal
+ * Converts \p x to the bfloat16 bit pattern with round-to-nearest-even. NaNs stay
+ * (quiet) NaNs.
+ */
+Vc_INTRINSIC std::uint16_t float_to_bfloat16(float x)
+{
+    const std::uint32_t f = float_bits(x);
+    if ((f & 0x7fffffffu) > 0x7f800000u) {  // NaN
+        return static_cast<std::uint16_t>((f >> 16) | 0x40u);
+    }
+    return static_cast<std::uint16_t>((f + 0x7fffu + ((f >> 16) & 1)) >> 16);
+}
+//}}}1
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ *
+ * A 16-bit IEEE 754 (binary16) floating-point storage type.
+ *
+ * The type only stores values; all arithmetic happens after conversion to \c float.
+ * Arrays of \c half can be loaded into and stored from float_v (and SimdArray<float, N>)
+ * objects with the usual load/store functions and constructors, using the F16C
+ * conversion instructions where available:
+ * \code
+ * Vc::half data[1024];
+ * for (size_t i = 0; i < 1024; i += float_v::Size) {
+ *     float_v x(&data[i], Vc::Unaligned);
+ *     (x * x).store(&data[i], Vc::Unaligned);
+ * }
+ * \endcode
+ * Since \c half converts implicitly from and to \c float it can also be used as the
+ * memory type in gathers and scatters, and as the member type of structs accessed via
+ * InterleavedMemoryWrapper<S, float_v, half>.
+ *
+ * Vc::Memory cannot store \c half: its interface hands out \c EntryType references and
+ * pointers (operator[], scalar(), entries()) and its vector() accessors alias the storage
+ * as an array of \c EntryType. Use a \c std::vector<half> with the load/store functions
+ * above instead.
+ */
+class half
+{
+public:
+    /// Leaves the value uninitialized.
+    half() = default;
+    /// Converts \p x to the nearest representable binary16 value.
+    Vc_INTRINSIC half(float x) : m_bits(Detail::float_to_half(x)) {}
+    /// Converts the value to \c float. This conversion is exact.
+    Vc_INTRINSIC operator float() const { return Detail::half_to_float(m_bits); }
+
+    /// Returns an object with the binary16 bit pattern \p bits.
+    static Vc_INTRINSIC half fromBits(std::uint16_t bits)
+    {
+        half r;
+        r.m_bits = bits;
+        return r;
+    }
+    /// Returns the binary16 bit pattern.
+    Vc_INTRINSIC std::uint16_t bits() const { return m_bits; }
+
+private:
+    std::uint16_t m_bits;
+};
+static_assert(sizeof(half) == 2, "Vc::half must have the size of a binary16 value");
+
+/**
+ * \ingroup Utilities
+ *
+ * A 16-bit bfloat16 floating-point storage type, i.e. the upper half of an IEEE 754
+ * binary32 value.
+ *
+ * bfloat16 keeps the exponent range of \c float with an 8-bit significand. Like Vc::half
+ * it only stores values: float_v (and SimdArray<float, N>) objects load from and store
+ * to arrays of bfloat16 with the usual load/store functions, and it converts implicitly
+ * from and to \c float for use in gathers and scatters. Stores round to nearest even.
+ */
+class bfloat16
+{
+public:
+    /// Leaves the value uninitialized.
+    bfloat16() = default;
+    /// Converts \p x to the nearest representable bfloat16 value.
+    Vc_INTRINSIC bfloat16(float x) : m_bits(Detail::float_to_bfloat16(x)) {}
+    /// Converts the value to \c float. This conversion is exact.
+    Vc_INTRINSIC operator float() const { return Detail::bfloat16_to_float(m_bits); }
+
+    /// Returns an object with the bfloat16 bit pattern \p bits.
+    static Vc_INTRINSIC bfloat16 fromBits(std::uint16_t bits)
+    {
+        bfloat16 r;
+        r.m_bits = bits;
+        return r;
+    }
+    /// Returns the bfloat16 bit pattern.
+    Vc_INTRINSIC std::uint16_t bits() const { return m_bits; }
+
+private:
+    std::uint16_t m_bits;
+};
+static_assert(sizeof(bfloat16) == 2, "Vc::bfloat16 must have a size of 16 bits");
+
+namespace Traits
+{
+template <> struct is_half_float_internal<half> : public std::true_type {};
+template <> struct is_bfloat16_internal<bfloat16> : public std::true_type {};
+}  // namespace Traits
+}  // namespace Vc
+
+#endif  // VC_COMMON_HALF_H_
+
+// vim: foldmethod=marker
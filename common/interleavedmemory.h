@@ -34,19 +34,99 @@ namespace Vc_VERSIONED_NAMESPACE
 {
 namespace Common
 {
+/**\internal
+ * (De)interleaving between vectors of \p V and structs of \p M, a 16-bit floating-point
+ * storage type (Vc::half or Vc::bfloat16). Consecutive structs are converted as a
+ * contiguous block via a temporary \c EntryType array, so that the (de)interleaving
+ * shuffles of the backend's InterleaveImpl can be reused. Arbitrary indexes use one
+ * converting gather/scatter per member.
+ */
+template <typename V, typename M> struct ConvertingInterleaveImpl
+{
+    using T = typename V::EntryType;
+    using Impl = Vc::Detail::InterleaveImpl<V, V::Size, sizeof(V)>;
+
+    template <size_t StructSize, typename... Vs>
+    static Vc_INTRINSIC void deinterleave(const M *data,
+                                          const SuccessiveEntries<StructSize> &i,
+                                          Vs &&... vs)
+    {
+        alignas(V::MemoryAlignment) T tmp[StructSize * V::Size];
+        convert<StructSize>(&data[i[0]], tmp);
+        Impl::deinterleave(tmp, SuccessiveEntries<StructSize>(0),
+                           std::forward<Vs>(vs)...);
+    }
+    template <typename I, typename... Vs>
+    static Vc_INTRINSIC void deinterleave(const M *data, const I &i, Vs &&... vs)
+    {
+        gatherMembers(data, i, vs...);
+    }
+
+    template <size_t StructSize, typename... Vs>
+    static Vc_INTRINSIC void interleave(M *data, const SuccessiveEntries<StructSize> &i,
+                                        const Vs &... vs)
+    {
+        alignas(V::MemoryAlignment) T tmp[StructSize * V::Size];
+        if (sizeof...(Vs) < StructSize) {
+            // keep the members that are not written
+            convert<StructSize>(&data[i[0]], tmp);
+        }
+        Impl::interleave(tmp, SuccessiveEntries<StructSize>(0), vs...);
+        convert<StructSize>(tmp, &data[i[0]]);
+    }
+    template <typename I, typename... Vs>
+    static Vc_INTRINSIC void interleave(M *data, const I &i, const Vs &... vs)
+    {
+        scatterMembers(data, i, vs...);
+    }
+
+private:
+    template <size_t StructSize>
+    static Vc_INTRINSIC void convert(const M *Vc_RESTRICT in, T *Vc_RESTRICT out)
+    {
+        for (size_t k = 0; k < StructSize * V::Size; k += V::Size) {
+            V(&in[k], Vc::Unaligned).store(&out[k], Vc::Aligned);
+        }
+    }
+    template <size_t StructSize>
+    static Vc_INTRINSIC void convert(const T *Vc_RESTRICT in, M *Vc_RESTRICT out)
+    {
+        for (size_t k = 0; k < StructSize * V::Size; k += V::Size) {
+            V(&in[k], Vc::Aligned).store(&out[k], Vc::Unaligned);
+        }
+    }
+
+    template <typename I> static Vc_INTRINSIC void gatherMembers(const M *, const I &) {}
+    template <typename I, typename... Vs>
+    static Vc_INTRINSIC void gatherMembers(const M *data, const I &i, V &v0, Vs &... vs)
+    {
+        v0.gather(data, i);
+        gatherMembers(data + 1, i, vs...);
+    }
+
+    template <typename I> static Vc_INTRINSIC void scatterMembers(M *, const I &) {}
+    template <typename I, typename... Vs>
+    static Vc_INTRINSIC void scatterMembers(M *data, const I &i, const V &v0,
+                                            const Vs &... vs)
+    {
+        v0.scatter(data, i);
+        scatterMembers(data + 1, i, vs...);
+    }
+};
+
 /**
  * \internal
  */
-template<typename V, typename I, bool Readonly> struct InterleavedMemoryAccessBase
+template <typename V, typename I, bool Readonly, typename M = typename V::EntryType>
+struct InterleavedMemoryAccessBase
 {
     // Partial specialization doesn't work for functions without partial specialization of the whole
     // class. Therefore we capture the contents of InterleavedMemoryAccessBase in a macro to easily
     // copy it into its specializations.
-    typedef typename std::conditional<
-        Readonly, typename std::add_const<typename V::EntryType>::type,
-        typename V::EntryType>::type T;
+    typedef typename std::conditional<Readonly, typename std::add_const<M>::type, M>::type
+        T;
     typedef typename V::AsArg VArg;
-    typedef T Ta Vc_MAY_ALIAS;
+    typedef MayAlias<T> Ta;
     const I m_indexes;
     Ta *const m_data;
 
@@ -62,7 +142,10 @@ template<typename V, typename I, bool Readonly> struct InterleavedMemoryAccessBa
     }
 
 protected:
-    using Impl = Vc::Detail::InterleaveImpl<V, V::Size, sizeof(V)>;
+    using Impl = typename std::conditional<
+        std::is_same<M, typename V::EntryType>::value,
+        Vc::Detail::InterleaveImpl<V, V::Size, sizeof(V)>,
+        ConvertingInterleaveImpl<V, M>>::type;
 
     template <typename T, std::size_t... Indexes>
     Vc_INTRINSIC void callInterleave(T &&a, index_sequence<Indexes...>)
@@ -76,10 +159,11 @@ protected:
  */
 // delay execution of the deinterleaving gather until operator=
 template <size_t StructSize, typename V, typename I = typename V::IndexType,
-          bool Readonly>
-struct InterleavedMemoryReadAccess : public InterleavedMemoryAccessBase<V, I, Readonly>
+          bool Readonly, typename M>
+struct InterleavedMemoryReadAccess
+    : public InterleavedMemoryAccessBase<V, I, Readonly, M>
 {
-    typedef InterleavedMemoryAccessBase<V, I, Readonly> Base;
+    typedef InterleavedMemoryAccessBase<V, I, Readonly, M> Base;
     typedef typename Base::Ta Ta;
 
     Vc_ALWAYS_INLINE InterleavedMemoryReadAccess(Ta *data, typename I::AsArg indexes)
@@ -137,14 +221,16 @@ template<size_t S> struct CheckIndexesUnique<SuccessiveEntries<S> >
 /**
  * \internal
  */
-template <size_t StructSize, typename V, typename I = typename V::IndexType>
-struct InterleavedMemoryAccess : public InterleavedMemoryReadAccess<StructSize, V, I, false>
+template <size_t StructSize, typename V, typename I = typename V::IndexType,
+          typename M = typename V::EntryType>
+struct InterleavedMemoryAccess
+    : public InterleavedMemoryReadAccess<StructSize, V, I, false, M>
 {
-    typedef InterleavedMemoryAccessBase<V, I, false> Base;
+    typedef InterleavedMemoryAccessBase<V, I, false, M> Base;
     typedef typename Base::Ta Ta;
 
     Vc_ALWAYS_INLINE InterleavedMemoryAccess(Ta *data, typename I::AsArg indexes)
-        : InterleavedMemoryReadAccess<StructSize, V, I, false>(data, indexes)
+        : InterleavedMemoryReadAccess<StructSize, V, I, false, M>(data, indexes)
     {
         CheckIndexesUnique<I>::test(indexes);
     }
@@ -169,25 +255,35 @@ struct InterleavedMemoryAccess : public InterleavedMemoryReadAccess<StructSize,
  * \param S The type of the struct.
  * \param V The type of the vector to be returned when read. This should reflect the type of the
  * members inside the struct.
+ * \param M The type of the members inside the struct. This defaults to the entry type of \p V.
+ * A float_v may also access structs of Vc::half or Vc::bfloat16 members, which are converted
+ * on load and store.
  *
  * \see operator[]
  * \ingroup Utilities
  * \headerfile interleavedmemory.h <Vc/Memory>
  */
-template<typename S, typename V> class InterleavedMemoryWrapper
+template <typename S, typename V, typename M = typename V::EntryType>
+class InterleavedMemoryWrapper
 {
-    typedef typename std::conditional<std::is_const<S>::value,
-                                      const typename V::EntryType,
-                                      typename V::EntryType>::type T;
+    static_assert(std::is_same<M, typename V::EntryType>::value ||
+                      (std::is_same<typename V::EntryType, float>::value &&
+                       (Traits::is_half_float<M>::value ||
+                        Traits::is_bfloat16<M>::value)),
+                  "InterleavedMemoryWrapper supports members of the vector's entry type "
+                  "and, for float vectors, Vc::half or Vc::bfloat16 members");
+    typedef typename std::conditional<std::is_const<S>::value, const M, M>::type T;
     typedef typename V::IndexType I;
     typedef typename V::AsArg VArg;
     typedef const I &IndexType;
     static constexpr std::size_t StructSize = sizeof(S) / sizeof(T);
-    typedef InterleavedMemoryAccess<StructSize, V> Access;
-    typedef InterleavedMemoryReadAccess<StructSize, V> ReadAccess;
-    typedef InterleavedMemoryAccess<StructSize, V, SuccessiveEntries<StructSize> > AccessSuccessiveEntries;
-    typedef InterleavedMemoryReadAccess<StructSize, V, SuccessiveEntries<StructSize> > ReadSuccessiveEntries;
-    typedef T Ta Vc_MAY_ALIAS;
+    typedef InterleavedMemoryAccess<StructSize, V, I, M> Access;
+    typedef InterleavedMemoryReadAccess<StructSize, V, I, true, M> ReadAccess;
+    typedef InterleavedMemoryAccess<StructSize, V, SuccessiveEntries<StructSize>, M>
+        AccessSuccessiveEntries;
+    typedef InterleavedMemoryReadAccess<StructSize, V, SuccessiveEntries<StructSize>,
+                                        true, M> ReadSuccessiveEntries;
+    typedef MayAlias<T> Ta;
     Ta *const m_data;
 
     static_assert(StructSize * sizeof(T) == sizeof(S),
@@ -0,0 +1,288 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_INTERPOLATION_H_
+#define VC_COMMON_INTERPOLATION_H_
+
+#include <array>
+#include <cstddef>
+#include <vector>
+#include <Vc/type_traits>
+#include "polynomial.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+// GridGather {{{1
+/**\internal
+ * Evaluates the tensor product of the per-axis weights \p w and the grid values for the
+ * \p A axes below \p A, one axis at a time: the inner axes are interpolated first and the
+ * result is combined with the weights of axis `A - 1`. The offset of a grid point is the
+ * sum of one term per axis (see GridInterpolator::axisTerm), which \p base accumulates.
+ */
+template <std::size_t A> struct GridGather {
+    template <typename T, typename V, typename I, std::size_t Dim, std::size_t K>
+    static Vc_INTRINSIC V eval(const T *data, const I (&terms)[Dim][K],
+                               const V (&w)[Dim][K], const I &base)
+    {
+        V r = w[A - 1][0] * GridGather<A - 1>::eval(data, terms, w, base + terms[A - 1][0]);
+        for (std::size_t k = 1; k < K; ++k) {
+            r = muladd(w[A - 1][k],
+                       GridGather<A - 1>::eval(data, terms, w, base + terms[A - 1][k]), r);
+        }
+        return r;
+    }
+};
+template <> struct GridGather<0> {
+    template <typename T, typename V, typename I, std::size_t Dim, std::size_t K>
+    static Vc_INTRINSIC V eval(const T *data, const I (&)[Dim][K], const V (&)[Dim][K],
+                               const I &offsets)
+    {
+        return V(data, offsets);
+    }
+};
+//}}}1
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ *
+ * Interpolates values tabulated on a uniform \p Dim-dimensional grid at a whole vector
+ * of query points at once.
+ *
+ * The grid spans `[min[a], max[a]]` with `points[a]` equidistant grid points on every
+ * axis \c a. Each query lane locates its grid cell and gathers the neighbouring grid
+ * values: 2^Dim of them for multilinear interpolation and 4^Dim for cubic (Catmull-Rom)
+ * interpolation. Query coordinates outside of the grid are clamped to its boundary, and
+ * the cubic stencil repeats the boundary values.
+ *
+ * For \p Dim > 1 the values are stored in bricks of 4 points along every axis, so that
+ * the neighbourhood of a query point spans few cache lines, independent of the axis
+ * along which neighbouring query points are distributed.
+ *
+ * \code
+ * Vc::GridInterpolator<float, 2> table({{0.f, 0.f}}, {{1.f, 2.f}}, {{101, 201}});
+ * table.fill([](std::array<float, 2> x) { return std::sin(x[0]) * x[1]; });
+ * const Vc::float_v value = table.cubic(std::array<Vc::float_v, 2>{{x, y}});
+ * \endcode
+ *
+ * \tparam T The value type, \c float or \c double.
+ * \tparam Dim The number of dimensions.
+ */
+template <typename T, std::size_t Dim> class GridInterpolator
+{
+    static_assert(std::is_floating_point<T>::value,
+                  "GridInterpolator requires a floating-point value type");
+    static_assert(Dim >= 1, "GridInterpolator requires at least one dimension");
+
+    // log2 of the brick size along every axis
+    static constexpr int BrickShift = Dim == 1 ? 0 : 2;
+    static constexpr int BrickMask = (1 << BrickShift) - 1;
+
+public:
+    using value_type = T;
+
+    /**
+     * Constructs a grid with \p points grid points on the axes, spanning from \p min to
+     * \p max. All values are initialized to zero. Every axis needs at least two points.
+     */
+    GridInterpolator(const std::array<T, Dim> &min, const std::array<T, Dim> &max,
+                     const std::array<std::size_t, Dim> &points)
+        : m_min(min), m_points(points)
+    {
+        std::size_t bricks = 1;
+        for (std::size_t a = 0; a < Dim; ++a) {
+            Vc_ASSERT(points[a] >= 2);
+            m_step[a] = (max[a] - min[a]) / T(points[a] - 1);
+            m_scale[a] = T(points[a] - 1) / (max[a] - min[a]);
+            m_brickStride[a] = int(bricks);
+            bricks *= (points[a] + BrickMask) >> BrickShift;
+        }
+        m_data.resize(bricks << (BrickShift * Dim));
+    }
+
+    /// Returns the number of grid points along \p axis.
+    std::size_t points(std::size_t axis) const { return m_points[axis]; }
+
+    /// Returns the coordinates of the grid point at \p index.
+    std::array<T, Dim> position(const std::array<std::size_t, Dim> &index) const
+    {
+        std::array<T, Dim> x;
+        for (std::size_t a = 0; a < Dim; ++a) {
+            x[a] = m_min[a] + T(index[a]) * m_step[a];
+        }
+        return x;
+    }
+
+    /// Returns a reference to the value at grid point \p index.
+    T &operator()(const std::array<std::size_t, Dim> &index)
+    {
+        return m_data[offset(index)];
+    }
+    /// \copydoc operator()
+    const T &operator()(const std::array<std::size_t, Dim> &index) const
+    {
+        return m_data[offset(index)];
+    }
+
+    /**
+     * Sets every grid value to `f(position)`, where \c position is the
+     * `std::array<T, Dim>` of coordinates of the grid point.
+     */
+    template <typename F> void fill(F &&f)
+    {
+        forEachPoint([&](const std::array<std::size_t, Dim> &i) {
+            (*this)(i) = f(position(i));
+        });
+    }
+
+    /**
+     * Copies the grid values from the dense array \p values, where axis 0 varies
+     * fastest, i.e. `values[(k * points(1) + j) * points(0) + i]` for three dimensions.
+     */
+    void assign(const T *values)
+    {
+        forEachPoint([&](const std::array<std::size_t, Dim> &i) {
+            (*this)(i) = *values++;
+        });
+    }
+
+    /**
+     * Returns the multilinear interpolation of the grid values at the query points \p x.
+     * \p V must be a floating-point Vc::Vector or Vc::SimdArray with entry type \p T.
+     */
+    template <typename V> V linear(const std::array<V, Dim> &x) const
+    {
+        static_assert(std::is_same<typename V::EntryType, T>::value,
+                      "the query points must have the value type of the grid");
+        using I = typename V::IndexType;
+        I terms[Dim][2];
+        V w[Dim][2];
+        for (std::size_t a = 0; a < Dim; ++a) {
+            const V u = clampedCoordinate(x[a], a);
+            I i = simd_cast<I>(u);
+            i = iif(i > int(m_points[a]) - 2, I(int(m_points[a]) - 2), i);
+            const V t = u - simd_cast<V>(i);
+            terms[a][0] = axisTerm(i, a);
+            terms[a][1] = axisTerm(i + 1, a);
+            w[a][0] = V::One() - t;
+            w[a][1] = t;
+        }
+        return Detail::GridGather<Dim>::eval(m_data.data(), terms, w, I::Zero());
+    }
+
+    /**
+     * Returns the cubic (Catmull-Rom) interpolation of the grid values at the query
+     * points \p x. The interpolation passes through the grid values, is continuously
+     * differentiable, and reproduces polynomials up to degree two away from the boundary.
+     * \p V must be a floating-point Vc::Vector or Vc::SimdArray with entry type \p T.
+     */
+    template <typename V> V cubic(const std::array<V, Dim> &x) const
+    {
+        static_assert(std::is_same<typename V::EntryType, T>::value,
+                      "the query points must have the value type of the grid");
+        using I = typename V::IndexType;
+        I terms[Dim][4];
+        V w[Dim][4];
+        for (std::size_t a = 0; a < Dim; ++a) {
+            const V u = clampedCoordinate(x[a], a);
+            I i = simd_cast<I>(u);
+            i = iif(i > int(m_points[a]) - 2, I(int(m_points[a]) - 2), i);
+            const V t = u - simd_cast<V>(i);
+            const I last = int(m_points[a]) - 1;
+            terms[a][0] = axisTerm(iif(i > 0, i - 1, I::Zero()), a);
+            terms[a][1] = axisTerm(i, a);
+            terms[a][2] = axisTerm(i + 1, a);
+            terms[a][3] = axisTerm(iif(i + 2 > last, last, i + 2), a);
+            const V half(T(0.5));
+            const V t2 = t * t;
+            w[a][0] = half * t * ((V(2) - t) * t - V::One());
+            w[a][1] = half * (t2 * (V(3) * t - V(5)) + V(2));
+            w[a][2] = half * t * ((V(4) - V(3) * t) * t + V::One());
+            w[a][3] = half * (t - V::One()) * t2;
+        }
+        return Detail::GridGather<Dim>::eval(m_data.data(), terms, w, I::Zero());
+    }
+
+private:
+    /**\internal
+     * Returns the contribution of index \p i on \p axis to the storage offset. The offset
+     * of a grid point is the sum of the terms of all axes: the brick index scaled by the
+     * brick size plus the position inside the brick.
+     */
+    template <typename I> Vc_INTRINSIC I axisTerm(const I &i, std::size_t axis) const
+    {
+        return (((i >> BrickShift) * m_brickStride[axis]) << int(BrickShift * Dim)) +
+               ((i & BrickMask) << int(BrickShift * axis));
+    }
+
+    std::size_t offset(const std::array<std::size_t, Dim> &index) const
+    {
+        std::size_t r = 0;
+        for (std::size_t a = 0; a < Dim; ++a) {
+            r += axisTerm(int(index[a]), a);
+        }
+        return r;
+    }
+
+    /**\internal
+     * Returns \p x in units of the grid step along \p axis, relative to the first grid
+     * point and clamped to the grid.
+     */
+    template <typename V> Vc_INTRINSIC V clampedCoordinate(const V &x, std::size_t axis) const
+    {
+        const V u = (x - V(m_min[axis])) * V(m_scale[axis]);
+        return min(max(u, V::Zero()), V(T(m_points[axis] - 1)));
+    }
+
+    template <typename F> void forEachPoint(F &&f)
+    {
+        std::array<std::size_t, Dim> i = {};
+        while (true) {
+            f(i);
+            std::size_t a = 0;
+            for (; a < Dim && ++i[a] == m_points[a]; ++a) {
+                i[a] = 0;
+            }
+            if (a == Dim) {
+                return;
+            }
+        }
+    }
+
+    std::array<T, Dim> m_min, m_step, m_scale;
+    std::array<std::size_t, Dim> m_points;
+    std::array<int, Dim> m_brickStride;
+    std::vector<T> m_data;
+};
+}  // namespace Vc
+
+#endif  // VC_COMMON_INTERPOLATION_H_
+
+// vim: foldmethod=marker
@@ -55,7 +55,8 @@ template <typename U, typename Flags = DefaultLoadTag,
           typename = enable_if<
               (!std::is_integral<U>::value || !std::is_integral<EntryType>::value ||
                sizeof(EntryType) >= sizeof(U)) &&
-              std::is_arithmetic<U>::value &&Traits::is_load_store_flag<Flags>::value>>
+              Traits::is_load_store_type<EntryType, U>::value &&
+              Traits::is_load_store_flag<Flags>::value>>
 explicit Vc_INTRINSIC Vector(const U *x, Flags flags = Flags())
 {
     load<U, Flags>(x, flags);
@@ -94,12 +95,30 @@ template <typename U, typename Flags>
 struct load_concept : public std::enable_if<
               (!std::is_integral<U>::value || !std::is_integral<EntryType>::value ||
                sizeof(EntryType) >= sizeof(U)) &&
-              std::is_arithmetic<U>::value && Traits::is_load_store_flag<Flags>::value, void>
+              Traits::is_load_store_type<EntryType, U>::value &&
+              Traits::is_load_store_flag<Flags>::value, void>
 {};
 
 public:
 template <typename U, typename Flags = DefaultLoadTag>
 Vc_INTRINSIC_L typename load_concept<U, Flags>::type load(const U *mem, Flags = Flags()) Vc_INTRINSIC_R;
+
+// expandLoad{{{1
+/**
+ * Load consecutive values from \p mem into the entries selected by \p mask.
+ *
+ * This is the inverse of compressStore: the selected entry at offset \c i is loaded from
+ * `mem[j]`, where \c j is the number of entries selected by \p mask below \c i. Entries
+ * that are not selected are zero.
+ *
+ * \param mem A pointer to data. It does not need to be aligned.
+ * \param mask A mask object that determines which entries are loaded.
+ *
+ * \note
+ * The implementation may read all of `mem[0]` to `mem[Size - 1]`, even if `mask.count()`
+ * is smaller.
+ */
+static Vc_INTRINSIC_L Vector Vc_VDECL expandLoad(const EntryType *mem, MaskType mask) Vc_INTRINSIC_R;
 //}}}1
 
 // vim: foldmethod=marker
@@ -236,6 +236,13 @@ static Vc_INTRINSIC void unreachable() { __assume(0); }
 #define Vc_HAS_BUILTIN(x) 0
 #endif
 
+// expands to the OpenMP pragma x_ if OpenMP is enabled, to nothing otherwise
+#ifdef _OPENMP
+#define Vc_OMP_PRAGMA_(x_) _Pragma(#x_)
+#else
+#define Vc_OMP_PRAGMA_(x_)
+#endif
+
 #define Vc_CAT_HELPER_(a, b, c, d) a##b##c##d
 #define Vc_CAT(a, b, c, d) Vc_CAT_HELPER_(a, b, c, d)
 
@@ -31,6 +31,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define Vc_COMMON_MATH_H_INTERNAL 1
 
 #include "trigonometric.h"
+#include "polynomial.h"
 
 #include "const.h"
 #include "macros.h"
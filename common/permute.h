@@ -0,0 +1,58 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2016 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#ifndef VC_COMMON_PERMUTE_H_
+#define VC_COMMON_PERMUTE_H_
+
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+/**
+ * \ingroup Utilities
+ *
+ * Returns a vector where entry \c i is entry \p idx[i] of the concatenation of \p a and
+ * \p b, i.e. `a[idx[i]]` for `idx[i] < Size` and `b[idx[i] - Size]` otherwise. Every
+ * index must be in the range [0, 2 * Size).
+ *
+ * \see Vector::permute
+ */
+template <typename V>
+Vc_INTRINSIC enable_if<Traits::is_simd_vector<V>::value, V> permute2(
+    const V &a, const V &b, const typename V::IndexType &idx)
+{
+    using I = typename V::IndexType;
+    const auto fromB = idx >= int(V::Size);
+    const I j = iif(fromB, idx - int(V::Size), idx);
+    return iif(simd_cast<typename V::Mask>(fromB), b.permute(j), a.permute(j));
+}
+}  // namespace Vc
+
+#endif  // VC_COMMON_PERMUTE_H_
+
+// vim: foldmethod=marker
@@ -0,0 +1,271 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2016 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#ifndef VC_COMMON_POLYNOMIAL_H_
+#define VC_COMMON_POLYNOMIAL_H_
+
+#include <cstddef>
+#include <Vc/type_traits>
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+// muladd {{{1
+/**\internal
+ * Returns `a * b + c`. If the target has FMA instructions this is a fused multiply-add;
+ * otherwise it is a multiplication followed by an addition (in contrast to Vc::fma, which
+ * emulates the single rounding and is therefore slow without hardware support).
+ */
+template <typename V, typename T> Vc_INTRINSIC V muladd(const V &a, const V &b, const T &c)
+{
+    return a * b + c;
+}
+#if defined Vc_IMPL_AVX && (defined Vc_IMPL_FMA || defined Vc_IMPL_FMA4)
+template <typename T, typename U>
+Vc_INTRINSIC Vector<T, VectorAbi::Avx> muladd(const Vector<T, VectorAbi::Avx> &a,
+                                              const Vector<T, VectorAbi::Avx> &b,
+                                              const U &c)
+{
+    return Vc::fma(a, b, Vector<T, VectorAbi::Avx>(c));
+}
+#endif
+#if defined Vc_IMPL_SSE && defined Vc_IMPL_FMA4
+template <typename T, typename U>
+Vc_INTRINSIC Vector<T, VectorAbi::Sse> muladd(const Vector<T, VectorAbi::Sse> &a,
+                                              const Vector<T, VectorAbi::Sse> &b,
+                                              const U &c)
+{
+    return Vc::fma(a, b, Vector<T, VectorAbi::Sse>(c));
+}
+#endif
+
+// Horner {{{1
+template <std::size_t N> struct Horner
+{
+    template <typename V, typename T>
+    static Vc_INTRINSIC V eval(const V &x, const T *c)
+    {
+        return muladd(Horner<N - 1>::eval(x, c + 1), x, c[0]);
+    }
+};
+template <> struct Horner<1>
+{
+    template <typename V, typename T> static Vc_INTRINSIC V eval(const V &, const T *c)
+    {
+        return V(c[0]);
+    }
+};
+
+// Estrin {{{1
+/**\internal
+ * Returns the largest power of two that is less than \p n (for n > 1).
+ */
+constexpr std::size_t estrinSplit(std::size_t n, std::size_t m = 1)
+{
+    return m * 2 >= n ? m : estrinSplit(n, m * 2);
+}
+constexpr std::size_t ilog2(std::size_t n) { return n <= 1 ? 0 : 1 + ilog2(n / 2); }
+
+/**\internal
+ * Evaluates the polynomial with \p N coefficients as `low(x) + x^M * high(x)`, where \c M
+ * is the largest power of two less than \p N and the two halves are evaluated
+ * recursively. \p xPow holds the powers x^1, x^2, x^4, ...
+ */
+template <std::size_t N> struct Estrin
+{
+    template <typename V, typename T>
+    static Vc_INTRINSIC V eval(const V *xPow, const T *c)
+    {
+        constexpr std::size_t M = estrinSplit(N);
+        return muladd(Estrin<N - M>::eval(xPow, c + M), xPow[ilog2(M)],
+                      Estrin<M>::eval(xPow, c));
+    }
+};
+template <> struct Estrin<2>
+{
+    template <typename V, typename T>
+    static Vc_INTRINSIC V eval(const V *xPow, const T *c)
+    {
+        return muladd(V(c[1]), xPow[0], c[0]);
+    }
+};
+template <> struct Estrin<1>
+{
+    template <typename V, typename T> static Vc_INTRINSIC V eval(const V *, const T *c)
+    {
+        return V(c[0]);
+    }
+};
+
+//}}}1
+}  // namespace Detail
+
+/**
+ * \ingroup Math
+ * @{
+ */
+// polyvalHorner {{{1
+/**
+ * Evaluates the polynomial \f$\sum_{i=0}^{N-1} c_i x^i\f$ with Horner's scheme.
+ *
+ * Horner's scheme needs the fewest operations, but every step depends on the previous
+ * one. It is the best choice for low degrees or if many independent evaluations are
+ * interleaved anyway.
+ *
+ * \param x The argument(s).
+ * \param c The coefficients in ascending order, i.e. \c c[0] is the constant term.
+ */
+template <typename V, typename T, std::size_t N>
+Vc_INTRINSIC enable_if<is_simd_vector<V>::value, V> polyvalHorner(const V &x,
+                                                                  const T (&c)[N])
+{
+    static_assert(N > 0, "a polynomial needs at least one coefficient");
+    return Detail::Horner<N>::eval(x, c);
+}
+
+// polyvalEstrin {{{1
+/**
+ * Evaluates the polynomial \f$\sum_{i=0}^{N-1} c_i x^i\f$ with Estrin's scheme.
+ *
+ * Estrin's scheme evaluates pairs of coefficients independently and combines them with
+ * powers \f$x^2, x^4, \ldots\f$. This needs a few more multiplications than Horner's
+ * scheme, but the dependency chain only grows logarithmically with the degree, which
+ * allows the CPU to execute several FMAs in parallel.
+ *
+ * \param x The argument(s).
+ * \param c The coefficients in ascending order, i.e. \c c[0] is the constant term.
+ */
+template <typename V, typename T, std::size_t N>
+Vc_INTRINSIC enable_if<is_simd_vector<V>::value, V> polyvalEstrin(const V &x,
+                                                                  const T (&c)[N])
+{
+    static_assert(N > 0, "a polynomial needs at least one coefficient");
+    constexpr std::size_t NPow = Detail::ilog2(Detail::estrinSplit(N)) + 1;
+    V xPow[NPow] = {x};
+    for (std::size_t i = 1; i < NPow; ++i) {
+        xPow[i] = xPow[i - 1] * xPow[i - 1];
+    }
+    return Detail::Estrin<N>::eval(xPow, c);
+}
+
+// polyval {{{1
+/**
+ * Evaluates the polynomial \f$\sum_{i=0}^{N-1} c_i x^i\f$.
+ *
+ * The evaluation scheme is chosen at compile time from the number of coefficients:
+ * polyvalHorner for up to five coefficients and polyvalEstrin for higher degrees.
+ * Fused multiply-add instructions are used if the target supports them.
+ *
+ * \code
+ * // fitted approximation of f on [0, 1]
+ * constexpr float coeffs[] = {1.f, -0.4998f, 0.3211f, -0.1901f};
+ * float_v y = Vc::polyval(x, coeffs);
+ * \endcode
+ *
+ * \param x The argument(s).
+ * \param c The coefficients in ascending order, i.e. \c c[0] is the constant term.
+ */
+template <typename V, typename T, std::size_t N>
+Vc_INTRINSIC enable_if<is_simd_vector<V>::value, V> polyval(const V &x, const T (&c)[N])
+{
+    return N <= 5 ? polyvalHorner(x, c) : polyvalEstrin(x, c);
+}
+
+/**
+ * Overload of the above, which takes the coefficients (in ascending order) as arguments:
+ * \code
+ * float_v y = Vc::polyval(x, 1.f, -0.4998f, 0.3211f, -0.1901f);
+ * \endcode
+ */
+template <typename V, typename T, typename... Ts>
+Vc_INTRINSIC enable_if<is_simd_vector<V>::value && std::is_arithmetic<T>::value, V>
+polyval(const V &x, T c0, Ts... cs)
+{
+    using E = typename V::EntryType;
+    const E c[] = {E(c0), E(cs)...};
+    return polyval(x, c);
+}
+
+// rational {{{1
+/**
+ * Evaluates the rational function \f$\frac{\sum_i p_i x^i}{\sum_i q_i x^i}\f$.
+ *
+ * Numerator and denominator are evaluated with polyval, thus their dependency chains
+ * are independent and overlap in execution.
+ *
+ * \param x The argument(s).
+ * \param p The numerator coefficients in ascending order.
+ * \param q The denominator coefficients in ascending order.
+ */
+template <typename V, typename T, std::size_t N, std::size_t M>
+Vc_INTRINSIC enable_if<is_simd_vector<V>::value, V> rational(const V &x, const T (&p)[N],
+                                                             const T (&q)[M])
+{
+    return polyval(x, p) / polyval(x, q);
+}
+
+// chebval {{{1
+/**
+ * Evaluates the Chebyshev series \f$\sum_{i=0}^{N-1} c_i T_i(x)\f$ with Clenshaw's
+ * recurrence.
+ *
+ * The Chebyshev polynomials are defined on \f$[-1, 1]\f$. For a series fitted on
+ * \f$[a, b]\f$ transform the argument first:
+ * \code
+ * float_v y = Vc::chebval((2 * x - (a + b)) / (b - a), coeffs);
+ * \endcode
+ *
+ * \param x The argument(s), in the interval \f$[-1, 1]\f$.
+ * \param c The coefficients of the series, \c c[0] belongs to \f$T_0 = 1\f$.
+ */
+template <typename V, typename T, std::size_t N>
+Vc_INTRINSIC enable_if<is_simd_vector<V>::value, V> chebval(const V &x, const T (&c)[N])
+{
+    static_assert(N > 0, "a Chebyshev series needs at least one coefficient");
+    if (N == 1) {
+        return V(c[0]);
+    }
+    const V x2 = x + x;
+    V b1 = V(c[N - 1]);
+    V b2 = V::Zero();
+    for (std::size_t i = N - 2; i > 0; --i) {
+        const V tmp = b1;
+        b1 = Detail::muladd(x2, b1, c[i]) - b2;
+        b2 = tmp;
+    }
+    return Detail::muladd(x, b1, c[0]) - b2;
+}
+//}}}1
+/// @}
+}  // namespace Vc
+
+#endif  // VC_COMMON_POLYNOMIAL_H_
+
+// vim: foldmethod=marker
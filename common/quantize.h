@@ -0,0 +1,144 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2016 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#ifndef VC_COMMON_QUANTIZE_H_
+#define VC_COMMON_QUANTIZE_H_
+
+#include <limits>
+#include <Vc/type_traits>
+#include "loadstoreflags.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+/**\internal
+ * Returns the largest value of \p T that does not exceed the maximum of the integer type
+ * \p U. If \p U has more digits than the significand of \p T, \c T(max) rounds up to a
+ * power of two, which does not convert back to \p U (e.g. \c float(INT_MAX) is 2^31).
+ * Therefore the low bits that \p T cannot represent are cleared.
+ */
+template <typename T, typename U> constexpr T quantizeUpperBound()
+{
+    return T(std::numeric_limits<U>::max() &
+             ~((U(1) << (std::numeric_limits<U>::digits > std::numeric_limits<T>::digits
+                             ? std::numeric_limits<U>::digits -
+                                   std::numeric_limits<T>::digits
+                             : 0)) -
+               1));
+}
+
+/**\internal
+ * Stores the quantized values \p q to \p mem. Vectors of \c float have converting stores
+ * to 8-bit integers. All other combinations are converted first: to a \c float SimdArray
+ * for 8-bit integers (e.g. from \c double), otherwise to the corresponding integer
+ * SimdArray.
+ */
+template <typename V, typename U, typename Flags>
+Vc_INTRINSIC void quantizeStore(const V &q, U *mem, Flags flags, std::true_type)
+{
+    q.store(mem, flags);
+}
+template <typename V, typename U, typename Flags>
+Vc_INTRINSIC void quantizeStore(const V &q, U *mem, Flags flags, std::false_type)
+{
+    using W = typename std::conditional<sizeof(U) == 1, SimdArray<float, V::Size>,
+                                        SimdArray<U, V::Size>>::type;
+    quantizeStore(simd_cast<W>(q), mem, flags, std::true_type());
+}
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ *
+ * Loads \VSize{T} quantized values from \p mem and returns the dequantized values
+ * `(mem[i] - zeroPoint) * scale`.
+ *
+ * The integer to float conversion, the zero-point subtraction, and the scaling all happen
+ * in registers, i.e. a typical embedding lookup becomes:
+ * \code
+ * const Vc::schar *row = ...;
+ * for (size_t i = 0; i < dim; i += float_v::Size) {
+ *     const float_v x = Vc::dequantize<float_v>(&row[i], scale, zeroPoint);
+ *     ...
+ * }
+ * \endcode
+ *
+ * \tparam V A floating-point vector type (Vector or SimdArray).
+ * \param mem A pointer to \VSize{T} consecutive values of any type supported by the
+ *            converting load of \p V (e.g. \c schar, \c uchar, \c short, Vc::half, or
+ *            Vc::bfloat16).
+ * \param scale The distance between two consecutive quantization levels.
+ * \param zeroPoint The quantized value that represents \c 0.
+ * \param flags Load flags, e.g. Vc::Aligned or Vc::Unaligned.
+ */
+template <typename V, typename U, typename Flags = DefaultLoadTag>
+Vc_INTRINSIC enable_if<is_simd_vector<V>::value &&
+                           std::is_floating_point<typename V::EntryType>::value,
+                       V>
+dequantize(const U *mem, typename V::EntryType scale, int zeroPoint = 0,
+           Flags flags = Flags())
+{
+    return (V(mem, flags) - V(typename V::EntryType(zeroPoint))) * scale;
+}
+
+/**
+ * \ingroup Utilities
+ *
+ * Quantizes \p x and stores the result to \p mem. This is the inverse of dequantize():
+ * `mem[i] = clamp(round(x[i] / scale) + zeroPoint)`, where the result saturates at the
+ * range of \p U.
+ *
+ * \param x The values to quantize.
+ * \param mem A pointer to memory, where \VSize{T} consecutive integers will be stored.
+ * \param scale The distance between two consecutive quantization levels.
+ * \param zeroPoint The quantized value that represents \c 0.
+ * \param flags Store flags, e.g. Vc::Aligned or Vc::Unaligned.
+ */
+template <typename V, typename U, typename Flags = DefaultStoreTag>
+Vc_INTRINSIC enable_if<is_simd_vector<V>::value &&
+                           std::is_floating_point<typename V::EntryType>::value &&
+                           std::is_integral<U>::value,
+                       void>
+quantize(const V &x, U *mem, typename V::EntryType scale, int zeroPoint = 0,
+         Flags flags = Flags())
+{
+    using T = typename V::EntryType;
+    const V q = Vc::round(x / V(scale)) + V(T(zeroPoint));
+    Detail::quantizeStore(Vc::min(Vc::max(q, V(T(std::numeric_limits<U>::min()))),
+                                  V(Detail::quantizeUpperBound<T, U>())),
+                          mem, flags,
+                          std::integral_constant<bool, std::is_same<T, float>::value &&
+                                                           sizeof(U) == 1>());
+}
+}  // namespace Vc
+
+#endif  // VC_COMMON_QUANTIZE_H_
+
+// vim: foldmethod=marker
@@ -0,0 +1,369 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2016 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#ifndef VC_COMMON_RANDOM_H_
+#define VC_COMMON_RANDOM_H_
+
+#include <cstdint>
+#include <Vc/type_traits>
+#include "../common/simdarray.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+// splitmix64 {{{1
+/**\internal
+ * The splitmix64 generator, used to expand a 64-bit seed into the xoshiro128++ state.
+ */
+inline std::uint64_t splitmix64(std::uint64_t &x)
+{
+    std::uint64_t z = (x += 0x9e3779b97f4a7c15ull);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return z ^ (z >> 31);
+}
+
+// xoshiro128++ {{{1
+/**\internal
+ * Rotates every entry of \p x left by \p k bits. \p T may be an unsigned 32-bit integer
+ * or a vector thereof.
+ */
+template <int k, typename T> Vc_INTRINSIC T rotl32(const T &x)
+{
+    return (x << k) | (x >> (32 - k));
+}
+
+/**\internal
+ * Advances the xoshiro128++ state \p s by one step and returns the output of the
+ * generator. The function is written such that it works for scalar and vector state.
+ */
+template <typename T> Vc_INTRINSIC T xoshiro128ppStep(T *s)
+{
+    const T result = rotl32<7>(s[0] + s[3]) + s[0];
+    const T t = s[1] << 9;
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = rotl32<11>(s[3]);
+    return result;
+}
+
+/**\internal
+ * Advances the xoshiro128++ state \p s by the number of steps encoded in the jump
+ * polynomial \p poly.
+ */
+template <typename T> inline void xoshiro128ppJump(T *s, const std::uint32_t *poly)
+{
+    T r[4] = {T(0u), T(0u), T(0u), T(0u)};
+    for (int i = 0; i < 4; ++i) {
+        for (int b = 0; b < 32; ++b) {
+            if (poly[i] & (1u << b)) {
+                r[0] ^= s[0];
+                r[1] ^= s[1];
+                r[2] ^= s[2];
+                r[3] ^= s[3];
+            }
+            xoshiro128ppStep(s);
+        }
+    }
+    for (int i = 0; i < 4; ++i) {
+        s[i] = r[i];
+    }
+}
+
+/// jump polynomial for 2^64 steps
+constexpr std::uint32_t xoshiro128ppJump64[4] = {0x8764000b, 0xf542d2d3, 0x6fa035c3,
+                                                 0x77f2db5b};
+/// jump polynomial for 2^96 steps
+constexpr std::uint32_t xoshiro128ppJump96[4] = {0xb523952e, 0x0b6f099f, 0xccf5a0ef,
+                                                 0x1c580662};
+
+// mulhi32 {{{1
+/**\internal
+ * Returns the upper 32 bits of the 64-bit products of the unsigned 32-bit entries in \p a
+ * and \p b, using only 32-bit multiplications.
+ */
+template <typename U> Vc_INTRINSIC U mulhi32(const U &a, const U &b)
+{
+    const U al = a & 0xffffu, ah = a >> 16;
+    const U bl = b & 0xffffu, bh = b >> 16;
+    const U m1 = ah * bl + ((al * bl) >> 16);
+    const U m2 = al * bh + (m1 & 0xffffu);
+    return ah * bh + (m1 >> 16) + (m2 >> 16);
+}
+//}}}1
+}  // namespace Detail
+
+// Xoshiro128PlusPlus {{{1
+/**
+ * \ingroup Utilities
+ *
+ * A vectorized xoshiro128++ pseudo-random number generator with explicit state.
+ *
+ * Every entry of the generator runs its own xoshiro128++ sequence (period \f$2^{128}-1\f$).
+ * The sequences are derived from a single 64-bit seed: the state of entry \c i of stream
+ * \c s is the seeded state advanced by \f$s \cdot 2^{96} + i \cdot 2^{64}\f$ steps. Thus,
+ * all entries of all streams are non-overlapping and the output only depends on the seed
+ * and the stream index, not on the number of threads or the order of thread execution.
+ *
+ * Create one generator object per thread:
+ * \code
+ * #pragma omp parallel
+ * {
+ *     Vc::Xoshiro128PlusPlus<float_v> engine(seed, omp_get_thread_num());
+ *     Vc::NormalDistribution<float_v> normal;
+ *     for (...) {
+ *         const float_v x = normal(engine);
+ *         ...
+ *     }
+ * }
+ * \endcode
+ *
+ * In contrast to this class, Vector::Random() uses a small global state shared between
+ * all threads and is therefore neither thread-safe nor of high statistical quality.
+ *
+ * \tparam V The vector type the generated numbers will be used with (e.g. float_v,
+ *           double_v, int_v, or SimdArray<float, N>). The generator produces as many
+ *           32-bit values per call as \p V has entries.
+ */
+template <typename V> class Xoshiro128PlusPlus
+{
+    static_assert(is_simd_vector<V>::value, "Xoshiro128PlusPlus<V> requires a Vc vector type");
+
+public:
+    /// The number of independent sequences that are advanced per call.
+    static constexpr std::size_t Size = V::Size;
+    /// The type of the random bits returned from operator().
+    using result_type = SimdArray<uint, Size>;
+
+    /**
+     * Initializes the state from \p seed and selects the stream with index \p stream.
+     *
+     * Generators constructed with the same seed and different stream indexes (less than
+     * \f$2^{32}\f$) produce non-overlapping sequences. The cost of the constructor is
+     * linear in \p stream.
+     */
+    explicit Xoshiro128PlusPlus(std::uint64_t seed, std::uint64_t stream = 0)
+    {
+        uint s[4];
+        const std::uint64_t a = Detail::splitmix64(seed);
+        const std::uint64_t b = Detail::splitmix64(seed);
+        s[0] = static_cast<uint>(a);
+        s[1] = static_cast<uint>(a >> 32);
+        s[2] = static_cast<uint>(b);
+        s[3] = static_cast<uint>(b >> 32);
+        for (; stream > 0; --stream) {
+            Detail::xoshiro128ppJump(s, Detail::xoshiro128ppJump96);
+        }
+        for (std::size_t i = 0; i < Size; ++i) {
+            for (int j = 0; j < 4; ++j) {
+                state[j][i] = s[j];
+            }
+            Detail::xoshiro128ppJump(s, Detail::xoshiro128ppJump64);
+        }
+    }
+
+    /// Returns \VSize{V} random 32-bit values and advances the state.
+    Vc_INTRINSIC result_type operator()() { return Detail::xoshiro128ppStep(state); }
+
+    /**
+     * Advances every entry by \f$2^{96}\f$ steps. Afterwards the generator produces the
+     * same sequence as a generator constructed with the next stream index.
+     */
+    void jump() { Detail::xoshiro128ppJump(state, Detail::xoshiro128ppJump96); }
+
+    /// Advances the state by \p n calls to operator().
+    void discard(std::uint64_t n)
+    {
+        for (; n > 0; --n) {
+            Detail::xoshiro128ppStep(state);
+        }
+    }
+
+private:
+    result_type state[4];
+};
+
+// UniformRealDistribution {{{1
+/**
+ * \ingroup Utilities
+ *
+ * Produces floating-point vectors uniformly distributed in the interval
+ * \f$[a, b)\f$ from the random bits of a vectorized generator (e.g. Xoshiro128PlusPlus).
+ *
+ * For \c float entries 24 random bits and for \c double entries 53 random bits (from two
+ * calls to the generator) are used.
+ */
+template <typename V> class UniformRealDistribution
+{
+    static_assert(std::is_floating_point<typename V::EntryType>::value,
+                  "UniformRealDistribution<V> requires a floating-point vector type");
+    using T = typename V::EntryType;
+
+public:
+    /// Initializes the distribution for the interval \f$[a, b)\f$.
+    explicit UniformRealDistribution(T a = 0, T b = 1) : m_a(a), m_scale(b - a) {}
+
+    /// Returns the next \VSize{V} uniformly distributed values.
+    template <typename G> Vc_INTRINSIC V operator()(G &g)
+    {
+        return m_a + m_scale * canonical(g, std::is_same<T, float>());
+    }
+
+    T a() const { return m_a; }
+    T b() const { return m_a + m_scale; }
+
+private:
+    template <typename G> static Vc_INTRINSIC V canonical(G &g, std::true_type)
+    {
+        static_assert(G::Size == V::Size, "the generator must produce V::Size values");
+        // 24 bits fit the float mantissa; convert via int to use the signed conversion
+        return simd_cast<V>(simd_cast<SimdArray<int, V::Size>>(g() >> 8)) *
+               T(1. / (1 << 24));
+    }
+    template <typename G> static Vc_INTRINSIC V canonical(G &g, std::false_type)
+    {
+        static_assert(G::Size == V::Size, "the generator must produce V::Size values");
+        const V hi = simd_cast<V>(simd_cast<SimdArray<int, V::Size>>(g() >> 11));
+        const V lo = simd_cast<V>(g());
+        return (hi * T(4294967296.) + lo) * T(1. / (1ull << 53));
+    }
+
+    T m_a, m_scale;
+};
+
+// NormalDistribution {{{1
+/**
+ * \ingroup Utilities
+ *
+ * Produces normally distributed floating-point vectors with mean \c mu and standard
+ * deviation \c sigma.
+ *
+ * The implementation uses the Box-Muller transform on full vectors: each transform
+ * yields two result vectors, the second one is returned from the next call.
+ */
+template <typename V> class NormalDistribution
+{
+    using T = typename V::EntryType;
+
+public:
+    /// Initializes the distribution with mean \p mu and standard deviation \p sigma.
+    explicit NormalDistribution(T mu = 0, T sigma = 1) : m_mu(mu), m_sigma(sigma) {}
+
+    /// Returns the next \VSize{V} normally distributed values.
+    template <typename G> V operator()(G &g)
+    {
+        if (m_hasCached) {
+            m_hasCached = false;
+            return m_cached;
+        }
+        UniformRealDistribution<V> uniform;
+        // 1 - u lies in (0, 1] and thus the logarithm is finite
+        const V r = sqrt(T(-2) * log(V::One() - uniform(g))) * m_sigma;
+        V s, c;
+        sincos(uniform(g) * T(2 * 3.14159265358979323846), &s, &c);
+        m_cached = m_mu + r * s;
+        m_hasCached = true;
+        return m_mu + r * c;
+    }
+
+    /// Discards the cached second result of the last Box-Muller transform.
+    void reset() { m_hasCached = false; }
+
+    T mean() const { return m_mu; }
+    T stddev() const { return m_sigma; }
+
+private:
+    T m_mu, m_sigma;
+    V m_cached;
+    bool m_hasCached = false;
+};
+
+// UniformIntDistribution {{{1
+/**
+ * \ingroup Utilities
+ *
+ * Produces integer vectors uniformly distributed in the closed interval \f$[a, b]\f$.
+ *
+ * The range reduction uses Lemire's multiply-shift method. The few draws that would
+ * introduce a bias are rejected and redrawn, thus the result is exactly uniform.
+ */
+template <typename V> class UniformIntDistribution
+{
+    static_assert(std::is_integral<typename V::EntryType>::value &&
+                      sizeof(typename V::EntryType) <= 4,
+                  "UniformIntDistribution<V> requires a vector of integers of at most 32 "
+                  "bits");
+    using T = typename V::EntryType;
+    using U = SimdArray<uint, V::Size>;
+
+public:
+    /// Initializes the distribution for the interval \f$[a, b]\f$.
+    explicit UniformIntDistribution(T a = 0, T b = std::numeric_limits<T>::max())
+        : m_a(a), m_range(static_cast<uint>(b) - static_cast<uint>(a) + 1u)
+    {
+    }
+
+    /// Returns the next \VSize{V} uniformly distributed values.
+    template <typename G> V operator()(G &g)
+    {
+        static_assert(G::Size == V::Size, "the generator must produce V::Size values");
+        U r = g();
+        if (m_range == 0) {  // the full 32-bit range
+            return simd_cast<V>(r);
+        }
+        const U range = m_range;
+        auto reject = (r * range) < range;
+        if (Vc_IS_UNLIKELY(any_of(reject))) {
+            const U threshold = (0u - m_range) % m_range;
+            reject = (r * range) < threshold;
+            while (any_of(reject)) {
+                where(reject) | r = g();
+                reject &= (r * range) < threshold;
+            }
+        }
+        return simd_cast<V>(Detail::mulhi32(r, range) + U(static_cast<uint>(m_a)));
+    }
+
+    T a() const { return m_a; }
+    T b() const { return static_cast<T>(static_cast<uint>(m_a) + m_range - 1u); }
+
+private:
+    T m_a;
+    uint m_range;
+};
+//}}}1
+}  // namespace Vc
+
+#endif  // VC_COMMON_RANDOM_H_
+
+// vim: foldmethod=marker
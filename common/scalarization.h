@@ -0,0 +1,149 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2016 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#ifndef VC_COMMON_SCALARIZATION_H_
+#define VC_COMMON_SCALARIZATION_H_
+
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+#include "macros.h"
+
+/**
+ * \ingroup Utilities
+ *
+ * Some operations in Vc execute one instruction (or function call) per vector entry:
+ * Vector::apply, Vector::callWithValuesSorted, element access via `v[i]` on non-const
+ * objects, SimdArray operations without a native implementation for the chosen split, and
+ * simd_cast paths that copy entry by entry. Such code compiles and produces correct
+ * results, but it silently loses vectorization.
+ *
+ * Defining one (or both) of the following macros before including any Vc header marks
+ * these paths:
+ * \li \c Vc_WARN_ON_SCALARIZATION makes every instantiation of a scalarizing path emit a
+ *     deprecation warning (with the instantiation context). Combine it with
+ *     `-Werror=deprecated-declarations` to let CI builds fail on scalarized kernels.
+ * \li \c Vc_COUNT_SCALARIZATION counts every execution of a scalarizing path. The count
+ *     can be queried with Vc::scalarization_count().
+ *
+ * The Scalar implementation (and thus single-entry types) is never flagged.
+ */
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Common
+{
+///\internal The counter for Vc_COUNT_SCALARIZATION.
+inline std::atomic<std::size_t> &scalarization_counter()
+{
+    static std::atomic<std::size_t> counter(0);
+    return counter;
+}
+
+#ifdef Vc_WARN_ON_SCALARIZATION
+#define Vc_SCALARIZATION_WARNING_(msg_) Vc_DEPRECATED(msg_)
+#else
+#define Vc_SCALARIZATION_WARNING_(msg_)
+#endif
+
+/**\internal
+ * Defines the marker function \p name_. It is called with a pointer to the (dependent) type
+ * that executes the scalarizing code, so that the warning is only issued on instantiation
+ * and only if the type has more than one entry.
+ */
+#ifdef Vc_COUNT_SCALARIZATION
+#define Vc_SCALARIZATION_MARKER_(name_, msg_)                                            \
+    template <typename T>                                                                \
+    Vc_SCALARIZATION_WARNING_(msg_)                                                      \
+    Vc_INTRINSIC typename std::enable_if<(T::Size > 1), void>::type name_(const T *)     \
+    {                                                                                    \
+        scalarization_counter().fetch_add(1, std::memory_order_relaxed);                 \
+    }                                                                                    \
+    template <typename T>                                                                \
+    Vc_INTRINSIC typename std::enable_if<(T::Size == 1), void>::type name_(const T *)    \
+    {                                                                                    \
+    }                                                                                    \
+    Vc_NOTHING_EXPECTING_SEMICOLON
+#else
+#define Vc_SCALARIZATION_MARKER_(name_, msg_)                                            \
+    template <typename T>                                                                \
+    Vc_SCALARIZATION_WARNING_(msg_)                                                      \
+    Vc_INTRINSIC typename std::enable_if<(T::Size > 1), void>::type name_(const T *)     \
+    {                                                                                    \
+    }                                                                                    \
+    template <typename T>                                                                \
+    Vc_INTRINSIC typename std::enable_if<(T::Size == 1), void>::type name_(const T *)    \
+    {                                                                                    \
+    }                                                                                    \
+    Vc_NOTHING_EXPECTING_SEMICOLON
+#endif
+
+Vc_SCALARIZATION_MARKER_(scalarized_apply,
+                         "Vc_WARN_ON_SCALARIZATION: apply/call executes one function "
+                         "call per vector entry");
+Vc_SCALARIZATION_MARKER_(scalarized_callWithValuesSorted,
+                         "Vc_WARN_ON_SCALARIZATION: callWithValuesSorted executes one "
+                         "function call per distinct vector entry");
+Vc_SCALARIZATION_MARKER_(scalarized_element_access,
+                         "Vc_WARN_ON_SCALARIZATION: writable element access (v[i]) "
+                         "operates on a single vector entry");
+Vc_SCALARIZATION_MARKER_(scalarized_operation,
+                         "Vc_WARN_ON_SCALARIZATION: this operation has no vectorized "
+                         "implementation and executes one entry at a time");
+Vc_SCALARIZATION_MARKER_(scalarized_simd_cast,
+                         "Vc_WARN_ON_SCALARIZATION: this simd_cast copies the vector "
+                         "entries one at a time");
+
+#undef Vc_SCALARIZATION_MARKER_
+#undef Vc_SCALARIZATION_WARNING_
+}  // namespace Common
+
+/**
+ * \ingroup Utilities
+ *
+ * Returns how often a scalarizing code path was executed, if Vc_COUNT_SCALARIZATION is
+ * defined. Otherwise the function always returns 0.
+ */
+inline std::size_t scalarization_count()
+{
+    return Common::scalarization_counter().load(std::memory_order_relaxed);
+}
+
+/**
+ * \ingroup Utilities
+ *
+ * Resets the counter returned by scalarization_count() to 0.
+ */
+inline void reset_scalarization_count()
+{
+    Common::scalarization_counter().store(0, std::memory_order_relaxed);
+}
+}  // namespace Vc
+
+#endif  // VC_COMMON_SCALARIZATION_H_
+
+// vim: foldmethod=marker
@@ -35,11 +35,13 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #endif
 
 #include <array>
+#include <limits>
 
 #include "writemaskedvector.h"
 #include "simdarrayhelper.h"
 #include "simdmaskarray.h"
 #include "utility.h"
+#include "scalarization.h"
 #include "interleave.h"
 #include "indexsequence.h"
 #include "transpose.h"
@@ -260,6 +262,18 @@ public:
         data.store(std::forward<Args>(args)...);
     }
 
+    ///\copydoc Vector::compressStore
+    Vc_INTRINSIC std::size_t compressStore(value_type *mem, const mask_type &k) const
+    {
+        return data.compressStore(mem, internal_data(k));
+    }
+
+    ///\copydoc Vector::expandLoad
+    static Vc_INTRINSIC SimdArray expandLoad(const value_type *mem, const mask_type &k)
+    {
+        return SimdArray(vector_type::expandLoad(mem, internal_data(k)));
+    }
+
     Vc_INTRINSIC mask_type operator!() const
     {
         return {!data};
@@ -429,6 +443,13 @@ public:
         return {data.reversed()};
     }
 
+    ///\copydoc Vector::permute
+    Vc_INTRINSIC SimdArray permute(const IndexType &idx) const
+    {
+        return SimdArray(
+            data.permute(simd_cast<typename vector_type::IndexType>(idx)));
+    }
+
     Vc_INTRINSIC SimdArray sorted() const
     {
         return {data.sorted()};
@@ -534,6 +555,10 @@ inline void SimdArray<T, N, VectorType, N>::scatterImplementation(MT *mem,
  *           arbitrary number, though not every number is a good idea.
  *           Generally, a power of two value or the sum of two power of two values might
  *           work efficiently, though this depends a lot on the target system.
+ *           The elements are split greedily into the widest native vectors first (e.g.
+ *           12 floats are one AVX and one SSE vector on an AVX target). A remainder
+ *           smaller than the narrowest vector width is stored as scalar pieces; there is
+ *           no padded vector with masked loads and stores for it.
  *
  * \tparam V Don't change the default value unless you really know what you are doing.
  *           This type is set to the underlying native Vc::Vector type used in the
@@ -862,6 +887,23 @@ public:
         data1.store(mem + storage_type0::size(), Split::hi(std::forward<Args>(args))...);
     }
 
+    ///\copydoc Vector::compressStore
+    Vc_INTRINSIC std::size_t compressStore(value_type *mem, const mask_type &k) const
+    {
+        // data1 writes at most storage_type1::size() entries after the ones of data0, which
+        // stays within the N entries compressStore may write
+        const std::size_t n = data0.compressStore(mem, internal_data0(k));
+        return n + data1.compressStore(mem + n, internal_data1(k));
+    }
+
+    ///\copydoc Vector::expandLoad
+    static Vc_INTRINSIC SimdArray expandLoad(const value_type *mem, const mask_type &k)
+    {
+        return {storage_type0::expandLoad(mem, internal_data0(k)),
+                storage_type1::expandLoad(mem + internal_data0(k).count(),
+                                          internal_data1(k))};
+    }
+
     Vc_INTRINSIC mask_type operator!() const
     {
         return {!data0, !data1};
@@ -1087,6 +1129,7 @@ public:
         SimdArray>
         shifted(int amount, const SimdArray<value_type, NN> &shiftIn) const
     {
+        Common::scalarized_operation(this);
         constexpr int SSize = Size;
         if (amount < 0) {
             return SimdArray::generate([&](int i) -> value_type {
@@ -1277,6 +1320,23 @@ public:
 #endif
         }
     }
+
+    ///\copydoc Vector::permute
+    inline SimdArray permute(const IndexType &idx) const //{{{2
+    {
+        if (std::is_same<storage_type0, storage_type1>::value) {
+            using I = typename storage_type0::IndexType;
+            const storage_type0 &b = simd_cast<storage_type0>(data1);
+            return {permute2(data0, b, simd_cast<I>(idx)),
+                    simd_cast<storage_type1>(
+                        permute2(data0, b, simd_cast<I, 1>(idx)))};
+        } else {
+            // the halves differ in size: look the entries up in memory
+            alignas(MemoryAlignment) T tmp[N];
+            store(&tmp[0], Vc::Aligned);
+            return SimdArray(&tmp[0], idx);
+        }
+    }
     ///\copydoc Vector::sorted
     inline SimdArray sorted() const  //{{{2
     {
@@ -1320,6 +1380,7 @@ public:
 #ifdef Vc_DEBUG_SORTED
         std::cerr << "== " << a << b << '\n';
 #endif
+        Common::scalarized_operation(this);
         auto aIt = Vc::begin(a);
         auto bIt = Vc::begin(b);
         const auto aEnd = Vc::end(a);
@@ -1768,6 +1829,7 @@ template <typename Return, std::size_t N, typename T, typename... From>
 Vc_INTRINSIC Vc_CONST enable_if<sizeof...(From) != 0, Return>
 simd_cast_impl_smaller_input(const From &... xs, const T &last)
 {
+    Common::scalarized_simd_cast(&last);
     Return r = simd_cast<Return>(xs...);
     for (size_t i = 0; i < N; ++i) {
         r[i + N * sizeof...(From)] = static_cast<typename Return::EntryType>(last[i]);
@@ -1777,6 +1839,7 @@ simd_cast_impl_smaller_input(const From &... xs, const T &last)
 template <typename Return, std::size_t N, typename T>
 Vc_INTRINSIC Vc_CONST Return simd_cast_impl_smaller_input(const T &last)
 {
+    Common::scalarized_simd_cast(&last);
     Return r = Return();
     for (size_t i = 0; i < N; ++i) {
         r[i] = static_cast<typename Return::EntryType>(last[i]);
@@ -1787,6 +1850,7 @@ template <typename Return, std::size_t N, typename T, typename... From>
 Vc_INTRINSIC Vc_CONST enable_if<sizeof...(From) != 0, Return> simd_cast_impl_larger_input(
     const From &... xs, const T &last)
 {
+    Common::scalarized_simd_cast(&last);
     Return r = simd_cast<Return>(xs...);
     for (size_t i = N * sizeof...(From); i < Return::Size; ++i) {
         r[i] = static_cast<typename Return::EntryType>(last[i - N * sizeof...(From)]);
@@ -1796,6 +1860,7 @@ Vc_INTRINSIC Vc_CONST enable_if<sizeof...(From) != 0, Return> simd_cast_impl_lar
 template <typename Return, std::size_t N, typename T>
 Vc_INTRINSIC Vc_CONST Return simd_cast_impl_larger_input(const T &last)
 {
+    Common::scalarized_simd_cast(&last);
     Return r = Return();
     for (size_t i = 0; i < Return::size(); ++i) {
         r[i] = static_cast<typename Return::EntryType>(last[i]);
@@ -2245,6 +2310,7 @@ Vc_SIMDARRAY_CASTS(SimdMaskArray);
         simd_cast(const SimdArrayType_<T, N, V, M> &x Vc_DUMMY_ARG5)                     \
     {                                                                                    \
         vc_debug_("simd_cast{offset, copy scalars}(", ")\n", offset, x);                 \
+        Common::scalarized_simd_cast(&x);                                                \
         using R = typename Return::EntryType;                                            \
         Return r = Return::Zero();                                                       \
         for (std::size_t i = offset * Return::Size;                                      \
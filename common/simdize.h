@@ -30,6 +30,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <tuple>
 #include <array>
+#include <vector>
 
 #include "macros.h"
 
@@ -1218,13 +1219,182 @@ Vc_INTRINSIC V fromIteratorImpl(enable_if<(I < End), It> it)
     get_dispatcher<I>(r) = tmp;
     return r;
 }
+// interleaved access for contiguous iterators {{{
+/**\internal
+ * Identifies scalar iterators that point into contiguous storage: pointers and the
+ * iterators of std::vector.
+ */
+template <typename It, typename T = typename std::iterator_traits<It>::value_type>
+struct is_contiguous_iterator
+    : public std::integral_constant<
+          bool, std::is_pointer<It>::value ||
+                    std::is_same<It, typename std::vector<T>::iterator>::value ||
+                    std::is_same<It, typename std::vector<T>::const_iterator>::value> {
+};
+
+template <bool... Bs> struct bool_pack;
+template <bool... Bs>
+using all_true = std::is_same<bool_pack<true, Bs...>, bool_pack<Bs..., true>>;
+
+template <typename W, bool = Traits::is_simd_vector<W>::value> struct entry_type_of {
+    using type = void;
+};
+template <typename W> struct entry_type_of<W, true> {
+    using type = typename W::EntryType;
+};
+
+/**\internal
+ * Loads \p M vectors from \p M * V::Size successive structs of \p M members at \p mem,
+ * using the deinterleave implementation of the backend. SimdArray arguments recurse
+ * into their storage.
+ */
+template <size_t M, typename T, typename V, typename... Vs>
+Vc_INTRINSIC enable_if<!Traits::isSimdArray<V>::value, void> deinterleaveStructs(
+    const T *mem, V &v0, Vs &... vs)
+{
+    Vc::Detail::InterleaveImpl<V, V::Size, sizeof(V)>::deinterleave(
+        mem, Common::SuccessiveEntries<M>(0), v0, vs...);
+}
+template <size_t M, typename T, size_t N, typename V, typename... Vs>
+Vc_INTRINSIC void deinterleaveStructs(const T *mem, SimdArray<T, N, V, N> &v0,
+                                      Vs &... vs)
+{
+    deinterleaveStructs<M>(mem, internal_data(v0), internal_data(vs)...);
+}
+template <size_t M, typename T, size_t N, typename V, size_t VN, typename... Vs>
+Vc_INTRINSIC enable_if<(N != VN), void> deinterleaveStructs(
+    const T *mem, SimdArray<T, N, V, VN> &v0, Vs &... vs)
+{
+    deinterleaveStructs<M>(mem, internal_data0(v0), internal_data0(vs)...);
+    deinterleaveStructs<M>(mem + M * SimdArrayTraits<T, N>::N0, internal_data1(v0),
+                           internal_data1(vs)...);
+}
+
+/**\internal
+ * The inverse of deinterleaveStructs: stores the \p M vectors as V::Size successive
+ * structs of \p M members to \p mem.
+ */
+template <size_t M, typename T, typename V, typename... Vs>
+Vc_INTRINSIC enable_if<!Traits::isSimdArray<V>::value, void> interleaveStructs(
+    T *mem, const V &v0, const Vs &... vs)
+{
+    Vc::Detail::InterleaveImpl<V, V::Size, sizeof(V)>::interleave(
+        mem, Common::SuccessiveEntries<M>(0), v0, vs...);
+}
+template <size_t M, typename T, size_t N, typename V, typename... Vs>
+Vc_INTRINSIC void interleaveStructs(T *mem, const SimdArray<T, N, V, N> &v0,
+                                    const Vs &... vs)
+{
+    interleaveStructs<M>(mem, internal_data(v0), internal_data(vs)...);
+}
+template <size_t M, typename T, size_t N, typename V, size_t VN, typename... Vs>
+Vc_INTRINSIC enable_if<(N != VN), void> interleaveStructs(
+    T *mem, const SimdArray<T, N, V, VN> &v0, const Vs &... vs)
+{
+    interleaveStructs<M>(mem, internal_data0(v0), internal_data0(vs)...);
+    interleaveStructs<M>(mem + M * SimdArrayTraits<T, N>::N0, internal_data1(v0),
+                         internal_data1(vs)...);
+}
+
+/**\internal
+ * Determines whether the simdized type \p A can be loaded from and stored to an array of
+ * its scalar type with a transposition in registers: all members of the scalar struct
+ * must be lvalues of the same arithmetic type, without padding between them, and all
+ * members of \p A must be the same vector type.
+ *
+ * The order of the members in memory does not need to match the tuple order. It is
+ * determined from the addresses the tuple interface returns.
+ */
+template <typename A, typename IndexSeq> struct InterleavedStructAccess {
+    static constexpr bool value = false;
+};
+template <typename S, typename Base, size_t N, size_t... Indexes>
+struct InterleavedStructAccess<Adapter<S, Base, N>, Vc::index_sequence<Indexes...>> {
+private:
+    using A = Adapter<S, Base, N>;
+    using W = Traits::decay<decltype(get_dispatcher<0>(std::declval<A &>()))>;
+    using T = typename entry_type_of<W>::type;
+    static constexpr size_t M = sizeof...(Indexes);
+
+public:
+    static constexpr bool value =
+        M >= 2 && M <= 8 && !std::is_void<T>::value &&
+        sizeof(S) == M * sizeof(typename std::conditional<std::is_void<T>::value, char,
+                                                           T>::type) &&
+        all_true<std::is_same<
+            W, Traits::decay<decltype(get_dispatcher<Indexes>(std::declval<A &>()))>>::value...>::value &&
+        all_true<std::is_same<typename std::add_lvalue_reference<T>::type,
+                              decltype(get_dispatcher<Indexes>(
+                                  std::declval<S &>()))>::value...>::value;
+
+    static Vc_INTRINSIC A load(const S &first)
+    {
+        const T *mem = reinterpret_cast<const T *>(std::addressof(first));
+        W tmp[M];
+        deinterleaveStructs<M>(mem, tmp[Indexes]...);
+        A r;
+        auto &&unused = {(get_dispatcher<Indexes>(r) =
+                              tmp[std::addressof(get_dispatcher<Indexes>(first)) - mem],
+                          0)...};
+        if (&unused == &unused) {}
+        return r;
+    }
+
+    static Vc_INTRINSIC void store(S &first, const A &x)
+    {
+        T *mem = reinterpret_cast<T *>(std::addressof(first));
+        W tmp[M];
+        auto &&unused = {(tmp[std::addressof(get_dispatcher<Indexes>(first)) - mem] =
+                              get_dispatcher<Indexes>(x),
+                          0)...};
+        if (&unused == &unused) {}
+        interleaveStructs<M>(mem, tmp[Indexes]...);
+    }
+};
+
+/**\internal
+ * Selects the strategy for converting between the scalar objects referenced by \p It and
+ * the simdized object \p V:
+ * \li \c Vector for plain vector/SimdArray types and contiguous iterators (unaligned
+ * load/store),
+ * \li \c Interleaved for simdized structs (see InterleavedStructAccess) and contiguous
+ * iterators,
+ * \li \c Scalar otherwise, which copies the scalar objects one at a time.
+ */
+enum class Access { Scalar, Vector, Interleaved };
+template <typename V> struct is_interleavable : public std::false_type {
+};
+template <typename S, typename Base, size_t N>
+struct is_interleavable<Adapter<S, Base, N>>
+    : public std::integral_constant<
+          bool, InterleavedStructAccess<Adapter<S, Base, N>,
+                                        Vc::make_index_sequence<
+                                            determine_tuple_size<S>()>>::value> {
+};
+template <typename It, typename V, bool = is_contiguous_iterator<It>::value>
+struct access_strategy : public std::integral_constant<Access, Access::Scalar> {
+};
 template <typename It, typename V>
-Vc_INTRINSIC V fromIterator(enable_if<!Traits::is_simd_vector<V>::value, const It &> it)
+struct access_strategy<It, V, true>
+    : public std::integral_constant<
+          Access, std::is_same<typename std::iterator_traits<It>::value_type,
+                               typename entry_type_of<V>::type>::value
+                      ? Access::Vector
+                      : is_interleavable<V>::value ? Access::Interleaved
+                                                   : Access::Scalar> {
+};
+template <Access A> using access_tag = std::integral_constant<Access, A>;
+// }}}
+
+template <typename It, typename V>
+Vc_INTRINSIC V fromIterator(const It &it, access_tag<Access::Scalar>,
+                            enable_if<!Traits::is_simd_vector<V>::value> = nullarg)
 {
     return fromIteratorImpl<It, V, 0, determine_tuple_size<V>()>(it);
 }
 template <typename It, typename V>
-Vc_INTRINSIC V fromIterator(enable_if<Traits::is_simd_vector<V>::value, It> it)
+Vc_INTRINSIC V fromIterator(It it, access_tag<Access::Scalar>,
+                            enable_if<Traits::is_simd_vector<V>::value> = nullarg)
 {
     V r;
     for (size_t j = 0; j < V::size(); ++j, ++it) {
@@ -1232,6 +1402,47 @@ Vc_INTRINSIC V fromIterator(enable_if<Traits::is_simd_vector<V>::value, It> it)
     }
     return r;
 }
+template <typename It, typename V>
+Vc_INTRINSIC V fromIterator(const It &it, access_tag<Access::Vector>)
+{
+    return V(std::addressof(*it), Vc::Unaligned);
+}
+template <typename It, typename V>
+Vc_INTRINSIC V fromIterator(const It &it, access_tag<Access::Interleaved>)
+{
+    return InterleavedStructAccess<V, Vc::make_index_sequence<determine_tuple_size<
+                                          typename V::scalar_type>()>>::load(*it);
+}
+template <typename It, typename V> Vc_INTRINSIC V fromIterator(const It &it)
+{
+    return fromIterator<It, V>(it, access_tag<access_strategy<It, V>::value>());
+}
+
+template <typename It, typename V>
+Vc_INTRINSIC void toIterator(It it, const V &x, access_tag<Access::Scalar>)
+{
+    for (size_t i = 0; i < V::size(); ++i, ++it) {
+        *it = extract(x, i);
+    }
+}
+template <typename It, typename V>
+Vc_INTRINSIC void toIterator(const It &it, const V &x, access_tag<Access::Vector>)
+{
+    x.store(std::addressof(*it), Vc::Unaligned);
+}
+template <typename It, typename V>
+Vc_INTRINSIC void toIterator(const It &it, const V &x, access_tag<Access::Interleaved>)
+{
+    InterleavedStructAccess<V, Vc::make_index_sequence<determine_tuple_size<
+                                   typename V::scalar_type>()>>::store(*it, x);
+}
+/**\internal
+ * Writes the entries of \p x to the V::size() scalar objects starting at \p it.
+ */
+template <typename It, typename V> Vc_INTRINSIC void toIterator(const It &it, const V &x)
+{
+    toIterator(it, x, access_tag<access_strategy<It, V>::value>());
+}
 
 // Note: §13.5.6 says: “An expression x->m is interpreted as (x.operator->())->m for a
 // class object x of type T if T::operator->() exists and if the operator is selected as
@@ -1274,9 +1485,7 @@ public:
     ~Pointer()
     {
         // store data back to where it came from
-        for (size_t i = 0; i < Size; ++i, ++begin_iterator) {
-            *begin_iterator = extract(data, i);
-        }
+        toIterator(begin_iterator, data);
     }
 
     /// Construct the Pointer object from the values returned by the scalar iterator \p it.
@@ -1358,10 +1567,7 @@ public:
     void operator=(const value_vector &x)
     {
         static_cast<value_vector &>(*this) = x;
-        auto it = scalar_it;
-        for (size_t i = 0; i < Size; ++i, ++it) {
-            *it = extract(x, i);
-        }
+        toIterator(scalar_it, x);
     }
 };
 #define Vc_OP(op_)                                                                       \
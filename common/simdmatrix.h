@@ -0,0 +1,504 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_SIMDMATRIX_H_
+#define VC_COMMON_SIMDMATRIX_H_
+
+#include <array>
+#include <cstddef>
+#include <Vc/type_traits>
+#include "polynomial.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+/**
+ * \ingroup Utilities
+ *
+ * A batch of `V::size()` independent \p Rows x \p Cols matrices in structure-of-arrays
+ * layout: every entry of the matrix is one vector \p V, and lane \c i of all entries
+ * together forms the \c i-th matrix. All operations work on all matrices of the batch
+ * concurrently, without any horizontal operations, and thus use the full vector width
+ * for small matrices, where one matrix per vector would leave most lanes idle.
+ *
+ * \p V can be any floating-point Vc::Vector or Vc::SimdArray type. Column vectors are
+ * represented as `std::array<V, N>`, which is also the base class of
+ * `simdize<std::array<T, N>>`.
+ *
+ * \code
+ * using M = Vc::SimdMatrix<Vc::float_v, 3>;
+ * for (std::size_t i = 0; i < n; i += M::size()) {
+ *     const M m(&matrices[i][0][0]);  // row-major float[n][3][3]
+ *     determinant(m).store(&dets[i], Vc::Unaligned);
+ *     inverse(m).store(&inverses[i][0][0]);
+ * }
+ * \endcode
+ *
+ * \see SimdQuaternion
+ */
+template <typename V, std::size_t Rows, std::size_t Cols = Rows> class SimdMatrix
+{
+    static_assert(Traits::is_simd_vector<V>::value,
+                  "SimdMatrix requires a Vc::Vector or Vc::SimdArray entry type");
+
+public:
+    using value_type = V;
+    using EntryType = typename V::EntryType;
+    using IndexType = typename V::IndexType;
+
+    /// The number of matrices in the batch.
+    static constexpr std::size_t size() { return V::size(); }
+    /// The number of rows.
+    static constexpr std::size_t rows() { return Rows; }
+    /// The number of columns.
+    static constexpr std::size_t cols() { return Cols; }
+
+    /// Leaves the entries uninitialized.
+    SimdMatrix() = default;
+
+    /// Loads `size()` consecutive row-major \p Rows x \p Cols matrices from \p mem.
+    explicit Vc_INTRINSIC SimdMatrix(const EntryType *mem) { load(mem); }
+
+    /// Returns a batch of zero matrices.
+    static Vc_INTRINSIC SimdMatrix Zero()
+    {
+        SimdMatrix r;
+        for (std::size_t i = 0; i < Rows; ++i) {
+            for (std::size_t j = 0; j < Cols; ++j) {
+                r.m_data[i][j] = V::Zero();
+            }
+        }
+        return r;
+    }
+
+    /// Returns a batch of identity matrices.
+    static Vc_INTRINSIC SimdMatrix Identity()
+    {
+        SimdMatrix r = Zero();
+        for (std::size_t i = 0; i < Rows && i < Cols; ++i) {
+            r.m_data[i][i] = V::One();
+        }
+        return r;
+    }
+
+    /// Loads `size()` consecutive row-major \p Rows x \p Cols matrices from \p mem.
+    Vc_INTRINSIC void load(const EntryType *mem)
+    {
+        const IndexType indexes = IndexType::IndexesFromZero() * int(Rows * Cols);
+        for (std::size_t i = 0; i < Rows; ++i) {
+            for (std::size_t j = 0; j < Cols; ++j) {
+                m_data[i][j] = V(mem + i * Cols + j, indexes);
+            }
+        }
+    }
+
+    /// Stores the matrices as `size()` consecutive row-major matrices to \p mem.
+    Vc_INTRINSIC void store(EntryType *mem) const
+    {
+        const IndexType indexes = IndexType::IndexesFromZero() * int(Rows * Cols);
+        for (std::size_t i = 0; i < Rows; ++i) {
+            for (std::size_t j = 0; j < Cols; ++j) {
+                m_data[i][j].scatter(mem + i * Cols + j, indexes);
+            }
+        }
+    }
+
+    /// Returns the entry in row \p i and column \p j of all matrices.
+    Vc_INTRINSIC V &operator()(std::size_t i, std::size_t j) { return m_data[i][j]; }
+    /// \copydoc operator()(std::size_t, std::size_t)
+    Vc_INTRINSIC const V &operator()(std::size_t i, std::size_t j) const
+    {
+        return m_data[i][j];
+    }
+
+    Vc_INTRINSIC SimdMatrix &operator+=(const SimdMatrix &x)
+    {
+        for (std::size_t i = 0; i < Rows; ++i) {
+            for (std::size_t j = 0; j < Cols; ++j) {
+                m_data[i][j] += x.m_data[i][j];
+            }
+        }
+        return *this;
+    }
+    Vc_INTRINSIC SimdMatrix &operator-=(const SimdMatrix &x)
+    {
+        for (std::size_t i = 0; i < Rows; ++i) {
+            for (std::size_t j = 0; j < Cols; ++j) {
+                m_data[i][j] -= x.m_data[i][j];
+            }
+        }
+        return *this;
+    }
+    /// Multiplies matrix \c i with lane \c i of \p x.
+    Vc_INTRINSIC SimdMatrix &operator*=(const V &x)
+    {
+        for (std::size_t i = 0; i < Rows; ++i) {
+            for (std::size_t j = 0; j < Cols; ++j) {
+                m_data[i][j] *= x;
+            }
+        }
+        return *this;
+    }
+
+    friend Vc_INTRINSIC SimdMatrix operator+(SimdMatrix a, const SimdMatrix &b)
+    {
+        return a += b;
+    }
+    friend Vc_INTRINSIC SimdMatrix operator-(SimdMatrix a, const SimdMatrix &b)
+    {
+        return a -= b;
+    }
+    friend Vc_INTRINSIC SimdMatrix operator*(SimdMatrix a, const V &x) { return a *= x; }
+    friend Vc_INTRINSIC SimdMatrix operator*(const V &x, SimdMatrix a) { return a *= x; }
+
+private:
+    V m_data[Rows][Cols];
+};
+
+// products {{{1
+/**
+ * Returns the matrix products `a * b` of all matrices in the batch.
+ */
+template <typename V, std::size_t R, std::size_t K, std::size_t C>
+inline SimdMatrix<V, R, C> operator*(const SimdMatrix<V, R, K> &a,
+                                     const SimdMatrix<V, K, C> &b)
+{
+    SimdMatrix<V, R, C> r;
+    for (std::size_t i = 0; i < R; ++i) {
+        for (std::size_t j = 0; j < C; ++j) {
+            V sum = a(i, 0) * b(0, j);
+            for (std::size_t k = 1; k < K; ++k) {
+                sum = Detail::muladd(a(i, k), b(k, j), sum);
+            }
+            r(i, j) = sum;
+        }
+    }
+    return r;
+}
+
+/**
+ * Returns the matrix-vector products `a * x` of all matrices and column vectors in the
+ * batch.
+ */
+template <typename V, std::size_t R, std::size_t C>
+inline std::array<V, R> operator*(const SimdMatrix<V, R, C> &a, const std::array<V, C> &x)
+{
+    std::array<V, R> r;
+    for (std::size_t i = 0; i < R; ++i) {
+        V sum = a(i, 0) * x[0];
+        for (std::size_t k = 1; k < C; ++k) {
+            sum = Detail::muladd(a(i, k), x[k], sum);
+        }
+        r[i] = sum;
+    }
+    return r;
+}
+
+// transpose {{{1
+/**
+ * Returns the transposed matrices.
+ */
+template <typename V, std::size_t R, std::size_t C>
+inline SimdMatrix<V, C, R> transpose(const SimdMatrix<V, R, C> &a)
+{
+    SimdMatrix<V, C, R> r;
+    for (std::size_t i = 0; i < R; ++i) {
+        for (std::size_t j = 0; j < C; ++j) {
+            r(j, i) = a(i, j);
+        }
+    }
+    return r;
+}
+
+// determinant {{{1
+/**
+ * Returns the determinants of the matrices in the batch. Implemented for sizes up to 4.
+ */
+template <typename V> Vc_INTRINSIC V determinant(const SimdMatrix<V, 1> &a)
+{
+    return a(0, 0);
+}
+template <typename V> Vc_INTRINSIC V determinant(const SimdMatrix<V, 2> &a)
+{
+    return a(0, 0) * a(1, 1) - a(0, 1) * a(1, 0);
+}
+template <typename V> inline V determinant(const SimdMatrix<V, 3> &a)
+{
+    return a(0, 0) * (a(1, 1) * a(2, 2) - a(1, 2) * a(2, 1)) +
+           a(0, 1) * (a(1, 2) * a(2, 0) - a(1, 0) * a(2, 2)) +
+           a(0, 2) * (a(1, 0) * a(2, 1) - a(1, 1) * a(2, 0));
+}
+
+namespace Detail
+{
+/**\internal
+ * The 2x2 minors of the upper (\c s) and lower (\c c) two rows of a 4x4 matrix, which
+ * the Laplace expansion of the determinant and the adjugate share.
+ */
+template <typename V> struct Minors4 {
+    V s[6], c[6];
+    explicit Vc_INTRINSIC Minors4(const SimdMatrix<V, 4> &a)
+    {
+        s[0] = a(0, 0) * a(1, 1) - a(1, 0) * a(0, 1);
+        s[1] = a(0, 0) * a(1, 2) - a(1, 0) * a(0, 2);
+        s[2] = a(0, 0) * a(1, 3) - a(1, 0) * a(0, 3);
+        s[3] = a(0, 1) * a(1, 2) - a(1, 1) * a(0, 2);
+        s[4] = a(0, 1) * a(1, 3) - a(1, 1) * a(0, 3);
+        s[5] = a(0, 2) * a(1, 3) - a(1, 2) * a(0, 3);
+        c[5] = a(2, 2) * a(3, 3) - a(3, 2) * a(2, 3);
+        c[4] = a(2, 1) * a(3, 3) - a(3, 1) * a(2, 3);
+        c[3] = a(2, 1) * a(3, 2) - a(3, 1) * a(2, 2);
+        c[2] = a(2, 0) * a(3, 3) - a(3, 0) * a(2, 3);
+        c[1] = a(2, 0) * a(3, 2) - a(3, 0) * a(2, 2);
+        c[0] = a(2, 0) * a(3, 1) - a(3, 0) * a(2, 1);
+    }
+    Vc_INTRINSIC V determinant() const
+    {
+        return s[0] * c[5] - s[1] * c[4] + s[2] * c[3] + s[3] * c[2] - s[4] * c[1] +
+               s[5] * c[0];
+    }
+};
+}  // namespace Detail
+
+template <typename V> inline V determinant(const SimdMatrix<V, 4> &a)
+{
+    return Detail::Minors4<V>(a).determinant();
+}
+
+// inverse {{{1
+/**
+ * Returns the inverses of the matrices in the batch, computed from the adjugate.
+ * Implemented for sizes up to 4. The lanes of singular matrices contain infinities or
+ * NaNs; test `determinant(a) != 0` beforehand if that can happen.
+ */
+template <typename V> Vc_INTRINSIC SimdMatrix<V, 1> inverse(const SimdMatrix<V, 1> &a)
+{
+    SimdMatrix<V, 1> r;
+    r(0, 0) = V::One() / a(0, 0);
+    return r;
+}
+template <typename V> inline SimdMatrix<V, 2> inverse(const SimdMatrix<V, 2> &a)
+{
+    const V invDet = V::One() / determinant(a);
+    SimdMatrix<V, 2> r;
+    r(0, 0) = a(1, 1) * invDet;
+    r(0, 1) = -a(0, 1) * invDet;
+    r(1, 0) = -a(1, 0) * invDet;
+    r(1, 1) = a(0, 0) * invDet;
+    return r;
+}
+template <typename V> inline SimdMatrix<V, 3> inverse(const SimdMatrix<V, 3> &a)
+{
+    SimdMatrix<V, 3> r;
+    r(0, 0) = a(1, 1) * a(2, 2) - a(1, 2) * a(2, 1);
+    r(1, 0) = a(1, 2) * a(2, 0) - a(1, 0) * a(2, 2);
+    r(2, 0) = a(1, 0) * a(2, 1) - a(1, 1) * a(2, 0);
+    const V invDet =
+        V::One() / (a(0, 0) * r(0, 0) + a(0, 1) * r(1, 0) + a(0, 2) * r(2, 0));
+    r(0, 0) *= invDet;
+    r(1, 0) *= invDet;
+    r(2, 0) *= invDet;
+    r(0, 1) = (a(0, 2) * a(2, 1) - a(0, 1) * a(2, 2)) * invDet;
+    r(1, 1) = (a(0, 0) * a(2, 2) - a(0, 2) * a(2, 0)) * invDet;
+    r(2, 1) = (a(0, 1) * a(2, 0) - a(0, 0) * a(2, 1)) * invDet;
+    r(0, 2) = (a(0, 1) * a(1, 2) - a(0, 2) * a(1, 1)) * invDet;
+    r(1, 2) = (a(0, 2) * a(1, 0) - a(0, 0) * a(1, 2)) * invDet;
+    r(2, 2) = (a(0, 0) * a(1, 1) - a(0, 1) * a(1, 0)) * invDet;
+    return r;
+}
+template <typename V> inline SimdMatrix<V, 4> inverse(const SimdMatrix<V, 4> &a)
+{
+    const Detail::Minors4<V> m(a);
+    const V *s = m.s;
+    const V *c = m.c;
+    const V invDet = V::One() / m.determinant();
+    SimdMatrix<V, 4> r;
+    r(0, 0) = (a(1, 1) * c[5] - a(1, 2) * c[4] + a(1, 3) * c[3]) * invDet;
+    r(0, 1) = (a(0, 2) * c[4] - a(0, 1) * c[5] - a(0, 3) * c[3]) * invDet;
+    r(0, 2) = (a(3, 1) * s[5] - a(3, 2) * s[4] + a(3, 3) * s[3]) * invDet;
+    r(0, 3) = (a(2, 2) * s[4] - a(2, 1) * s[5] - a(2, 3) * s[3]) * invDet;
+    r(1, 0) = (a(1, 2) * c[2] - a(1, 0) * c[5] - a(1, 3) * c[1]) * invDet;
+    r(1, 1) = (a(0, 0) * c[5] - a(0, 2) * c[2] + a(0, 3) * c[1]) * invDet;
+    r(1, 2) = (a(3, 2) * s[2] - a(3, 0) * s[5] - a(3, 3) * s[1]) * invDet;
+    r(1, 3) = (a(2, 0) * s[5] - a(2, 2) * s[2] + a(2, 3) * s[1]) * invDet;
+    r(2, 0) = (a(1, 0) * c[4] - a(1, 1) * c[2] + a(1, 3) * c[0]) * invDet;
+    r(2, 1) = (a(0, 1) * c[2] - a(0, 0) * c[4] - a(0, 3) * c[0]) * invDet;
+    r(2, 2) = (a(3, 0) * s[4] - a(3, 1) * s[2] + a(3, 3) * s[0]) * invDet;
+    r(2, 3) = (a(2, 1) * s[2] - a(2, 0) * s[4] - a(2, 3) * s[0]) * invDet;
+    r(3, 0) = (a(1, 1) * c[1] - a(1, 0) * c[3] - a(1, 2) * c[0]) * invDet;
+    r(3, 1) = (a(0, 0) * c[3] - a(0, 1) * c[1] + a(0, 2) * c[0]) * invDet;
+    r(3, 2) = (a(3, 1) * s[1] - a(3, 0) * s[3] - a(3, 2) * s[0]) * invDet;
+    r(3, 3) = (a(2, 0) * s[3] - a(2, 1) * s[1] + a(2, 2) * s[0]) * invDet;
+    return r;
+}
+
+// solve {{{1
+/**
+ * Returns the solutions \c x of the linear systems `a * x = b`, using Gaussian
+ * elimination with partial pivoting. The pivot rows are chosen per lane, so every matrix
+ * of the batch is pivoted independently. The lanes of singular systems contain
+ * infinities or NaNs.
+ */
+template <typename V, std::size_t N>
+inline std::array<V, N> solve(SimdMatrix<V, N> a, std::array<V, N> b)
+{
+    for (std::size_t k = 0; k < N; ++k) {
+        for (std::size_t i = k + 1; i < N; ++i) {
+            const auto swap = abs(a(i, k)) > abs(a(k, k));
+            for (std::size_t j = k; j < N; ++j) {
+                const V tmp = a(k, j);
+                a(k, j) = iif(swap, a(i, j), tmp);
+                a(i, j) = iif(swap, tmp, a(i, j));
+            }
+            const V tmp = b[k];
+            b[k] = iif(swap, b[i], tmp);
+            b[i] = iif(swap, tmp, b[i]);
+        }
+        const V invPivot = V::One() / a(k, k);
+        for (std::size_t i = k + 1; i < N; ++i) {
+            const V f = a(i, k) * invPivot;
+            for (std::size_t j = k + 1; j < N; ++j) {
+                a(i, j) -= f * a(k, j);
+            }
+            b[i] -= f * b[k];
+        }
+    }
+    std::array<V, N> x;
+    for (std::size_t k = N; k-- > 0;) {
+        V sum = b[k];
+        for (std::size_t j = k + 1; j < N; ++j) {
+            sum -= a(k, j) * x[j];
+        }
+        x[k] = sum / a(k, k);
+    }
+    return x;
+}
+
+// SimdQuaternion {{{1
+/**
+ * \ingroup Utilities
+ *
+ * A batch of `V::size()` quaternions `w + x i + y j + z k` in structure-of-arrays
+ * layout, with the operations needed to compose and apply rotations. 3-D vectors are
+ * represented as `std::array<V, 3>`, as for SimdMatrix.
+ */
+template <typename V> class SimdQuaternion
+{
+    static_assert(Traits::is_simd_vector<V>::value,
+                  "SimdQuaternion requires a Vc::Vector or Vc::SimdArray entry type");
+
+public:
+    using value_type = V;
+
+    V w, x, y, z;
+
+    /// Leaves the components uninitialized.
+    SimdQuaternion() = default;
+    Vc_INTRINSIC SimdQuaternion(const V &w_, const V &x_, const V &y_, const V &z_)
+        : w(w_), x(x_), y(y_), z(z_)
+    {
+    }
+
+    /// Returns the identity rotation.
+    static Vc_INTRINSIC SimdQuaternion Identity()
+    {
+        return {V::One(), V::Zero(), V::Zero(), V::Zero()};
+    }
+
+    /**
+     * Returns the rotations by \p angle (in radians) around the unit vectors \p axis.
+     */
+    static Vc_INTRINSIC SimdQuaternion fromAxisAngle(const std::array<V, 3> &axis,
+                                                     const V &angle)
+    {
+        V s, c;
+        sincos(angle * V(0.5), &s, &c);
+        return {c, axis[0] * s, axis[1] * s, axis[2] * s};
+    }
+
+    /// Returns the conjugated quaternions, i.e. the inverse rotations.
+    Vc_INTRINSIC SimdQuaternion conjugate() const { return {w, -x, -y, -z}; }
+
+    /// Returns the squared norms.
+    Vc_INTRINSIC V norm2() const { return w * w + x * x + y * y + z * z; }
+    /// Returns the norms.
+    Vc_INTRINSIC V norm() const { return sqrt(norm2()); }
+    /// Returns the quaternions scaled to unit norm.
+    Vc_INTRINSIC SimdQuaternion normalized() const
+    {
+        const V f = V::One() / norm();
+        return {w * f, x * f, y * f, z * f};
+    }
+
+    /// Returns the Hamilton products `a * b`, i.e. the rotation \p b followed by \p a.
+    friend Vc_INTRINSIC SimdQuaternion operator*(const SimdQuaternion &a,
+                                                 const SimdQuaternion &b)
+    {
+        return {a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z,
+                a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y,
+                a.w * b.y - a.x * b.z + a.y * b.w + a.z * b.x,
+                a.w * b.z + a.x * b.y - a.y * b.x + a.z * b.w};
+    }
+
+    /**
+     * Returns the vectors \p v rotated by the unit quaternions.
+     */
+    Vc_INTRINSIC std::array<V, 3> rotate(const std::array<V, 3> &v) const
+    {
+        // v + 2 w (u × v) + 2 u × (u × v), with u = (x, y, z)
+        const V tx = V(2) * (y * v[2] - z * v[1]);
+        const V ty = V(2) * (z * v[0] - x * v[2]);
+        const V tz = V(2) * (x * v[1] - y * v[0]);
+        return {{v[0] + w * tx + (y * tz - z * ty), v[1] + w * ty + (z * tx - x * tz),
+                 v[2] + w * tz + (x * ty - y * tx)}};
+    }
+
+    /**
+     * Returns the rotation matrices of the unit quaternions.
+     */
+    Vc_INTRINSIC SimdMatrix<V, 3> toMatrix() const
+    {
+        const V two(2);
+        SimdMatrix<V, 3> r;
+        r(0, 0) = V::One() - two * (y * y + z * z);
+        r(0, 1) = two * (x * y - w * z);
+        r(0, 2) = two * (x * z + w * y);
+        r(1, 0) = two * (x * y + w * z);
+        r(1, 1) = V::One() - two * (x * x + z * z);
+        r(1, 2) = two * (y * z - w * x);
+        r(2, 0) = two * (x * z - w * y);
+        r(2, 1) = two * (y * z + w * x);
+        r(2, 2) = V::One() - two * (x * x + y * y);
+        return r;
+    }
+};
+//}}}1
+}  // namespace Vc
+
+#endif  // VC_COMMON_SIMDMATRIX_H_
+
+// vim: foldmethod=marker
@@ -0,0 +1,497 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2016 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_SOA_VECTOR_H_
+#define VC_COMMON_SOA_VECTOR_H_
+
+#include <cstring>
+#include <tuple>
+#include <utility>
+#include "simdize.h"
+#include "malloc.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace SimdizeDetail
+{
+/**\addtogroup Simdize
+ * @{
+ */
+///\internal The type of the member \p I of the tuple-like type \p T.
+template <typename T, size_t I>
+using member_type = Traits::decay<decltype(get_dispatcher<I>(std::declval<T &>()))>;
+
+/**\internal
+ * Constructs \p B from \p args, using parenthesis if possible and braces otherwise.
+ */
+template <typename B, typename... Args>
+Vc_INTRINSIC B construct_from(std::true_type, Args &&... args)
+{
+    return B(std::forward<Args>(args)...);
+}
+template <typename B, typename... Args>
+Vc_INTRINSIC B construct_from(std::false_type, Args &&... args)
+{
+    return B{std::forward<Args>(args)...};
+}
+template <typename B, typename... Args> Vc_INTRINSIC B construct_from(Args &&... args)
+{
+    return construct_from<B>(
+        std::integral_constant<bool,
+                               is_constructible_with_single_paren<B, Args...>::value>(),
+        std::forward<Args>(args)...);
+}
+
+/**\internal
+ * Base class of soa_vector references without member access.
+ */
+struct NoReferenceBase {
+    template <typename... Ts> NoReferenceBase(Ts &&...) {}
+};
+
+/**\internal
+ * Determines the base class of soa_vector<T>::reference. For \p T = C<Ts...> with
+ * arithmetic \p Ts the base class is C<Ts &...> (or C<const Ts &...>), if it can be
+ * constructed from references to the members of \p T. The reference then supports the
+ * member access of \p T (e.g. `v[i].x`).
+ */
+template <typename T, bool Const, typename IndexSeq> struct reference_base {
+    using type = NoReferenceBase;
+};
+template <template <typename...> class C, typename... Ts, bool Const, size_t... Indexes>
+struct reference_base<C<Ts...>, Const, Vc::index_sequence<Indexes...>> {
+    template <typename U>
+    using ref = typename std::conditional<Const, const U &, U &>::type;
+    using R = C<ref<Ts>...>;
+    using type = typename std::conditional<
+        IteratorDetails::all_true<std::is_arithmetic<Ts>::value...>::value &&
+            (is_constructible_with_single_paren<R, ref<member_type<C<Ts...>, Indexes>>...>::value ||
+             is_constructible_with_single_brace<R, ref<member_type<C<Ts...>, Indexes>>...>::value),
+        R, NoReferenceBase>::type;
+};
+
+/**\internal
+ * Proxy for one scalar object of type \p T stored in the member arrays of a soa_vector.
+ * It converts to \p T, and assigning a \p T writes all members.
+ */
+template <typename T, bool Const,
+          typename IndexSeq = Vc::make_index_sequence<determine_tuple_size<T>()>>
+class SoaScalarReference;
+template <typename T, bool Const, size_t... Indexes>
+class SoaScalarReference<T, Const, Vc::index_sequence<Indexes...>>
+    : public reference_base<T, Const, Vc::index_sequence<Indexes...>>::type
+{
+    using Base = typename reference_base<T, Const, Vc::index_sequence<Indexes...>>::type;
+    template <typename U>
+    using pointer = typename std::conditional<Const, const U *, U *>::type;
+    using Pointers = std::tuple<pointer<member_type<T, Indexes>>...>;
+
+    Pointers m_ptr;
+
+public:
+    SoaScalarReference(const Pointers &arrays, size_t i)
+        : Base(construct_from<Base>(std::get<Indexes>(arrays)[i]...))
+        , m_ptr(std::get<Indexes>(arrays) + i...)
+    {
+    }
+
+    SoaScalarReference(const SoaScalarReference &) = default;
+
+    /// Returns a copy of the referenced object.
+    operator T() const { return construct_from<T>(*std::get<Indexes>(m_ptr)...); }
+
+    /// Assigns all members of \p value to the referenced object.
+    SoaScalarReference &operator=(const T &value)
+    {
+        auto &&unused = {
+            (*std::get<Indexes>(m_ptr) = get_dispatcher<Indexes>(value), 0)...};
+        if (&unused == &unused) {}
+        return *this;
+    }
+    /// Assigns the object referenced by \p rhs to the referenced object.
+    SoaScalarReference &operator=(const SoaScalarReference &rhs)
+    {
+        return operator=(static_cast<T>(rhs));
+    }
+};
+
+/**\internal
+ * Load/store flags for the packets of the member arrays of a soa_vector. A packet of
+ * type \p W starts at a multiple of W::Size entries from an address aligned on 64 bytes.
+ */
+template <typename W>
+using packet_flags = typename std::conditional<
+    (W::Size * sizeof(typename W::EntryType)) % W::MemoryAlignment == 0, AlignedTag,
+    UnalignedTag>::type;
+
+/**\internal
+ * Loads the packet of type \p V at \p offset from the member arrays in \p arrays.
+ * The packet is constructed from the member vectors (like the scalar type is
+ * constructed from its members), thus V does not need to be default constructible.
+ */
+template <typename V, typename Pointers, size_t... Indexes>
+Vc_INTRINSIC V load_packet(const Pointers &arrays, size_t offset,
+                           Vc::index_sequence<Indexes...>)
+{
+    return V(construct_from<typename V::base_type>(member_type<V, Indexes>(
+        std::get<Indexes>(arrays) + offset, packet_flags<member_type<V, Indexes>>())...));
+}
+
+/**\internal
+ * Stores the packet \p p of type \p V to the member arrays in \p arrays at \p offset.
+ */
+template <typename V, typename Pointers, size_t... Indexes>
+Vc_INTRINSIC void store_packet(const V &p, const Pointers &arrays, size_t offset,
+                               Vc::index_sequence<Indexes...>)
+{
+    auto &&unused = {(get_dispatcher<Indexes>(p).store(
+                          std::get<Indexes>(arrays) + offset,
+                          packet_flags<member_type<V, Indexes>>()),
+                      0)...};
+    if (&unused == &unused) {}
+}
+/** @}*/
+}  // namespace SimdizeDetail
+
+/**
+ * \ingroup Simdize
+ *
+ * A growable container of objects of the struct type \p T in structure-of-arrays layout:
+ * every data member of \p T is stored in an array of its own.
+ *
+ * \p T must be simdizable and provide the tuple interface (e.g. via
+ * Vc_SIMDIZE_INTERFACE) to arithmetic data members. The member arrays are aligned on 64
+ * bytes and padded to a multiple of the packet size, so that the container can be
+ * processed one simdize<T, N> packet at a time:
+ * \code
+ * Vc::soa_vector<Point> points;
+ * points.push_back({1.f, 2.f, 3.f});
+ * points[0].x = 2.f;  // scalar access via proxy objects
+ * for (std::size_t k = 0; k < points.packet_count(); ++k) {
+ *     Vc::simdize<Point> p = points.packet(k);
+ *     p.x += p.y;
+ *     points.store_packet(k, p);
+ * }
+ * \endcode
+ * Alternatively, simd_for_each(soa_vector<T, N> &, f) calls \c f with every packet and
+ * writes modified packets back.
+ *
+ * Entries of the last packet beyond size() (the padding) are always zero.
+ *
+ * \tparam T The scalar struct type.
+ * \tparam N The number of entries in one packet. The default of 0 uses the size simdize<T>
+ *           chooses.
+ */
+template <typename T, std::size_t N = 0> class soa_vector
+{
+    using IndexSeq = Vc::make_index_sequence<SimdizeDetail::determine_tuple_size<T>()>;
+    template <std::size_t I> using member_type = SimdizeDetail::member_type<T, I>;
+
+    template <typename Seq> struct Storage;
+    template <std::size_t... Indexes> struct Storage<Vc::index_sequence<Indexes...>> {
+        using type = std::tuple<member_type<Indexes> *...>;
+        using const_type = std::tuple<const member_type<Indexes> *...>;
+        static constexpr bool arithmetic = SimdizeDetail::IteratorDetails::all_true<
+            (std::is_arithmetic<member_type<Indexes>>::value &&
+             !std::is_same<bool, member_type<Indexes>>::value)...>::value;
+    };
+    static_assert(Storage<IndexSeq>::arithmetic,
+                  "soa_vector<T> requires T to consist of arithmetic non-bool members");
+
+public:
+    /// The scalar type stored in the container.
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    /// The vectorized type of one packet of \p T objects.
+    using packet_type = simdize<T, N>;
+    /// Proxy type for modifying scalar objects in the container.
+    using reference = SimdizeDetail::SoaScalarReference<T, false>;
+    /// Proxy type for reading scalar objects in the container.
+    using const_reference = SimdizeDetail::SoaScalarReference<T, true>;
+
+    /// The number of entries in one packet.
+    static constexpr size_type packet_size() { return packet_type::Size; }
+
+    /// Constructs an empty container.
+    soa_vector() = default;
+    /// Constructs a container with \p n value-initialized (zero) objects.
+    explicit soa_vector(size_type n) { resize(n); }
+
+    soa_vector(const soa_vector &rhs) { *this = rhs; }
+    soa_vector(soa_vector &&rhs) noexcept { swap(rhs); }
+    soa_vector &operator=(const soa_vector &rhs)
+    {
+        if (this != &rhs) {
+            clear();
+            reserve(rhs.m_size);
+            copy_members(rhs, 0, rhs.m_size, IndexSeq());
+            m_size = rhs.m_size;
+        }
+        return *this;
+    }
+    soa_vector &operator=(soa_vector &&rhs) noexcept
+    {
+        swap(rhs);
+        return *this;
+    }
+    ~soa_vector() { deallocate(IndexSeq()); }
+
+    /// Exchanges the contents with \p rhs.
+    void swap(soa_vector &rhs) noexcept
+    {
+        std::swap(m_data, rhs.m_data);
+        std::swap(m_size, rhs.m_size);
+        std::swap(m_capacity, rhs.m_capacity);
+    }
+
+    /// Returns the number of objects in the container.
+    size_type size() const { return m_size; }
+    /// Returns whether the container is empty.
+    bool empty() const { return m_size == 0; }
+    /// Returns the number of objects the container can hold without reallocation.
+    size_type capacity() const { return m_capacity; }
+    /// Returns the number of (possibly partially filled) packets.
+    size_type packet_count() const
+    {
+        return (m_size + packet_size() - 1) / packet_size();
+    }
+
+    /// Increases the capacity to at least \p n objects.
+    void reserve(size_type n)
+    {
+        if (n > m_capacity) {
+            reallocate(n, IndexSeq());
+        }
+    }
+    /**
+     * Changes the number of objects to \p n. New objects are value-initialized, i.e. all
+     * their members are zero.
+     */
+    void resize(size_type n)
+    {
+        grow(n);
+        // growing value-initializes the new objects, shrinking zeroes the new padding
+        clear_members(std::min(n, m_size), std::max(n, m_size), IndexSeq());
+        m_size = n;
+    }
+    /// Changes the number of objects to \p n. New objects are copies of \p x.
+    void resize(size_type n, const T &x)
+    {
+        grow(n);
+        if (n < m_size) {
+            clear_members(n, m_size, IndexSeq());
+        }
+        for (size_type i = m_size; i < n; ++i) {
+            reference(m_data, i) = x;
+        }
+        m_size = n;
+    }
+    /// Removes all objects. The capacity is unchanged.
+    void clear()
+    {
+        clear_members(0, m_size, IndexSeq());
+        m_size = 0;
+    }
+
+    /// Appends a copy of \p x. The capacity grows geometrically.
+    void push_back(const T &x)
+    {
+        grow(m_size + 1);
+        reference(m_data, m_size) = x;
+        ++m_size;
+    }
+    /// Removes the last object.
+    void pop_back()
+    {
+        Vc_ASSERT(m_size > 0);
+        --m_size;
+        clear_members(m_size, m_size + 1, IndexSeq());
+    }
+
+    /// Returns a proxy to the object at \p i.
+    reference operator[](size_type i)
+    {
+        Vc_ASSERT(i < m_size);
+        return {m_data, i};
+    }
+    /// Returns a read-only proxy to the object at \p i.
+    const_reference operator[](size_type i) const
+    {
+        Vc_ASSERT(i < m_size);
+        return {typename Storage<IndexSeq>::const_type(m_data), i};
+    }
+
+    /**
+     * Returns a copy of the packet \p k, i.e. the objects `k * packet_size()` to
+     * `(k + 1) * packet_size() - 1`. Entries of the last packet beyond size() are zero. Use
+     * store_packet() to write a modified packet back. The copy is \c const, so that
+     * modifying the temporary (e.g. `v.packet(k).x += 1`) does not compile.
+     */
+    const packet_type packet(size_type k) const
+    {
+        Vc_ASSERT(k < packet_count());
+        return SimdizeDetail::load_packet<packet_type>(m_data, k * packet_size(), IndexSeq());
+    }
+    /**
+     * Stores \p p to the packet \p k. Entries of \p p that fall beyond size() are not
+     * stored, i.e. the padding of the last packet stays zero.
+     */
+    void store_packet(size_type k, const packet_type &p)
+    {
+        Vc_ASSERT(k < packet_count());
+        SimdizeDetail::store_packet(p, m_data, k * packet_size(), IndexSeq());
+        if ((k + 1) * packet_size() > m_size) {
+            clear_members(m_size, (k + 1) * packet_size(), IndexSeq());
+        }
+    }
+
+    /// Returns a pointer to the array of the member \p I.
+    template <std::size_t I> member_type<I> *data() { return std::get<I>(m_data); }
+    /// Returns a pointer to the array of the member \p I.
+    template <std::size_t I> const member_type<I> *data() const
+    {
+        return std::get<I>(m_data);
+    }
+
+private:
+    void grow(size_type n)
+    {
+        if (n > m_capacity) {
+            reallocate(std::max(n, 2 * m_capacity), IndexSeq());
+        }
+    }
+
+    template <std::size_t... Indexes>
+    void reallocate(size_type n, Vc::index_sequence<Indexes...>)
+    {
+        n = (n + packet_size() - 1) / packet_size() * packet_size();
+        typename Storage<IndexSeq>::type data{static_cast<member_type<Indexes> *>(
+            Common::aligned_malloc<64>(n * sizeof(member_type<Indexes>)))...};
+        auto &&unused = {
+            (m_size > 0 ? std::memcpy(std::get<Indexes>(data), std::get<Indexes>(m_data),
+                                      m_size * sizeof(member_type<Indexes>))
+                        : nullptr,
+             // zero the rest so that the padding of the last packet is initialized
+             std::memset(std::get<Indexes>(data) + m_size, 0,
+                         (n - m_size) * sizeof(member_type<Indexes>)),
+             0)...};
+        if (&unused == &unused) {}
+        deallocate(IndexSeq());
+        m_data = data;
+        m_capacity = n;
+    }
+
+    template <std::size_t... Indexes> void deallocate(Vc::index_sequence<Indexes...>)
+    {
+        auto &&unused = {(Common::free(std::get<Indexes>(m_data)), 0)...};
+        if (&unused == &unused) {}
+    }
+
+    template <std::size_t... Indexes>
+    void clear_members(size_type first, size_type last, Vc::index_sequence<Indexes...>)
+    {
+        auto &&unused = {(std::memset(std::get<Indexes>(m_data) + first, 0,
+                                      (last - first) * sizeof(member_type<Indexes>)),
+                          0)...};
+        if (&unused == &unused) {}
+    }
+
+    template <std::size_t... Indexes>
+    void copy_members(const soa_vector &rhs, size_type first, size_type last,
+                      Vc::index_sequence<Indexes...>)
+    {
+        auto &&unused = {(std::memcpy(std::get<Indexes>(m_data) + first,
+                                      std::get<Indexes>(rhs.m_data) + first,
+                                      (last - first) * sizeof(member_type<Indexes>)),
+                          0)...};
+        if (&unused == &unused) {}
+    }
+
+    typename Storage<IndexSeq>::type m_data{};
+    size_type m_size = 0;
+    size_type m_capacity = 0;
+};
+
+/// Exchanges the contents of \p a and \p b.
+template <typename T, std::size_t N>
+inline void swap(soa_vector<T, N> &a, soa_vector<T, N> &b) noexcept
+{
+    a.swap(b);
+}
+
+/**
+ * \ingroup Simdize
+ *
+ * Calls \p f with every packet of \p v. Modifications \p f makes to the packet are written
+ * back. The objects of a partially filled last packet are passed one at a time as
+ * simdize<T, 1> objects, thus \p f needs to accept both types (e.g. a generic lambda).
+ */
+template <typename T, std::size_t N, typename UnaryFunction>
+inline UnaryFunction simd_for_each(soa_vector<T, N> &v, UnaryFunction f)
+{
+    using V = typename soa_vector<T, N>::packet_type;
+    using V1 = simdize<T, 1>;
+    const std::size_t full = v.size() / V::Size;
+    for (std::size_t k = 0; k < full; ++k) {
+        V tmp = v.packet(k);
+        f(tmp);
+        v.store_packet(k, tmp);
+    }
+    for (std::size_t i = full * V::Size; i < v.size(); ++i) {
+        V1 tmp = static_cast<T>(v[i]);
+        f(tmp);
+        v[i] = SimdizeDetail::extract(tmp, 0);
+    }
+    return f;
+}
+/**
+ * \ingroup Simdize
+ *
+ * Calls \p f with a copy of every packet of \p v. The objects of a partially filled last
+ * packet are passed one at a time as simdize<T, 1> objects.
+ */
+template <typename T, std::size_t N, typename UnaryFunction>
+inline UnaryFunction simd_for_each(const soa_vector<T, N> &v, UnaryFunction f)
+{
+    using V = typename soa_vector<T, N>::packet_type;
+    using V1 = simdize<T, 1>;
+    const std::size_t full = v.size() / V::Size;
+    for (std::size_t k = 0; k < full; ++k) {
+        f(v.packet(k));
+    }
+    for (std::size_t i = full * V::Size; i < v.size(); ++i) {
+        f(V1(static_cast<T>(v[i])));
+    }
+    return f;
+}
+}  // namespace Vc
+
+#endif  // VC_COMMON_SOA_VECTOR_H_
+
+// vim: foldmethod=marker
@@ -0,0 +1,526 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_STENCIL_H_
+#define VC_COMMON_STENCIL_H_
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <tuple>
+#include <vector>
+#include <Vc/cpuid.h>
+#include <Vc/Allocator>
+#include "indexsequence.h"
+#include "polynomial.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+/**\internal
+ * Returns the \p i-th of the remaining arguments, or zero if there are not enough.
+ */
+constexpr int nthOffset(std::size_t) { return 0; }
+template <typename... Ts>
+constexpr int nthOffset(std::size_t i, int first, Ts... rest)
+{
+    return i == 0 ? first : nthOffset(i - 1, rest...);
+}
+}  // namespace Detail
+
+// StencilPoint {{{1
+/**
+ * \ingroup Utilities
+ *
+ * One point of a Stencil: the compile-time offsets \p Offsets of the neighbour along the
+ * grid axes, starting with the contiguous axis 0.
+ */
+template <int... Offsets> struct StencilPoint {
+    /// The number of axes.
+    static constexpr std::size_t dimensions() { return sizeof...(Offsets); }
+    /// Returns the offset along \p axis.
+    static constexpr int offset(std::size_t axis)
+    {
+        return Detail::nthOffset(axis, Offsets...);
+    }
+    /// Returns the largest absolute offset along \p axis.
+    static constexpr int radius(std::size_t axis)
+    {
+        return offset(axis) < 0 ? -offset(axis) : offset(axis);
+    }
+};
+
+// Stencil {{{1
+/**
+ * \ingroup Utilities
+ *
+ * A linear stencil: the weighted sum of the grid values at the neighbour offsets given by
+ * the StencilPoint types \p Points, with one coefficient per point. The offsets are part
+ * of the type, so that the neighbour accesses compile to aligned vector loads combined
+ * with Vector::shifted(int, Vector) instead of unaligned loads. The coefficients are
+ * runtime values.
+ *
+ * \code
+ * using Vc::StencilPoint;
+ * // 2-D five-point Laplacian
+ * const Vc::Stencil<float, StencilPoint<0, 0>, StencilPoint<-1, 0>, StencilPoint<1, 0>,
+ *                   StencilPoint<0, -1>, StencilPoint<0, 1>>
+ *     laplace(-4.f, 1.f, 1.f, 1.f, 1.f);
+ * Vc::simd_stencil(laplace, in, out);
+ * \endcode
+ *
+ * \see PaddedGrid, simd_stencil, simd_stencil_steps
+ */
+template <typename T, typename... Points> class Stencil
+{
+    static_assert(sizeof...(Points) > 0, "a Stencil needs at least one point");
+
+public:
+    using value_type = T;
+
+    /// The number of grid axes.
+    static constexpr std::size_t dimensions()
+    {
+        return std::tuple_element<0, std::tuple<Points...>>::type::dimensions();
+    }
+    /// The number of points.
+    static constexpr std::size_t size() { return sizeof...(Points); }
+
+    /// Constructs the stencil with the coefficients of the points, in order.
+    template <typename... Coefficients>
+    Stencil(T first, Coefficients... coefficients)
+        : m_coefficients{{first, static_cast<T>(coefficients)...}}
+    {
+        static_assert(sizeof...(Coefficients) + 1 == sizeof...(Points),
+                      "a Stencil needs one coefficient per point");
+    }
+
+    /// Returns the coefficient of point \p i.
+    T coefficient(std::size_t i) const { return m_coefficients[i]; }
+
+    /// Returns the largest absolute offset of all points along \p axis.
+    static std::size_t radius(std::size_t axis)
+    {
+        const int r[] = {Points::radius(axis)...};
+        return std::size_t(*std::max_element(std::begin(r), std::end(r)));
+    }
+
+private:
+    std::array<T, sizeof...(Points)> m_coefficients;
+};
+
+// PaddedGrid {{{1
+/**
+ * \ingroup Utilities
+ *
+ * A dense 1-, 2-, or 3-dimensional grid of values of type \p T, surrounded by \c halo
+ * layers of ghost cells on every side. Axis 0 is contiguous in memory. Every row along
+ * axis 0 starts on a Vector<T> boundary and is padded to a multiple of `Vector<T>::Size`
+ * entries, so that stencils can be evaluated with aligned vector loads and stores.
+ *
+ * The ghost cells hold the boundary conditions: stencil operations only write to the
+ * interior points `0 <= index[a] < size(a)`. Indexes in `[-halo, 0)` and
+ * `[size(a), size(a) + halo)` address the ghost cells.
+ */
+template <typename T, std::size_t Dim> class PaddedGrid
+{
+    static_assert(Dim >= 1 && Dim <= 3, "PaddedGrid supports 1 to 3 dimensions");
+
+public:
+    using value_type = T;
+    using IndexType = std::array<std::ptrdiff_t, Dim>;
+
+    /**
+     * Constructs a grid with \p size interior points along the axes and \p halo layers of
+     * ghost cells. All values, including the ghost cells, are initialized to zero.
+     */
+    PaddedGrid(const std::array<std::size_t, Dim> &size, std::size_t halo)
+        : m_size(size), m_halo(halo)
+    {
+        constexpr std::size_t W = Vector<T>::Size;
+        const std::size_t pad = (std::max<std::size_t>(halo, 1) + W - 1) / W * W;
+        std::ptrdiff_t stride = pad + (size[0] + W - 1) / W * W + pad;
+        m_stride[0] = 1;
+        m_origin = pad;
+        for (std::size_t a = 1; a < Dim; ++a) {
+            m_stride[a] = stride;
+            m_origin += std::ptrdiff_t(halo) * stride;
+            stride *= size[a] + 2 * halo;
+        }
+        m_data.assign(stride, T(0));
+    }
+
+    /// Returns the number of interior points along \p axis.
+    std::size_t size(std::size_t axis) const { return m_size[axis]; }
+    /// Returns the number of ghost cell layers.
+    std::size_t halo() const { return m_halo; }
+    /// Returns the distance (in elements) between neighbours along \p axis.
+    std::ptrdiff_t stride(std::size_t axis) const { return m_stride[axis]; }
+
+    /// Returns a pointer to the interior point with all indexes zero.
+    T *origin() { return m_data.data() + m_origin; }
+    /// \copydoc origin()
+    const T *origin() const { return m_data.data() + m_origin; }
+
+    /// Returns a reference to the value at \p index.
+    T &operator()(const IndexType &index) { return origin()[offset(index)]; }
+    /// \copydoc operator()
+    const T &operator()(const IndexType &index) const { return origin()[offset(index)]; }
+
+    /**
+     * Calls `f(index)` for every point, including the ghost cells, and stores the return
+     * value at that point.
+     */
+    template <typename F> void fill(F &&f)
+    {
+        const std::ptrdiff_t h = m_halo;
+        IndexType i;
+        for (std::size_t a = 0; a < Dim; ++a) {
+            i[a] = -h;
+        }
+        while (true) {
+            (*this)(i) = f(static_cast<const IndexType &>(i));
+            std::size_t a = 0;
+            for (; a < Dim && ++i[a] == std::ptrdiff_t(m_size[a]) + h; ++a) {
+                i[a] = -h;
+            }
+            if (a == Dim) {
+                return;
+            }
+        }
+    }
+
+    /// Returns whether \p rhs has the same sizes and halo.
+    bool sameShape(const PaddedGrid &rhs) const
+    {
+        return m_size == rhs.m_size && m_halo == rhs.m_halo;
+    }
+
+private:
+    std::ptrdiff_t offset(const IndexType &index) const
+    {
+        std::ptrdiff_t r = 0;
+        for (std::size_t a = 0; a < Dim; ++a) {
+            r += index[a] * m_stride[a];
+        }
+        return r;
+    }
+
+    std::array<std::size_t, Dim> m_size;
+    std::size_t m_halo;
+    std::array<std::ptrdiff_t, Dim> m_stride;
+    std::ptrdiff_t m_origin;
+    std::vector<T, Allocator<T>> m_data;
+};
+
+/**
+ * \ingroup Utilities
+ * Selects how simd_stencil_steps traverses the grid.
+ */
+enum class StencilBlocking {
+    /// Every time step is a full sweep over the grid.
+    Spatial,
+    /**
+     * The time steps are interleaved in a wavefront along the outermost axis, so that a
+     * slab of the grid is updated by all time steps while it is still in the cache.
+     */
+    Temporal
+};
+
+namespace Detail
+{
+// stencilLoad {{{1
+/**\internal
+ * Returns the vector at offset \p Dx from the vector-aligned address \p p. Offsets
+ * shorter than a vector combine the aligned neighbour vector via Vector::shifted.
+ */
+template <int Dx, typename V, typename T>
+Vc_INTRINSIC enable_if<(Dx == 0), V> stencilLoad(const T *p)
+{
+    return V(p, Vc::Aligned);
+}
+template <int Dx, typename V, typename T>
+Vc_INTRINSIC enable_if<(Dx > 0 && Dx < int(V::Size)), V> stencilLoad(const T *p)
+{
+    return V(p, Vc::Aligned).shifted(Dx, V(p + V::Size, Vc::Aligned));
+}
+template <int Dx, typename V, typename T>
+Vc_INTRINSIC enable_if<(Dx < 0 && -Dx < int(V::Size)), V> stencilLoad(const T *p)
+{
+    return V(p, Vc::Aligned).shifted(Dx, V(p - V::Size, Vc::Aligned));
+}
+template <int Dx, typename V, typename T>
+Vc_INTRINSIC enable_if<(Dx != 0 && (Dx >= int(V::Size) || -Dx >= int(V::Size))), V>
+stencilLoad(const T *p)
+{
+    return V(p + Dx, Vc::Unaligned);
+}
+
+// StencilKernel {{{1
+/**\internal
+ * Applies a stencil to the grid points `[x0, x1)` of rows along axis 0. \p x0 is a
+ * multiple of the vector size; \p x1 is either a multiple of the vector size or the end
+ * of the row, where a masked store keeps the ghost cells intact.
+ */
+template <typename T, typename... Points> class StencilKernel
+{
+    using V = Vector<T>;
+    static constexpr std::size_t N = sizeof...(Points);
+
+public:
+    template <std::size_t Dim>
+    StencilKernel(const Stencil<T, Points...> &stencil, const PaddedGrid<T, Dim> &grid)
+    {
+        const std::array<int, N> offsets1 = {{Points::offset(Dim > 1 ? 1 : 0)...}};
+        const std::array<int, N> offsets2 = {{Points::offset(Dim > 2 ? 2 : 0)...}};
+        for (std::size_t i = 0; i < N; ++i) {
+            m_coefficients[i] = V(stencil.coefficient(i));
+            m_rowOffsets[i] = (Dim > 1 ? offsets1[i] * grid.stride(1) : 0) +
+                              (Dim > 2 ? offsets2[i] * grid.stride(Dim - 1) : 0);
+        }
+    }
+
+    Vc_INTRINSIC void row(const T *in, T *out, std::size_t x0, std::size_t x1,
+                          std::size_t nx) const
+    {
+        row(in, out, x0, x1, nx, make_index_sequence<N>());
+    }
+
+private:
+    template <std::size_t... I>
+    Vc_INTRINSIC void row(const T *in, T *out, std::size_t x0, std::size_t x1,
+                          std::size_t nx, index_sequence<I...>) const
+    {
+        for (std::size_t x = x0; x < x1; x += V::Size) {
+            V acc = V::Zero();
+            const int unused[] = {
+                (acc = muladd(m_coefficients[I],
+                              stencilLoad<Points::offset(0), V>(in + x + m_rowOffsets[I]),
+                              acc),
+                 0)...};
+            (void)unused;
+            if (x + V::Size <= nx) {
+                acc.store(out + x, Vc::Aligned);
+            } else {
+                acc.store(out + x, V::IndexesFromZero() < V(T(nx - x)), Vc::Aligned);
+            }
+        }
+    }
+
+    V m_coefficients[N];
+    std::ptrdiff_t m_rowOffsets[N];
+};
+
+// stencilRange {{{1
+/**\internal
+ * Applies \p kernel to the interior points with outermost index in `[lo, hi)`. The rows
+ * (or chunks of a 1-D grid) are distributed over the threads of an enclosing OpenMP
+ * parallel region; outside of a parallel region the loop runs sequentially. 3-D grids are
+ * traversed in tiles of \p tileRows rows along axis 1, which keeps the planes that the
+ * stencil touches in the cache.
+ */
+template <typename T, typename... Points>
+inline void stencilRange(const StencilKernel<T, Points...> &kernel,
+                         const PaddedGrid<T, 1> &in, PaddedGrid<T, 1> &out, std::size_t lo,
+                         std::size_t hi, std::size_t)
+{
+    constexpr std::size_t Chunk = 256 * Vector<T>::Size;
+    const std::ptrdiff_t chunks = (hi - lo + Chunk - 1) / Chunk;
+    const std::size_t nx = in.size(0);
+    Vc_OMP_PRAGMA_(omp for schedule(static))
+    for (std::ptrdiff_t c = 0; c < chunks; ++c) {
+        const std::size_t x0 = lo + c * Chunk;
+        kernel.row(in.origin(), out.origin(), x0, std::min(x0 + Chunk, hi), nx);
+    }
+}
+template <typename T, typename... Points>
+inline void stencilRange(const StencilKernel<T, Points...> &kernel,
+                         const PaddedGrid<T, 2> &in, PaddedGrid<T, 2> &out, std::size_t lo,
+                         std::size_t hi, std::size_t)
+{
+    const std::size_t nx = in.size(0);
+    Vc_OMP_PRAGMA_(omp for schedule(static))
+    for (std::ptrdiff_t y = lo; y < std::ptrdiff_t(hi); ++y) {
+        const std::ptrdiff_t offset = y * in.stride(1);
+        kernel.row(in.origin() + offset, out.origin() + offset, 0, nx, nx);
+    }
+}
+template <typename T, typename... Points>
+inline void stencilRange(const StencilKernel<T, Points...> &kernel,
+                         const PaddedGrid<T, 3> &in, PaddedGrid<T, 3> &out, std::size_t lo,
+                         std::size_t hi, std::size_t tileRows)
+{
+    const std::size_t nx = in.size(0);
+    const std::size_t ny = in.size(1);
+    const std::size_t tileSize = (hi - lo) * tileRows;
+    const std::ptrdiff_t rows = (ny + tileRows - 1) / tileRows * tileSize;
+    Vc_OMP_PRAGMA_(omp for schedule(static))
+    for (std::ptrdiff_t r = 0; r < rows; ++r) {
+        const std::size_t tile = r / tileSize;
+        const std::size_t z = lo + r % tileSize / tileRows;
+        const std::size_t y = tile * tileRows + r % tileRows;
+        if (y < ny) {
+            const std::ptrdiff_t offset = y * in.stride(1) + z * in.stride(2);
+            kernel.row(in.origin() + offset, out.origin() + offset, 0, nx, nx);
+        }
+    }
+}
+
+/**\internal
+ * Returns the number of rows along axis 1 of a 3-D tile such that the `2 * radius + 1`
+ * planes of a tile in the input plus one plane in the output fill half of the L2 cache.
+ */
+template <typename T, std::size_t Dim>
+inline std::size_t stencilTileRows(const PaddedGrid<T, Dim> &grid, std::size_t radius)
+{
+    if (Dim < 3) {
+        return 1;
+    }
+    CpuId::init();
+    const std::size_t l2 = CpuId::L2Data() ? CpuId::L2Data() : 256 * 1024;
+    const std::size_t rowBytes = grid.stride(1) * sizeof(T);
+    return std::max<std::size_t>(1, l2 / 2 / ((2 * radius + 2) * rowBytes));
+}
+//}}}1
+}  // namespace Detail
+
+// simd_stencil {{{1
+/**
+ * \ingroup Utilities
+ *
+ * Writes the stencil applied to the interior points of \p in to the interior points of
+ * \p out. The grids must have the same shape and a halo of at least the stencil radius;
+ * the ghost cells of \p out are not modified.
+ *
+ * If the translation unit is compiled with OpenMP enabled, the rows of the grid are
+ * distributed over the threads of a parallel region.
+ */
+template <typename T, std::size_t Dim, typename... Points>
+inline void simd_stencil(const Stencil<T, Points...> &stencil, const PaddedGrid<T, Dim> &in,
+                         PaddedGrid<T, Dim> &out)
+{
+    static_assert(Stencil<T, Points...>::dimensions() == Dim,
+                  "the StencilPoints must have one offset per grid axis");
+    Vc_ASSERT(in.sameShape(out));
+    for (std::size_t axis = 0; axis < Dim; ++axis) {
+        Vc_ASSERT(in.halo() >= stencil.radius(axis));
+    }
+    const Detail::StencilKernel<T, Points...> kernel(stencil, in);
+    const std::size_t tileRows = Detail::stencilTileRows(in, stencil.radius(Dim - 1));
+    Vc_OMP_PRAGMA_(omp parallel)
+    Detail::stencilRange(kernel, in, out, 0, in.size(Dim - 1), tileRows);
+}
+
+// simd_stencil_steps {{{1
+/**
+ * \ingroup Utilities
+ *
+ * Applies the stencil \p steps times, alternating between \p a and \p b, and returns the
+ * grid that holds the final result: \p a if \p steps is even, otherwise \p b. The initial
+ * values are read from \p a, whose ghost cells are copied to \p b; they stay constant
+ * over all steps (Dirichlet boundary).
+ *
+ * With StencilBlocking::Temporal (the default), the grid is cut into slabs along the
+ * outermost axis, sized to fit the L2 cache for all steps, and the steps are interleaved
+ * in a wavefront: while step \c t updates slab \c k, step `t + 1` updates slab `k - 1`.
+ * Each slab is therefore loaded from memory once instead of once per step. The result is
+ * identical to StencilBlocking::Spatial, which performs one full sweep per step.
+ *
+ * If the translation unit is compiled with OpenMP enabled, the rows of every slab are
+ * distributed over the threads of a parallel region.
+ */
+template <typename T, std::size_t Dim, typename... Points>
+inline PaddedGrid<T, Dim> &simd_stencil_steps(const Stencil<T, Points...> &stencil,
+                                              PaddedGrid<T, Dim> &a, PaddedGrid<T, Dim> &b,
+                                              std::size_t steps,
+                                              StencilBlocking blocking = StencilBlocking::Temporal)
+{
+    static_assert(Stencil<T, Points...>::dimensions() == Dim,
+                  "the StencilPoints must have one offset per grid axis");
+    Vc_ASSERT(a.sameShape(b));
+    for (std::size_t axis = 0; axis < Dim; ++axis) {
+        Vc_ASSERT(a.halo() >= stencil.radius(axis));
+    }
+    if (steps == 0) {
+        return a;
+    }
+    b = a;
+    const Detail::StencilKernel<T, Points...> kernel(stencil, a);
+    const std::size_t radius = std::max<std::size_t>(stencil.radius(Dim - 1), 1);
+    const std::size_t tileRows = Detail::stencilTileRows(a, radius);
+    const std::size_t n = a.size(Dim - 1);
+
+    // the slab thickness along the outermost axis: at least the stencil radius, and
+    // thick enough for the wavefront to amortize the slab changes
+    std::size_t slab = n;
+    if (blocking == StencilBlocking::Temporal) {
+        CpuId::init();
+        const std::size_t l2 = CpuId::L2Data() ? CpuId::L2Data() : 256 * 1024;
+        const std::size_t unitBytes =
+            sizeof(T) * (Dim == 1 ? 1 : a.stride(Dim - 1));
+        slab = std::max(radius, l2 / 2 / (2 * (steps + 1) * unitBytes));
+        if (Dim == 1) {
+            constexpr std::size_t W = Vector<T>::Size;
+            slab = (slab + W - 1) / W * W;
+        }
+        slab = std::min(slab, n);
+    }
+    const std::ptrdiff_t slabs = (n + slab - 1) / slab;
+    const std::ptrdiff_t wavefronts =
+        blocking == StencilBlocking::Temporal ? slabs + std::ptrdiff_t(steps) - 1 : 0;
+
+    Vc_OMP_PRAGMA_(omp parallel)
+    {
+        if (blocking == StencilBlocking::Temporal) {
+            for (std::ptrdiff_t j = 0; j < wavefronts; ++j) {
+                for (std::ptrdiff_t t = 0; t < std::ptrdiff_t(steps); ++t) {
+                    const std::ptrdiff_t k = j - t;
+                    if (k >= 0 && k < slabs) {
+                        Detail::stencilRange(kernel, t % 2 == 0 ? a : b,
+                                             t % 2 == 0 ? b : a, k * slab,
+                                             std::min<std::size_t>(n, (k + 1) * slab),
+                                             tileRows);
+                    }
+                }
+            }
+        } else {
+            for (std::size_t t = 0; t < steps; ++t) {
+                Detail::stencilRange(kernel, t % 2 == 0 ? a : b, t % 2 == 0 ? b : a, 0, n,
+                                     tileRows);
+            }
+        }
+    }
+    return steps % 2 == 0 ? a : b;
+}
+//}}}1
+}  // namespace Vc
+
+#endif  // VC_COMMON_STENCIL_H_
+
+// vim: foldmethod=marker
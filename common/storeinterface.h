@@ -38,7 +38,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 template <
     typename U,
     typename Flags = DefaultStoreTag,
-    typename = enable_if<std::is_arithmetic<U>::value &&Traits::is_load_store_flag<Flags>::value>>
+    typename = enable_if<Traits::is_load_store_type<EntryType, U>::value &&
+                         Traits::is_load_store_flag<Flags>::value>>
 Vc_INTRINSIC_L void store(U *mem, Flags flags = Flags()) const Vc_INTRINSIC_R;
 
 /**
@@ -58,7 +59,8 @@ Vc_INTRINSIC_L void store(U *mem, Flags flags = Flags()) const Vc_INTRINSIC_R;
 template <
     typename U,
     typename Flags = DefaultStoreTag,
-    typename = enable_if<std::is_arithmetic<U>::value &&Traits::is_load_store_flag<Flags>::value>>
+    typename = enable_if<Traits::is_load_store_type<EntryType, U>::value &&
+                         Traits::is_load_store_flag<Flags>::value>>
 Vc_INTRINSIC_L void Vc_VDECL store(U *mem, MaskType mask, Flags flags = Flags()) const Vc_INTRINSIC_R;
 
 //@{
@@ -89,4 +91,29 @@ Vc_INTRINSIC void Vc_VDECL store(EntryType *mem, MaskType mask, Flags flags) con
 }
 //@}
 
+/**
+ * Store the entries selected by \p mask contiguously to \p mem.
+ *
+ * The entry at offset \c i is stored to `mem[j]`, where \c j is the number of entries
+ * selected by \p mask below \c i. This is the basic building block for vectorized
+ * filtering of streams:
+ * \code
+ * size_t n = 0;
+ * for (size_t i = 0; i < size; i += float_v::Size) {
+ *     const float_v x(&in[i], Vc::Unaligned);
+ *     n += x.compressStore(&out[n], x > threshold);
+ * }
+ * \endcode
+ *
+ * \param mem A pointer to memory. It does not need to be aligned.
+ * \param mask A mask object that determines which entries of the vector are stored.
+ *
+ * \return The number of stored entries, i.e. `mask.count()`.
+ *
+ * \note
+ * The implementation may write to all of `mem[0]` to `mem[Size - 1]`. Entries at offsets
+ * greater or equal to the return value have unspecified values afterwards.
+ */
+Vc_INTRINSIC_L std::size_t Vc_VDECL compressStore(EntryType *mem, MaskType mask) const Vc_INTRINSIC_R;
+
 // vim: foldmethod=marker
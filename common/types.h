@@ -364,6 +364,7 @@ template <std::size_t Size, typename F> Vc_INTRINSIC void for_all_vector_entries
 #include "vector.h"
 #include "mask.h"
 #include "memoryfwd.h"
+#include "half.h"
 
 #endif // VC_COMMON_TYPES_H_
 
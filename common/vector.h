@@ -204,7 +204,8 @@ public:
      * Integers will use the full range the integer representation allows.
      *
      * \note This function may use a very small amount of state and thus will be a weak
-     * random number generator.
+     * random number generator. The state is shared between all threads. Use
+     * Xoshiro128PlusPlus (from \c <Vc/random>) for seeded, per-thread streams.
      */
     static inline Vector Random();
 
@@ -629,6 +630,20 @@ public:
     inline Vector rotated(int amount) const;
     /// Returns a vector with all components reversed.
     inline Vector reversed() const;
+    /**
+     * Returns a vector where entry \c i is `(*this)[idx[i]]`.
+     *
+     * The indexes are runtime values, so this implements any (data-dependent) shuffle of
+     * the entries. Every index must be in the range [0, Size).
+     *
+     * \code
+     * int_v foo = int_v::IndexesFromZero() + 1;   // e.g. [1, 2, 3, 4] with SSE
+     * foo.permute(int_v::IndexType(3, 3, 0, 1))  // [4, 4, 1, 2]
+     * \endcode
+     *
+     * \see Vc::permute2
+     */
+    inline Vector permute(const IndexType &idx) const;
     ///@}
 
     /**
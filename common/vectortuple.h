@@ -36,7 +36,9 @@ namespace Vc_VERSIONED_NAMESPACE
 namespace Common
 {
 
-template<size_t StructSize, typename V, typename I, bool Readonly = true> struct InterleavedMemoryReadAccess;
+template <size_t StructSize, typename V, typename I, bool Readonly = true,
+          typename M = typename V::EntryType>
+struct InterleavedMemoryReadAccess;
 
 template <int Length, typename V> class VectorReferenceArray
 {
@@ -80,16 +82,16 @@ public:
         return appendOneReference(a, IndexSequence());
     }
 
-    template <size_t StructSize, typename I, bool RO>
+    template <size_t StructSize, typename I, bool RO, typename M>
     Vc_ALWAYS_INLINE enable_if<(Length <= StructSize), void> operator=(
-        const InterleavedMemoryReadAccess<StructSize, V, I, RO> &access)
+        const InterleavedMemoryReadAccess<StructSize, V, I, RO, M> &access)
     {
         callDeinterleave(access, IndexSequence());
     }
 
-    template <size_t StructSize, typename I, bool RO>
+    template <size_t StructSize, typename I, bool RO, typename M>
     enable_if<(Length > StructSize), void> operator=(
-        const InterleavedMemoryReadAccess<StructSize, V, I, RO> &access) =
+        const InterleavedMemoryReadAccess<StructSize, V, I, RO, M> &access) =
         delete;  //("You are trying to extract more data from the struct than it has");
 
     template <typename... Inputs> void operator=(TransposeProxy<Inputs...> &&proxy)
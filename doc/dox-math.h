@@ -176,6 +176,41 @@ VECTOR_TYPE min(const VECTOR_TYPE &x, const VECTOR_TYPE &y);
  */
 VECTOR_TYPE max(const VECTOR_TYPE &x, const VECTOR_TYPE &y);
 
+/**
+ * \ingroup Math
+ *
+ * Saturating addition for the 8- and 16-bit integer vectors.
+ *
+ * \param x \VSize{T} values to add component-wise to \p y.
+ * \param y \VSize{T} values to add component-wise to \p x.
+ * \returns \p x + \p y, clamped to the range of \p T instead of wrapping around.
+ */
+VECTOR_TYPE add_sat(const VECTOR_TYPE &x, const VECTOR_TYPE &y);
+
+/**
+ * \ingroup Math
+ *
+ * Saturating subtraction for the 8- and 16-bit integer vectors.
+ *
+ * \param x \VSize{T} values to subtract \p y from.
+ * \param y \VSize{T} values to subtract component-wise from \p x.
+ * \returns \p x - \p y, clamped to the range of \p T instead of wrapping around.
+ */
+VECTOR_TYPE sub_sat(const VECTOR_TYPE &x, const VECTOR_TYPE &y);
+
+/**
+ * \ingroup Math
+ *
+ * Looks up the low nibble of every entry of the 8-bit vector \p x in the 16-entry table
+ * \p table. With SSSE3/AVX2 this is a single byte shuffle, which makes it the building
+ * block for character classification (e.g. finding delimiters in text).
+ *
+ * \param x \VSize{T} indexes; the upper four bits of every entry are ignored.
+ * \param table the 16 values to select from.
+ * \returns a vector with \c table[x[i] & 0xf] in entry \c i.
+ */
+VECTOR_TYPE nibble_lookup(const VECTOR_TYPE &x, const T (&table)[16]);
+
 /**
  * \ingroup Math
  *
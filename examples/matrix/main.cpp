@@ -23,6 +23,7 @@
 
 #include <Vc/Vc>
 #include <Vc/IO>
+#include <Vc/gemm>
 #include <iostream>
 #include <iomanip>
 #include <valarray>
@@ -270,6 +271,27 @@ template <size_t N, typename F> Vc_ALWAYS_INLINE void benchmark(F &&f)
     //<< " FLOP/cycle (" << variant << ")\n";
 }
 
+// Vc::gemm is only benchmarked if N covers at least one full register block (NR columns
+// of B). Smaller matrices never reach the vector loads and stores of the full block,
+// which GCC cannot prove and thus warns about (-Warray-bounds).
+template <size_t N, typename F>
+void benchmarkGemm(Matrix<float, N> &, Matrix<float, N> &, F &&, std::false_type)
+{
+    std::cout << std::setw(19) << '-';
+}
+template <size_t N, typename F>
+void benchmarkGemm(Matrix<float, N> &A, Matrix<float, N> &B, F &&fakeModify,
+                   std::true_type)
+{
+    benchmark<N>([&] {
+        fakeModify(A, B);
+        Matrix<float, N> C;
+        const auto ld = A[0].size();
+        Vc::gemm(N, N, N, 1.f, &A[0][0], ld, &B[0][0], ld, 0.f, &C[0][0], ld);
+        return C;
+    });
+}
+
 template <size_t N> void run()
 {
     Matrix<float, N> A;
@@ -315,12 +337,16 @@ template <size_t N> void run()
         fakeModify(A, B);
         return AV * BV;
     });
+    using FullBlock =
+        std::integral_constant<bool, (N >= Vc::Detail::GemmTraits<float>::NR)>;
+    benchmarkGemm(A, B, fakeModify, FullBlock());
     std::cout << std::endl;
 }
 
 int Vc_CDECL main()
 {
-    std::cout << " N             scalar   scalar & blocked          Vector<T>           valarray\n";
+    std::cout << " N             scalar   scalar & blocked          Vector<T>           valarray"
+                 "           Vc::gemm\n";
     run< 4>();
     run< 5>();
     run< 6>();
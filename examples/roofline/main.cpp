@@ -0,0 +1,107 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include <cstdlib>
+#include <vector>
+
+#include <Vc/Vc>
+#include <Vc/gemm>
+#include "roofline.h"
+
+/*
+ * Characterizes the machine for the Vc implementation this file is compiled for and
+ * places a few typical kernels on the roofline:
+ *
+ *   triad       a[i] = b[i] + s * c[i] on a 192 MiB working set
+ *   dot         sum(x[i] * y[i]) on a working set that fits into L2
+ *   horner15    a degree-15 polynomial evaluated on a working set that fits into L1
+ *   gemm        Vc::gemm on 192x192 matrices
+ *
+ * Usage: roofline [max threads]
+ */
+
+using float_v = Vc::float_v;
+using Vector = std::vector<float, Vc::Allocator<float>>;
+
+static volatile float sink;
+
+int main(int argc, char **argv)
+{
+    // an invalid or non-positive thread count falls back to all hardware threads
+    const int maxThreads = argc > 1 ? std::atoi(argv[1]) : 0;
+    Roofline roofline(maxThreads > 0 ? unsigned(maxThreads)
+                                     : std::thread::hardware_concurrency());
+
+    // triad: 2 FLOPs per 12 bytes (two loads and one store)
+    const std::size_t triadSize = 16 << 20;
+    Vector a(triadSize), b(triadSize, 1.f), c(triadSize, 2.f);
+    roofline.add("triad", 2. * triadSize, 12. * triadSize, 12 * triadSize, [&] {
+        const float_v s = 0.5f;
+        for (std::size_t i = 0; i < triadSize; i += float_v::Size) {
+            (float_v(&b[i]) + s * float_v(&c[i])).store(&a[i]);
+        }
+    });
+
+    // dot: 2 FLOPs per 8 bytes
+    const std::size_t dotSize = 16 << 10;
+    Vector x(dotSize, 1.f), y(dotSize, 0.5f);
+    roofline.add("dot", 2. * dotSize, 8. * dotSize, 8 * dotSize, [&] {
+        float_v s0 = float_v::Zero(), s1 = s0;
+        for (std::size_t i = 0; i < dotSize; i += 2 * float_v::Size) {
+            s0 += float_v(&x[i]) * float_v(&y[i]);
+            s1 += float_v(&x[i + float_v::Size]) * float_v(&y[i + float_v::Size]);
+        }
+        sink = (s0 + s1).sum();
+    });
+
+    // horner15: 30 FLOPs per 8 bytes (one load and one store)
+    const std::size_t polySize = 2 << 10;
+    Vector p(polySize, 0.5f), q(polySize);
+    float coefficients[16];
+    for (int k = 0; k < 16; ++k) {
+        coefficients[k] = 1.f / (k + 1);
+    }
+    roofline.add("horner15", 30. * polySize, 8. * polySize, 8 * polySize, [&] {
+        for (std::size_t i = 0; i < polySize; i += float_v::Size) {
+            const float_v t(&p[i]);
+            float_v r = coefficients[15];
+            for (int k = 14; k >= 0; --k) {
+                r = r * t + coefficients[k];
+            }
+            r.store(&q[i]);
+        }
+    });
+
+    // gemm: 2n³ FLOPs; the bytes are the compulsory traffic of the three matrices
+    const std::size_t n = 192;
+    Vector ma(n * n, 1.f), mb(n * n, 0.5f), mc(n * n);
+    roofline.add("gemm 192", 2. * n * n * n, 4. * 3 * n * n, 4 * 3 * n * n,
+                 [&] { Vc::gemm(n, n, n, ma.data(), mb.data(), mc.data()); });
+
+    roofline.run();
+    return 0;
+}
@@ -0,0 +1,328 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_EXAMPLES_ROOFLINE_H_
+#define VC_EXAMPLES_ROOFLINE_H_
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <Vc/Vc>
+#include <Vc/cpuid.h>
+
+/*
+ * A roofline characterization of the machine for the Vc implementation the translation
+ * unit is compiled for:
+ *
+ * 1. The ceilings: the peak floating-point throughput (independent multiply-add chains
+ *    on float_v) and the read bandwidth out of L1, L2, L3, and main memory, each for 1,
+ *    2, 4, ... threads.
+ * 2. The kernels: registered functions with a known number of FLOPs and bytes per call.
+ *    Each kernel is timed, and its throughput is compared to the roof at its arithmetic
+ *    intensity, min(peak, intensity * bandwidth), using the bandwidth of the cache level
+ *    that holds its working set.
+ *
+ * A kernel far below a compute roof lacks vectorization or instruction-level
+ * parallelism. A kernel far below a bandwidth roof has a poor access pattern. A kernel
+ * at a bandwidth roof can only get faster with a higher arithmetic intensity, i.e. with
+ * a better data layout, blocking, or fusion with neighbouring kernels.
+ */
+class Roofline
+{
+public:
+    using float_v = Vc::float_v;
+    using Clock = std::chrono::steady_clock;
+
+    enum Level { L1, L2, L3, Memory, LevelCount };
+
+    struct Kernel {
+        std::string name;
+        double flops;          // per call
+        double bytes;          // moved between the core and the cache level, per call
+        std::size_t workingSet;  // bytes, selects the bandwidth roof
+        std::function<void()> run;
+    };
+
+    /// The number of threads to characterize is limited to \p maxThreads.
+    explicit Roofline(unsigned maxThreads = std::thread::hardware_concurrency())
+    {
+        Vc::CpuId::init();
+        m_cacheSize[L1] = Vc::CpuId::L1Data() ? Vc::CpuId::L1Data() : 32 * 1024;
+        m_cacheSize[L2] = Vc::CpuId::L2Data() ? Vc::CpuId::L2Data() : 256 * 1024;
+        m_cacheSize[L3] = Vc::CpuId::L3Data() ? Vc::CpuId::L3Data() : 4 * 1024 * 1024;
+        m_cacheSize[Memory] = std::max<std::size_t>(8 * m_cacheSize[L3], 256 << 20);
+        for (unsigned t = 1; t < std::max(maxThreads, 1u); t *= 2) {
+            m_threadCounts.push_back(t);
+        }
+        m_threadCounts.push_back(std::max(maxThreads, 1u));
+    }
+
+    /// Registers a kernel; see Kernel for the meaning of the parameters.
+    void add(std::string name, double flops, double bytes, std::size_t workingSet,
+             std::function<void()> run)
+    {
+        m_kernels.push_back({std::move(name), flops, bytes, workingSet, std::move(run)});
+    }
+
+    /// Measures the ceilings and all registered kernels and prints the report.
+    void run()
+    {
+        std::printf("Vc implementation: %s, float_v::Size = %d\n", implementationName(),
+                    int(float_v::Size));
+        std::printf("cache sizes: L1 %zu KiB, L2 %zu KiB, L3 %zu KiB\n",
+                    m_cacheSize[L1] >> 10, m_cacheSize[L2] >> 10, m_cacheSize[L3] >> 10);
+        std::printf("%8s | %12s | %12s | %12s | %12s | %12s\n", "threads", "GFLOP/s",
+                    "L1 GB/s", "L2 GB/s", "L3 GB/s", "memory GB/s");
+        for (unsigned threads : m_threadCounts) {
+            Ceilings c;
+            c.peak = parallel(threads, [](double seconds) { return peakFlops(seconds); });
+            for (int level = 0; level < LevelCount; ++level) {
+                const std::size_t bytes = bufferSize(Level(level), threads);
+                c.bandwidth[level] = parallel(threads, [bytes](double seconds) {
+                    return readBandwidth(bytes, seconds);
+                });
+            }
+            std::printf("%8u | %12.1f | %12.1f | %12.1f | %12.1f | %12.1f\n", threads,
+                        c.peak * 1e-9, c.bandwidth[L1] * 1e-9, c.bandwidth[L2] * 1e-9,
+                        c.bandwidth[L3] * 1e-9, c.bandwidth[Memory] * 1e-9);
+            if (threads == 1) {
+                m_single = c;
+            }
+        }
+        if (m_kernels.empty()) {
+            return;
+        }
+
+        std::printf("\nkernels (1 thread):\n");
+        std::printf("%-24s | %9s | %9s | %6s | %9s | %6s | %s\n", "name", "FLOP/byte",
+                    "GFLOP/s", "level", "roof", "% roof", "bound by");
+        static const char *const levelNames[] = {"L1", "L2", "L3", "memory"};
+        for (const Kernel &k : m_kernels) {
+            const double seconds = timePerCall(k.run);
+            const double achieved = k.flops / seconds;
+            const double intensity = k.flops / k.bytes;
+            const Level level = levelFor(k.workingSet);
+            const double bandwidthRoof = intensity * m_single.bandwidth[level];
+            const bool memoryBound = bandwidthRoof < m_single.peak;
+            const double roof = memoryBound ? bandwidthRoof : m_single.peak;
+            const double fraction = achieved / roof;
+            std::printf("%-24s | %9.3f | %9.2f | %6s | %9.2f | %5.0f%% | %s\n",
+                        k.name.c_str(), intensity, achieved * 1e-9, levelNames[level],
+                        roof * 1e-9, 100 * fraction, advice(memoryBound, fraction));
+        }
+    }
+
+private:
+    struct Ceilings {
+        double peak = 0;
+        double bandwidth[LevelCount] = {};
+    };
+
+    static const char *implementationName()
+    {
+        switch (Vc::CurrentImplementation::current()) {
+        case Vc::ScalarImpl: return "Scalar";
+        case Vc::SSE2Impl: return "SSE2";
+        case Vc::SSE3Impl: return "SSE3";
+        case Vc::SSSE3Impl: return "SSSE3";
+        case Vc::SSE41Impl: return "SSE4.1";
+        case Vc::SSE42Impl: return "SSE4.2";
+        case Vc::AVXImpl: return "AVX";
+        case Vc::AVX2Impl: return "AVX2";
+        case Vc::MICImpl: return "MIC";
+        default: return "unknown";
+        }
+    }
+
+    static const char *advice(bool memoryBound, double fraction)
+    {
+        if (memoryBound) {
+            return fraction < 0.5 ? "bandwidth: improve the access pattern"
+                                  : "bandwidth: raise FLOP/byte (layout, blocking)";
+        }
+        return fraction < 0.5 ? "compute: improve vectorization / ILP" : "compute";
+    }
+
+    // the per-thread buffer size that fits into (half of) the given level
+    std::size_t bufferSize(Level level, unsigned threads) const
+    {
+        switch (level) {
+        case L1:
+        case L2:
+            return m_cacheSize[level] / 2;
+        case L3:
+            return std::max(m_cacheSize[L2], m_cacheSize[L3] / 2 / threads);
+        default:
+            return m_cacheSize[Memory] / threads;
+        }
+    }
+
+    Level levelFor(std::size_t workingSet) const
+    {
+        for (int level = L1; level < Memory; ++level) {
+            if (workingSet <= m_cacheSize[level] * 3 / 4) {
+                return Level(level);
+            }
+        }
+        return Memory;
+    }
+
+    // Runs f(seconds) on the given number of threads, started together, and returns the
+    // sum of their results (rates per second).
+    template <typename F> static double parallel(unsigned threads, F &&f)
+    {
+        constexpr double seconds = 0.1;
+        if (threads == 1) {
+            return f(seconds);
+        }
+        std::vector<double> results(threads);
+        std::vector<std::thread> pool;
+        std::atomic<unsigned> ready(0);
+        std::atomic<bool> go(false);
+        for (unsigned t = 0; t < threads; ++t) {
+            pool.emplace_back([&, t] {
+                ++ready;
+                while (!go) {
+                    std::this_thread::yield();
+                }
+                results[t] = f(seconds);
+            });
+        }
+        while (ready < threads) {
+            std::this_thread::yield();
+        }
+        go = true;
+        for (auto &th : pool) {
+            th.join();
+        }
+        double sum = 0;
+        for (double r : results) {
+            sum += r;
+        }
+        return sum;
+    }
+
+    // Returns the best rate of `work(reps)`, which does `amount * reps` units of work,
+    // over repeated runs of at least `seconds / 10` each.
+    template <typename F> static double bestRate(double amount, double seconds, F &&work)
+    {
+        std::size_t reps = 1;
+        double best = 0;
+        const auto end = Clock::now() + std::chrono::duration<double>(seconds);
+        while (Clock::now() < end) {
+            const auto t0 = Clock::now();
+            work(reps);
+            const double dt = std::chrono::duration<double>(Clock::now() - t0).count();
+            if (dt < seconds / 10) {
+                reps *= 2;
+                continue;
+            }
+            best = std::max(best, amount * reps / dt);
+        }
+        return best;
+    }
+
+    static double peakFlops(double seconds)
+    {
+        // enough independent chains to cover the latency of the FMA/add units; the
+        // SimdArray holds one chain per native vector
+        constexpr int Chains = 10;
+        constexpr int Inner = 1000;
+        using V = Vc::SimdArray<float, Chains * float_v::Size>;
+        return bestRate(2. * V::Size * Inner, seconds, [](std::size_t reps) {
+            V acc = V::IndexesFromZero();
+            const V m = 0.999999f, a = 1e-6f;
+            for (std::size_t r = 0; r < reps; ++r) {
+                for (int j = 0; j < Inner; ++j) {
+                    acc = acc * m + a;
+                }
+            }
+            sink() = acc.sum();
+        });
+    }
+
+    // Reads four streams concurrently, as a single stream does not keep enough cache
+    // line requests in flight to saturate L3 and memory. Two accumulators per stream
+    // hide the latency of the additions.
+    static double readBandwidth(std::size_t bytes, double seconds)
+    {
+        const std::size_t n = std::max<std::size_t>(bytes / sizeof(float_v) / 8, 1) * 2;
+        std::vector<float_v, Vc::Allocator<float_v>> buffer(4 * n, float_v(1.f));
+        const float_v *const data = buffer.data();
+        return bestRate(double(4 * n * sizeof(float_v)), seconds, [&](std::size_t reps) {
+            float_v s[8] = {};
+            for (std::size_t r = 0; r < reps; ++r) {
+                for (std::size_t i = 0; i < n; i += 2) {
+                    s[0] += data[i];
+                    s[1] += data[i + 1];
+                    s[2] += data[i + n];
+                    s[3] += data[i + n + 1];
+                    s[4] += data[i + 2 * n];
+                    s[5] += data[i + 2 * n + 1];
+                    s[6] += data[i + 3 * n];
+                    s[7] += data[i + 3 * n + 1];
+                }
+            }
+            for (int k = 1; k < 8; ++k) {
+                s[0] += s[k];
+            }
+            sink() = s[0].sum();
+        });
+    }
+
+    static double timePerCall(const std::function<void()> &f)
+    {
+        f();  // warm up
+        return 1. / bestRate(1., 0.2, [&](std::size_t reps) {
+            for (std::size_t r = 0; r < reps; ++r) {
+                f();
+            }
+        });
+    }
+
+    // keeps the results of the ceiling benchmarks alive
+    static volatile float &sink()
+    {
+        static volatile float s = 0;
+        return s;
+    }
+
+    std::size_t m_cacheSize[LevelCount];
+    std::vector<unsigned> m_threadCounts;
+    std::vector<Kernel> m_kernels;
+    Ceilings m_single;
+};
+
+#endif  // VC_EXAMPLES_ROOFLINE_H_
+
+// vim: foldmethod=marker
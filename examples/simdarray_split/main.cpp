@@ -0,0 +1,118 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2016 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include <Vc/Vc>
+#include "../tsc.h"
+
+/*
+ * This benchmark shows how SimdArray<float, N> is split into native vectors (and scalars)
+ * for N = 3...64 and compares the run time of a simple kernel on SimdArray<float, N>
+ * objects to the same kernel written as a scalar loop. Sizes that are a multiple of the
+ * narrowest vector width of the target should run at (close to) the speed of the native
+ * vector width, while scalar remainders show up as a step in the cycles per value.
+ */
+
+/*
+ * Returns the widths of the native pieces of SimdArray<T, N> as a string, e.g. "8 4" for
+ * SimdArray<float, 12> with AVX.
+ */
+template <typename A>
+std::string pieces(std::true_type)
+{
+    return std::to_string(A::vector_type::Size) + ' ';
+}
+template <typename A>
+std::string pieces(std::false_type)
+{
+    using A0 = typename A::storage_type0;
+    using A1 = typename A::storage_type1;
+    return pieces<A0>(std::integral_constant<bool, A0::Size == A0::vector_type::Size>()) +
+           pieces<A1>(std::integral_constant<bool, A1::Size == A1::vector_type::Size>());
+}
+
+// benchmark() uses the largest multiple of N that is not larger than Values
+static constexpr std::size_t Values = 64 * 3 * 5 * 7;
+static constexpr int Repetitions = 100;
+
+template <typename A> Vc_ALWAYS_INLINE A kernel(A x, A y, float a)
+{
+    return a * x + y * y;
+}
+
+template <std::size_t N> void benchmark(std::vector<float> &x, std::vector<float> &y)
+{
+    using A = Vc::SimdArray<float, N>;
+    const std::size_t n = Values / N * N;
+    TimeStampCounter tsc;
+    unsigned long long simdCycles = ~0ull;
+    unsigned long long scalarCycles = ~0ull;
+    for (int rep = 0; rep < Repetitions; ++rep) {
+        tsc.start();
+        for (std::size_t i = 0; i < n; i += N) {
+            kernel(A(&x[i], Vc::Unaligned), A(&y[i], Vc::Unaligned), 0.5f)
+                .store(&y[i], Vc::Unaligned);
+        }
+        tsc.stop();
+        simdCycles = std::min(simdCycles, tsc.cycles());
+
+        tsc.start();
+        for (std::size_t i = 0; i < n; i += N) {
+            for (std::size_t j = 0; j < N; ++j) {
+                y[i + j] = kernel(x[i + j], y[i + j], 0.5f);
+            }
+        }
+        tsc.stop();
+        scalarCycles = std::min(scalarCycles, tsc.cycles());
+    }
+    std::printf("%3d  %-22s %8.3f %8.3f\n", int(N),
+                pieces<A>(std::integral_constant<bool, N == A::vector_type::Size>()).c_str(),
+                double(simdCycles) / n, double(scalarCycles) / n);
+}
+
+template <std::size_t... Ns>
+void benchmarkAll(std::vector<float> &x, std::vector<float> &y, Vc::index_sequence<Ns...>)
+{
+    auto &&unused = {(benchmark<Ns + 3>(x, y), 0)...};
+    if (&unused == &unused) {}
+}
+
+int main()
+{
+    std::vector<float> x(Values), y(Values);
+    for (std::size_t i = 0; i < Values; ++i) {
+        x[i] = float(i % 17) * 0.125f;
+        y[i] = float(i % 5) * 0.0625f;
+    }
+    std::printf("  N  pieces                 SimdArray   scalar  (cycles/value)\n");
+    benchmarkAll(x, y, Vc::make_index_sequence<62>());
+    return 0;
+}
@@ -63,9 +63,9 @@ using uint_v = Vector<uint>;
 using short_v = Vector<short>;
 /// vector of unsigned short integers
 using ushort_v = Vector<ushort>;
-///\internal vector of signed long long integers
+/// vector of signed long long integers
 using llong_v = Vector<llong>;
-///\internal vector of unsigned long long integers
+/// vector of unsigned long long integers
 using ullong_v = Vector<ullong>;
 ///\internal vector of signed long integers
 using long_v = Vector<long>;
@@ -252,6 +252,8 @@ constexpr std::size_t MemoryAlignment = alignof(MemoryAlignedBase);
 #include "common/algorithms.h"
 #include "common/where.h"
 #include "common/iif.h"
+#include "common/permute.h"
+#include "common/quantize.h"
 
 #ifndef Vc_NO_STD_FUNCTIONS
 namespace std
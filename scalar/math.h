@@ -29,6 +29,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define VC_SCALAR_MATH_H_
 
 #include <cstdlib>
+#include <limits>
 #include "macros.h"
 
 namespace Vc_VERSIONED_NAMESPACE
@@ -70,8 +71,33 @@ Vc_INTRINSIC Vc_CONST Scalar::double_v copysign(Scalar::double_v mag,
         return Scalar::V(std::max(x.data(), y.data()));                                  \
     }
 Vc_ALL_VECTOR_TYPES(Vc_MINMAX);
+Vc_MINMAX(schar_v);
+Vc_MINMAX(uchar_v);
+Vc_MINMAX(llong_v);
+Vc_MINMAX(ullong_v);
 #undef Vc_MINMAX
 
+template <typename T, typename = enable_if<std::is_integral<T>::value && (sizeof(T) < sizeof(int))>>
+Vc_ALWAYS_INLINE Scalar::Vector<T> add_sat(const Scalar::Vector<T> &x, const Scalar::Vector<T> &y)
+{
+    const int r = int(x.data()) + int(y.data());
+    return T(std::min<int>(std::max<int>(r, std::numeric_limits<T>::min()),
+                           std::numeric_limits<T>::max()));
+}
+template <typename T, typename = enable_if<std::is_integral<T>::value && (sizeof(T) < sizeof(int))>>
+Vc_ALWAYS_INLINE Scalar::Vector<T> sub_sat(const Scalar::Vector<T> &x, const Scalar::Vector<T> &y)
+{
+    const int r = int(x.data()) - int(y.data());
+    return T(std::min<int>(std::max<int>(r, std::numeric_limits<T>::min()),
+                           std::numeric_limits<T>::max()));
+}
+template <typename T, typename = enable_if<sizeof(T) == 1>>
+Vc_ALWAYS_INLINE Scalar::Vector<T> nibble_lookup(const Scalar::Vector<T> &x,
+                                                 const T (&table)[16])
+{
+    return table[x.data() & 0x0f];
+}
+
 template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> sqrt (const Scalar::Vector<T> &x)
 {
     return Scalar::Vector<T>(std::sqrt(x.data()));
@@ -85,7 +111,8 @@ template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> rsqrt(const Scala
 template <typename T,
           typename = enable_if<std::is_same<T, double>::value || std::is_same<T, float>::value ||
                                std::is_same<T, short>::value ||
-                               std::is_same<T, int>::value>>
+                               std::is_same<T, int>::value ||
+                               std::is_same<T, long long>::value>>
 Vc_ALWAYS_INLINE Vc_PURE Scalar::Vector<T> abs(Scalar::Vector<T> x)
 {
     return std::abs(x.data());
@@ -180,23 +207,14 @@ template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> round(const Scala
     return x;
 }
 
-namespace
-{
-    template<typename T> bool _realIsEvenHalf(T x) {
-        const T two = 2;
-        const T half = 0.5;
-        const T f = std::floor(x * half) * two;
-        return (x - f) == half;
-    }
-} // namespace
 template<> Vc_ALWAYS_INLINE Scalar::Vector<float>  round(const Scalar::Vector<float>  &x)
 {
-    return Scalar::float_v(std::floor(x.data() + 0.5f) - (_realIsEvenHalf(x.data()) ? 1.f : 0.f));
+    return Scalar::float_v(std::nearbyint(x.data()));
 }
 
 template<> Vc_ALWAYS_INLINE Scalar::Vector<double> round(const Scalar::Vector<double> &x)
 {
-    return Scalar::double_v(std::floor(x.data() + 0.5 ) - (_realIsEvenHalf(x.data()) ? 1.  : 0. ));
+    return Scalar::double_v(std::nearbyint(x.data()));
 }
 
 template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> reciprocal(const Scalar::Vector<T> &x)
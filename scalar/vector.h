@@ -241,6 +241,7 @@ template <typename T> class Vector<T, VectorAbi::Scalar>
         Vc_INTRINSIC Vector shifted(int amount) const { return amount == 0 ? *this : Zero(); }
         Vc_INTRINSIC Vector rotated(int) const { return *this; }
         Vc_INTRINSIC Vector reversed() const { return *this; }
+        Vc_INTRINSIC Vector permute(const IndexType &) const { return *this; }
         Vc_INTRINSIC Vector sorted() const { return *this; }
 
         template <typename F> void callWithValuesSorted(F &&f) { f(m_data); }
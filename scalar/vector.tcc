@@ -78,6 +78,21 @@ Vc_INTRINSIC void Vector<T, VectorAbi::Scalar>::store(U *mem, Mask mask, Flags)
         mem[0] = m_data;
 }
 
+// compressStore / expandLoad {{{1
+template <typename T>
+Vc_INTRINSIC std::size_t Vector<T, VectorAbi::Scalar>::compressStore(EntryType *mem,
+                                                                     Mask mask) const
+{
+    mem[0] = m_data;
+    return mask.data() ? 1 : 0;
+}
+template <typename T>
+Vc_INTRINSIC Vector<T, VectorAbi::Scalar> Vector<T, VectorAbi::Scalar>::expandLoad(
+    const EntryType *mem, Mask mask)
+{
+    return mask.data() ? Vector(mem[0]) : Zero();
+}
+
 // gather {{{1
 template <typename T>
 template <typename MT, typename IT>
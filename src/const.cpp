@@ -73,7 +73,7 @@ namespace AVX
         doubleConstant< 1, 0x71de3567d48a1ull, -19>(), // ~ 1/9!
         doubleConstant<-1, 0xae5e5a9291f5dull, -26>(), // ~-1/11!
         doubleConstant< 1, 0x5d8fd1fd19ccdull, -33>(), // ~ 1/13!
-        0., // padding (for alignment with float)
+        536870912., // loss threshold (2^29)
         doubleConstant<1, 0x8BE60DB939105ull,  0>(), // 4/π
         doubleConstant<1, 0x921fb54442d18ull,  0>(), // π/2
         doubleConstant<1, 0x921fb54442d18ull,  1>(), // π
@@ -273,6 +273,59 @@ namespace Common
         0xffffffffU, 0xffffffffU, 0xffffffffU, 0xffffffffU, 0xffffffffU, 0xffffffffU, 0xffffffffU, 0xffffffffU
     };
 
+    // the binary digits of 2/π in chunks of 26 bits: TwoOverPiBits[j] holds the bits
+    // 26j+1 to 26j+26 after the binary point, scaled into [0, 1)
+    alignas(64) const double TwoOverPiBits[48] = {
+        0x28be60d / 67108864.,
+        0x2e4e441 / 67108864.,
+        0x14a7f09 / 67108864.,
+        0x357d1f5 / 67108864.,
+        0x0d37703 / 67108864.,
+        0x1b62959 / 67108864.,
+        0x24f10e4 / 67108864.,
+        0x041fe51 / 67108864.,
+        0x18eaf7a / 67108864.,
+        0x3bc561b / 67108864.,
+        0x1c91b8e / 67108864.,
+        0x2424dd2 / 67108864.,
+        0x3801924 / 67108864.,
+        0x2eea09d / 67108864.,
+        0x064873f / 67108864.,
+        0x21deb1c / 67108864.,
+        0x2c4a69c / 67108864.,
+        0x3ee8823 / 67108864.,
+        0x17d4bae / 67108864.,
+        0x34484e9 / 67108864.,
+        0x271c09a / 67108864.,
+        0x345f7e4 / 67108864.,
+        0x04e6475 / 67108864.,
+        0x2398353 / 67108864.,
+        0x0e7d272 / 67108864.,
+        0x045f8bb / 67108864.,
+        0x37e4a0e / 67108864.,
+        0x31ff897 / 67108864.,
+        0x3ff7816 / 67108864.,
+        0x180fef2 / 67108864.,
+        0x3c462d6 / 67108864.,
+        0x20a6d1f / 67108864.,
+        0x1b4d9fb / 67108864.,
+        0x0f27cb0 / 67108864.,
+        0x26dd3d1 / 67108864.,
+        0x23f669e / 67108864.,
+        0x17fa8b5 / 67108864.,
+        0x3527bac / 67108864.,
+        0x1faf97c / 67108864.,
+        0x17b3d07 / 67108864.,
+        0x0e7de29 / 67108864.,
+        0x1292ea6 / 67108864.,
+        0x2fed7ec / 67108864.,
+        0x11f8d5d / 67108864.,
+        0x021580c / 67108864.,
+        0x3046fc7 / 67108864.,
+        0x2daeafc / 67108864.,
+        0x0cfbc20 / 67108864.
+    };
+
     const char LIBRARY_VERSION[] = Vc_VERSION_STRING;
     const unsigned int LIBRARY_VERSION_NUMBER = Vc_VERSION_NUMBER;
     const unsigned int LIBRARY_ABI_VERSION = Vc_LIBRARY_ABI_VERSION;
@@ -344,7 +397,7 @@ namespace SSE
         Vc_2((doubleConstant<-1, 0xae5e5a9291f5dull, -26>())), // ~-1/11!
         Vc_2((doubleConstant< 1, 0x5d8fd1fd19ccdull, -33>())), // ~ 1/13!
     // cacheline 9
-        Vc_2(0.), // padding (for alignment with float)
+        Vc_2(536870912.), // loss threshold (2^29)
         Vc_2((doubleConstant<1, 0x8BE60DB939105ull,  0>())), // 4/π
         Vc_2((doubleConstant<1, 0x921fb54442d18ull,  0>())), // π/2
         Vc_2((doubleConstant<1, 0x921fb54442d18ull,  1>())), // π
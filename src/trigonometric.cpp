@@ -101,6 +101,79 @@ static Vc_ALWAYS_INLINE double_v_for<Abi> sinSeries(const double_v_for<Abi> &x)
         + x;
 }
 
+/*
+ * Payne-Hanek style argument reduction for large arguments:
+ *
+ * Returns r ≈ x - n * π/2 with |r| ≤ π/4 and sets quarter = n mod 4. x must be finite and
+ * non-negative.
+ *
+ * Write x = X * 2^(26 * j0) and split 2/π into 26-bit chunks c_j (TwoOverPiBits[j] * 2^-26j).
+ * Since the mantissa of x is an integer, all chunks j < j0 contribute multiples of 4 to
+ * x * 2/π, which do not change sin or cos, and are skipped. X is split into two halves of
+ * 26 bits, thus every product with a chunk is exact. The products are reduced modulo 4
+ * and accumulated with Knuth's two-sum into a double-double in [0, 1), while the integral
+ * parts are counted separately.
+ */
+template <typename V> static Vc_ALWAYS_INLINE V reduceLargeArgument(const V &x, V &quarter)
+{
+    using IV = SimdArray<int, V::Size>;
+    IV e;
+    frexp(x, &e);
+    // the mantissa of x as integer is scaled by 2^(e - 53); skip all chunks whose bits
+    // only contribute multiples of 4: j0 = max(0, e - 55) / 26
+    IV j0 = e - 55;
+    j0.setZero(j0 < 0);
+    j0 = (j0 * 2521) >> 16;  // == j0 / 26 for j0 < 1200
+    const V X = ldexp(x, -26 * j0);
+    const V tmp = X * 134217729.;  // 2^27 + 1
+    const V Xhi = tmp - (tmp - X);
+    const V Xlo = X - Xhi;
+
+    V hi = V::Zero();
+    V lo = V::Zero();
+    quarter = V::Zero();
+    double scale = 1.;
+    for (int k = 0; k < 8; ++k) {
+        const V c = V(Common::TwoOverPiBits, j0 + k) * scale;
+        scale *= 1. / 67108864.;
+        V p[2] = {Xhi * c, Xlo * c};
+        for (V &pk : p) {
+            if (k < 3) {
+                pk -= round(pk * 0.25) * 4.;  // exact, also for small negative pk
+            }
+            const V s = hi + pk;
+            const V b = s - hi;
+            lo += (hi - (s - b)) + (pk - b);
+            const V f = floor(s);
+            hi = s - f;
+            quarter += f;
+        }
+    }
+    const V n = round(hi + lo);
+    quarter += n;
+    quarter -= floor(quarter * 0.25) * 4.;
+    hi -= n;
+    // (hi + lo) * π/2 with π/2 as double-double
+    const double pi_2_hi = Vc::Detail::doubleConstant<1, 0x921fb54442d18ull, 0>();
+    const double pi_2_lo = Vc::Detail::doubleConstant<1, 0x1a62633145c07ull, -54>();
+    return hi * pi_2_hi + (hi * pi_2_lo + lo * pi_2_hi);
+}
+
+/*
+ * Replaces z and quadrant of foldInput with the result of reduceLargeArgument where large
+ * is set. Kept out of line, since it is only needed for rare inputs.
+ */
+template <typename V, typename IV>
+Vc_NEVER_INLINE static void foldLargeInput(const V &x, const typename V::Mask &large, V &z,
+                                           IV &quadrant)
+{
+    using D = SimdArray<double, V::Size>;
+    D quarter;
+    const D r = reduceLargeArgument(simd_cast<D>(iif(large, x, V::One())), quarter);
+    z(large) = simd_cast<V>(r);
+    quadrant(simd_cast<typename IV::Mask>(large)) = simd_cast<IV>(quarter) * 2;
+}
+
 template <typename Abi>
 static Vc_ALWAYS_INLINE float_v_for<Abi> foldInput(float_v_for<Abi> x, float_int_v<Abi> &quadrant)
 {
@@ -119,7 +192,12 @@ static Vc_ALWAYS_INLINE float_v_for<Abi> foldInput(float_v_for<Abi> x, float_int
         const V y = simd_cast<V>(quadrant);
         quadrant &= 7;
 
-        return ((x - y * C::_pi_4_hi()) - y * C::_pi_4_rem1()) - y * C::_pi_4_rem2();
+        V z = ((x - y * C::_pi_4_hi()) - y * C::_pi_4_rem1()) - y * C::_pi_4_rem2();
+        const auto large = x > C::lossThreshold() && isfinite(x);
+        if (Vc_IS_UNLIKELY(any_of(large))) {
+            foldLargeInput(x, large, z, quadrant);
+        }
+        return z;
     }
 template <typename Abi>
 static Vc_ALWAYS_INLINE double_v_for<Abi> foldInput(double_v_for<Abi> x,
@@ -139,7 +217,12 @@ static Vc_ALWAYS_INLINE double_v_for<Abi> foldInput(double_v_for<Abi> x,
 
         // since y is an integer we don't need to split y into low and high parts until the integer
         // requires more bits than there are zero bits at the end of _pi_4_hi (30 bits -> 1e9)
-        return ((x - y * C::_pi_4_hi()) - y * C::_pi_4_rem1()) - y * C::_pi_4_rem2();
+        V r = ((x - y * C::_pi_4_hi()) - y * C::_pi_4_rem1()) - y * C::_pi_4_rem2();
+        const auto large = x > C::lossThreshold() && isfinite(x);
+        if (Vc_IS_UNLIKELY(any_of(large))) {
+            foldLargeInput(x, large, r, quadrant);
+        }
+        return r;
     }
 } // anonymous namespace
 
@@ -120,6 +120,42 @@ Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<uint  , short >) { return _mm
 Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<short , short >) { return v; }
 Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<ushort, short >) { return v; }
 Vc_INTRINSIC __m128i convert(__m128d v, ConvertTag<double, short >) { return convert(convert(v, ConvertTag<double, int>()), ConvertTag<int, short>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<schar , short >) { return cvtepi8_epi16(v); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<uchar , short >) { return cvtepu8_epi16(v); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<llong , llong >) { return v; }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<ullong, llong >) { return v; }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<int   , llong >) { return cvtepi32_epi64(v); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<uint  , llong >) { return cvtepu32_epi64(v); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<llong , ullong>) { return v; }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<ullong, ullong>) { return v; }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<int   , ullong>) { return cvtepi32_epi64(v); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<uint  , ullong>) { return cvtepu32_epi64(v); }
+// there is no packed 64-bit float <-> int conversion before AVX-512DQ: cvttsd2si per entry
+Vc_INTRINSIC __m128i convert(__m128d v, ConvertTag<double, llong >) {
+    return _mm_set_epi64x(static_cast<llong>(_mm_cvtsd_f64(_mm_unpackhi_pd(v, v))),
+                          static_cast<llong>(_mm_cvtsd_f64(v)));
+}
+Vc_INTRINSIC __m128i convert(__m128d v, ConvertTag<double, ullong>) {
+    return _mm_set_epi64x(
+        static_cast<llong>(static_cast<ullong>(_mm_cvtsd_f64(_mm_unpackhi_pd(v, v)))),
+        static_cast<llong>(static_cast<ullong>(_mm_cvtsd_f64(v))));
+}
+// hi * 2^32 + lo is exact up to the final addition, which rounds like a scalar conversion
+Vc_INTRINSIC __m128d convert(__m128i v, ConvertTag<llong , double>) {
+    const __m128d hi = _mm_cvtepi32_pd(_mm_shuffle_epi32(v, _MM_SHUFFLE(3, 1, 3, 1)));
+    const __m128d lo = convert(_mm_shuffle_epi32(v, _MM_SHUFFLE(2, 0, 2, 0)), ConvertTag<uint, double>());
+    return _mm_add_pd(_mm_mul_pd(hi, _mm_set1_pd(4294967296.)), lo);
+}
+Vc_INTRINSIC __m128d convert(__m128i v, ConvertTag<ullong, double>) {
+    const __m128d hi = convert(_mm_shuffle_epi32(v, _MM_SHUFFLE(3, 1, 3, 1)), ConvertTag<uint, double>());
+    const __m128d lo = convert(_mm_shuffle_epi32(v, _MM_SHUFFLE(2, 0, 2, 0)), ConvertTag<uint, double>());
+    return _mm_add_pd(_mm_mul_pd(hi, _mm_set1_pd(4294967296.)), lo);
+}
+// the low 32 bits of each entry, zero-extended to a full vector
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<llong , int   >) { return _mm_move_epi64(_mm_shuffle_epi32(v, _MM_SHUFFLE(3, 3, 2, 0))); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<ullong, int   >) { return _mm_move_epi64(_mm_shuffle_epi32(v, _MM_SHUFFLE(3, 3, 2, 0))); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<llong , uint  >) { return _mm_move_epi64(_mm_shuffle_epi32(v, _MM_SHUFFLE(3, 3, 2, 0))); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<ullong, uint  >) { return _mm_move_epi64(_mm_shuffle_epi32(v, _MM_SHUFFLE(3, 3, 2, 0))); }
 Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<int   , ushort>) {
     auto tmp0 = _mm_unpacklo_epi16(v, _mm_setzero_si128());  // 0 4 X X 1 5 X X
     auto tmp1 = _mm_unpackhi_epi16(v, _mm_setzero_si128());  // 2 6 X X 3 7 X X
@@ -33,6 +33,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "../avx/intrinsics.h"
 #endif
 #include "vectorhelper.h"
+#include "../common/compress.h"
 
 #include "macros.h"
 
@@ -329,6 +330,17 @@ Vc_INTRINSIC __m128 load(const T *mem, Flags f, LoadTag<__m128, float>)
 {
     return _mm_cvtepi32_ps(load<__m128i, int>(mem, f));
 }
+template <typename Flags>
+Vc_INTRINSIC __m128 load(const half *mem, Flags, LoadTag<__m128, float>)
+{
+    // 64 bit loads are not available as streaming loads, and can always be unaligned
+    return SSE::cvtph_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(mem)));
+}
+template <typename Flags>
+Vc_INTRINSIC __m128 load(const bfloat16 *mem, Flags, LoadTag<__m128, float>)
+{
+    return SSE::cvtbf16_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(mem)));
+}
 
 // shifted{{{1
 template <int amount, typename T>
@@ -408,6 +420,73 @@ Vc_INTRINSIC Vc_CONST unsigned int popcnt32(unsigned int n)
 #endif
 }
 
+// compress/expand{{{1
+#ifdef Vc_IMPL_SSSE3
+/**\internal
+ * Moves the entries of \p x selected by \p bits to the front (in order) and zeroes the
+ * rest.
+ */
+template <std::size_t EntrySize> Vc_INTRINSIC Vc_PURE __m128i compress(__m128i x, int bits)
+{
+    return _mm_shuffle_epi8(
+        x, _mm_load_si128(reinterpret_cast<const __m128i *>(
+               Common::ByteShuffleTable<EntrySize, false>::data[bits].bytes)));
+}
+/**\internal
+ * Distributes the leading entries of \p x (in order) to the entries selected by \p bits
+ * and zeroes the rest.
+ */
+template <std::size_t EntrySize> Vc_INTRINSIC Vc_PURE __m128i expand(__m128i x, int bits)
+{
+    return _mm_shuffle_epi8(
+        x, _mm_load_si128(reinterpret_cast<const __m128i *>(
+               Common::ByteShuffleTable<EntrySize, true>::data[bits].bytes)));
+}
+#endif
+
+// permute{{{1
+#ifdef Vc_IMPL_SSSE3
+/**\internal
+ * Returns the entries of \p x selected by the runtime indexes in \p idx. For 2-byte
+ * entries \p idx holds 16-bit indexes, otherwise 32-bit indexes (of which only the first
+ * 16 / EntrySize are used). The indexes must be in the range [0, 16 / EntrySize).
+ */
+template <std::size_t EntrySize>
+Vc_INTRINSIC Vc_CONST __m128i permute(__m128i x, __m128i idx,
+                                      enable_if<EntrySize == 2> = nullarg)
+{
+    const __m128i ctrl = _mm_add_epi8(
+        _mm_shuffle_epi8(_mm_slli_epi16(idx, 1),
+                         _mm_setr_epi8(0, 0, 2, 2, 4, 4, 6, 6, 8, 8, 10, 10, 12, 12, 14, 14)),
+        _mm_setr_epi8(0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1));
+    return _mm_shuffle_epi8(x, ctrl);
+}
+template <std::size_t EntrySize>
+Vc_INTRINSIC Vc_CONST __m128i permute(__m128i x, __m128i idx,
+                                      enable_if<EntrySize == 4> = nullarg)
+{
+#ifdef Vc_IMPL_AVX
+    return _mm_castps_si128(_mm_permutevar_ps(_mm_castsi128_ps(x), idx));
+#else
+    const __m128i ctrl = _mm_add_epi8(
+        _mm_shuffle_epi8(_mm_slli_epi32(idx, 2),
+                         _mm_setr_epi8(0, 0, 0, 0, 4, 4, 4, 4, 8, 8, 8, 8, 12, 12, 12, 12)),
+        _mm_setr_epi8(0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3));
+    return _mm_shuffle_epi8(x, ctrl);
+#endif
+}
+template <std::size_t EntrySize>
+Vc_INTRINSIC Vc_CONST __m128i permute(__m128i x, __m128i idx,
+                                      enable_if<EntrySize == 8> = nullarg)
+{
+    const __m128i ctrl = _mm_add_epi8(
+        _mm_shuffle_epi8(_mm_slli_epi32(idx, 3),
+                         _mm_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4)),
+        _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 0, 1, 2, 3, 4, 5, 6, 7));
+    return _mm_shuffle_epi8(x, ctrl);
+}
+#endif
+
 // mask_cast{{{1
 template<size_t From, size_t To, typename R> Vc_INTRINSIC Vc_CONST R mask_cast(__m128i k)
 {
@@ -481,6 +560,10 @@ Vc_ALWAYS_INLINE Vc_CONST __m128d negate(__m128d v, std::integral_constant<std::
 {
     return _mm_xor_pd(v, SSE::_mm_setsignmask_pd());
 }
+Vc_ALWAYS_INLINE Vc_CONST __m128i negate(__m128i v, std::integral_constant<std::size_t, 8>)
+{
+    return _mm_sub_epi64(_mm_setzero_si128(), v);
+}
 Vc_ALWAYS_INLINE Vc_CONST __m128i negate(__m128i v, std::integral_constant<std::size_t, 4>)
 {
 #ifdef Vc_IMPL_SSSE3
@@ -497,6 +580,14 @@ Vc_ALWAYS_INLINE Vc_CONST __m128i negate(__m128i v, std::integral_constant<std::
     return _mm_sub_epi16(_mm_setzero_si128(), v);
 #endif
 }
+Vc_ALWAYS_INLINE Vc_CONST __m128i negate(__m128i v, std::integral_constant<std::size_t, 1>)
+{
+#ifdef Vc_IMPL_SSSE3
+    return _mm_sign_epi8(v, allone<__m128i>());
+#else
+    return _mm_sub_epi8(_mm_setzero_si128(), v);
+#endif
+}
 
 // xor_{{{1
 Vc_INTRINSIC __m128 xor_(__m128 a, __m128 b) { return _mm_xor_ps(a, b); }
@@ -532,6 +623,8 @@ Vc_INTRINSIC __m128i add(__m128i a, __m128i b,  short) { return _mm_add_epi16(a,
 Vc_INTRINSIC __m128i add(__m128i a, __m128i b, ushort) { return _mm_add_epi16(a, b); }
 Vc_INTRINSIC __m128i add(__m128i a, __m128i b,  schar) { return _mm_add_epi8 (a, b); }
 Vc_INTRINSIC __m128i add(__m128i a, __m128i b,  uchar) { return _mm_add_epi8 (a, b); }
+Vc_INTRINSIC __m128i add(__m128i a, __m128i b,  llong) { return _mm_add_epi64(a, b); }
+Vc_INTRINSIC __m128i add(__m128i a, __m128i b, ullong) { return _mm_add_epi64(a, b); }
 
 // sub{{{1
 Vc_INTRINSIC __m128  sub(__m128  a, __m128  b,  float) { return _mm_sub_ps(a, b); }
@@ -542,6 +635,8 @@ Vc_INTRINSIC __m128i sub(__m128i a, __m128i b,  short) { return _mm_sub_epi16(a,
 Vc_INTRINSIC __m128i sub(__m128i a, __m128i b, ushort) { return _mm_sub_epi16(a, b); }
 Vc_INTRINSIC __m128i sub(__m128i a, __m128i b,  schar) { return _mm_sub_epi8 (a, b); }
 Vc_INTRINSIC __m128i sub(__m128i a, __m128i b,  uchar) { return _mm_sub_epi8 (a, b); }
+Vc_INTRINSIC __m128i sub(__m128i a, __m128i b,  llong) { return _mm_sub_epi64(a, b); }
+Vc_INTRINSIC __m128i sub(__m128i a, __m128i b, ullong) { return _mm_sub_epi64(a, b); }
 
 // mul{{{1
 Vc_INTRINSIC __m128  mul(__m128  a, __m128  b,  float) { return _mm_mul_ps(a, b); }
@@ -568,7 +663,7 @@ Vc_INTRINSIC __m128i mul(__m128i a, __m128i b,  schar) {
     return reinterpret_cast<const __m128i &>(x);
 #else
     return or_(
-        and_(_mm_mullo_epi16(a, b), _mm_slli_epi16(allone<__m128i>(), 8)),
+        and_(_mm_mullo_epi16(a, b), _mm_srli_epi16(allone<__m128i>(), 8)),
         _mm_slli_epi16(_mm_mullo_epi16(_mm_srli_si128(a, 1), _mm_srli_si128(b, 1)), 8));
 #endif
 }
@@ -580,10 +675,12 @@ Vc_INTRINSIC __m128i mul(__m128i a, __m128i b,  uchar) {
     return reinterpret_cast<const __m128i &>(x);
 #else
     return or_(
-        and_(_mm_mullo_epi16(a, b), _mm_slli_epi16(allone<__m128i>(), 8)),
+        and_(_mm_mullo_epi16(a, b), _mm_srli_epi16(allone<__m128i>(), 8)),
         _mm_slli_epi16(_mm_mullo_epi16(_mm_srli_si128(a, 1), _mm_srli_si128(b, 1)), 8));
 #endif
 }
+Vc_INTRINSIC __m128i mul(__m128i a, __m128i b,  llong) { return SSE::VectorHelper< llong>::mul(a, b); }
+Vc_INTRINSIC __m128i mul(__m128i a, __m128i b, ullong) { return SSE::VectorHelper<ullong>::mul(a, b); }
 
 // div{{{1
 Vc_INTRINSIC __m128  div(__m128  a, __m128  b,  float) { return _mm_div_ps(a, b); }
@@ -608,6 +705,8 @@ Vc_INTRINSIC __m128i min(__m128i a, __m128i b,  short) { return _mm_min_epi16(a,
 Vc_INTRINSIC __m128i min(__m128i a, __m128i b, ushort) { return SSE::min_epu16(a, b); }
 Vc_INTRINSIC __m128i min(__m128i a, __m128i b,  schar) { return SSE::min_epi8 (a, b); }
 Vc_INTRINSIC __m128i min(__m128i a, __m128i b,  uchar) { return _mm_min_epu8 (a, b); }
+Vc_INTRINSIC __m128i min(__m128i a, __m128i b,  llong) { return SSE::VectorHelper< llong>::min(a, b); }
+Vc_INTRINSIC __m128i min(__m128i a, __m128i b, ullong) { return SSE::VectorHelper<ullong>::min(a, b); }
 
 // max{{{1
 Vc_INTRINSIC __m128  max(__m128  a, __m128  b,  float) { return _mm_max_ps(a, b); }
@@ -618,6 +717,8 @@ Vc_INTRINSIC __m128i max(__m128i a, __m128i b,  short) { return _mm_max_epi16(a,
 Vc_INTRINSIC __m128i max(__m128i a, __m128i b, ushort) { return SSE::max_epu16(a, b); }
 Vc_INTRINSIC __m128i max(__m128i a, __m128i b,  schar) { return SSE::max_epi8 (a, b); }
 Vc_INTRINSIC __m128i max(__m128i a, __m128i b,  uchar) { return _mm_max_epu8 (a, b); }
+Vc_INTRINSIC __m128i max(__m128i a, __m128i b,  llong) { return SSE::VectorHelper< llong>::max(a, b); }
+Vc_INTRINSIC __m128i max(__m128i a, __m128i b, ullong) { return SSE::VectorHelper<ullong>::max(a, b); }
 
 // horizontal add{{{1
 Vc_INTRINSIC  float add(__m128  a,  float) {
@@ -642,14 +743,10 @@ Vc_INTRINSIC  short add(__m128i a,  short) {
     return _mm_cvtsi128_si32(a);  // & 0xffff is implicit
 }
 Vc_INTRINSIC ushort add(__m128i a, ushort) { return add(a, short()); }
-Vc_INTRINSIC  schar add(__m128i a,  schar) {
-    a = add(a, _mm_srli_si128(a, 8), schar());
-    a = add(a, _mm_srli_si128(a, 4), schar());
-    a = add(a, _mm_srli_si128(a, 2), schar());
-    a = add(a, _mm_srli_si128(a, 1), schar());
-    return _mm_cvtsi128_si32(a);  // & 0xff is implicit
-}
-Vc_INTRINSIC  uchar add(__m128i a,  uchar) { return add(a, schar()); }
+Vc_INTRINSIC  schar add(__m128i a,  schar) { return SSE::VectorHelper<schar>::add(a); }
+Vc_INTRINSIC  uchar add(__m128i a,  uchar) { return SSE::VectorHelper<uchar>::add(a); }
+Vc_INTRINSIC  llong add(__m128i a,  llong) { return SSE::VectorHelper< llong>::add(a); }
+Vc_INTRINSIC ullong add(__m128i a, ullong) { return SSE::VectorHelper<ullong>::add(a); }
 
 // horizontal mul{{{1
 Vc_INTRINSIC  float mul(__m128  a,  float) {
@@ -674,13 +771,10 @@ Vc_INTRINSIC  short mul(__m128i a,  short) {
     return _mm_cvtsi128_si32(a);  // & 0xffff is implicit
 }
 Vc_INTRINSIC ushort mul(__m128i a, ushort) { return mul(a, short()); }
-Vc_INTRINSIC  schar mul(__m128i a,  schar) {
-    // convert to two short vectors, multiply them and then do horizontal reduction
-    const __m128i s0 = _mm_srai_epi16(a, 1);
-    const __m128i s1 = Detail::and_(a, _mm_set1_epi32(0x0f0f0f0f));
-    return mul(mul(s0, s1, short()), short());
-}
-Vc_INTRINSIC  uchar mul(__m128i a,  uchar) { return mul(a, schar()); }
+Vc_INTRINSIC  schar mul(__m128i a,  schar) { return SSE::VectorHelper<schar>::mul(a); }
+Vc_INTRINSIC  uchar mul(__m128i a,  uchar) { return SSE::VectorHelper<uchar>::mul(a); }
+Vc_INTRINSIC  llong mul(__m128i a,  llong) { return SSE::VectorHelper< llong>::mul(a); }
+Vc_INTRINSIC ullong mul(__m128i a, ullong) { return SSE::VectorHelper<ullong>::mul(a); }
 
 // horizontal min{{{1
 Vc_INTRINSIC  float min(__m128  a,  float) {
@@ -714,18 +808,10 @@ Vc_INTRINSIC ushort min(__m128i a, ushort) {
     a = min(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 1, 1, 1)), ushort());
     return _mm_cvtsi128_si32(a);  // & 0xffff is implicit
 }
-Vc_INTRINSIC  schar min(__m128i a,  schar) {
-    a = min(a, _mm_shuffle_epi32(a, _MM_SHUFFLE(1, 0, 3, 2)), schar());
-    a = min(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 0, 3, 2)), schar());
-    a = min(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 1, 1, 1)), schar());
-    return std::min(schar(_mm_cvtsi128_si32(a) >> 8), schar(_mm_cvtsi128_si32(a)));
-}
-Vc_INTRINSIC  uchar min(__m128i a,  uchar) {
-    a = min(a, _mm_shuffle_epi32(a, _MM_SHUFFLE(1, 0, 3, 2)), schar());
-    a = min(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 0, 3, 2)), schar());
-    a = min(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 1, 1, 1)), schar());
-    return std::min((_mm_cvtsi128_si32(a) >> 8) & 0xff, _mm_cvtsi128_si32(a) & 0xff);
-}
+Vc_INTRINSIC  schar min(__m128i a,  schar) { return SSE::VectorHelper<schar>::min(a); }
+Vc_INTRINSIC  uchar min(__m128i a,  uchar) { return SSE::VectorHelper<uchar>::min(a); }
+Vc_INTRINSIC  llong min(__m128i a,  llong) { return SSE::VectorHelper< llong>::min(a); }
+Vc_INTRINSIC ullong min(__m128i a, ullong) { return SSE::VectorHelper<ullong>::min(a); }
 
 // horizontal max{{{1
 Vc_INTRINSIC  float max(__m128  a,  float) {
@@ -759,18 +845,10 @@ Vc_INTRINSIC ushort max(__m128i a, ushort) {
     a = max(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 1, 1, 1)), ushort());
     return _mm_cvtsi128_si32(a);  // & 0xffff is implicit
 }
-Vc_INTRINSIC  schar max(__m128i a,  schar) {
-    a = max(a, _mm_shuffle_epi32(a, _MM_SHUFFLE(1, 0, 3, 2)), schar());
-    a = max(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 0, 3, 2)), schar());
-    a = max(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 1, 1, 1)), schar());
-    return std::max(schar(_mm_cvtsi128_si32(a) >> 8), schar(_mm_cvtsi128_si32(a)));
-}
-Vc_INTRINSIC  uchar max(__m128i a,  uchar) {
-    a = max(a, _mm_shuffle_epi32(a, _MM_SHUFFLE(1, 0, 3, 2)), schar());
-    a = max(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 0, 3, 2)), schar());
-    a = max(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 1, 1, 1)), schar());
-    return std::max((_mm_cvtsi128_si32(a) >> 8) & 0xff, _mm_cvtsi128_si32(a) & 0xff);
-}
+Vc_INTRINSIC  schar max(__m128i a,  schar) { return SSE::VectorHelper<schar>::max(a); }
+Vc_INTRINSIC  uchar max(__m128i a,  uchar) { return SSE::VectorHelper<uchar>::max(a); }
+Vc_INTRINSIC  llong max(__m128i a,  llong) { return SSE::VectorHelper< llong>::max(a); }
+Vc_INTRINSIC ullong max(__m128i a, ullong) { return SSE::VectorHelper<ullong>::max(a); }
 
 // sorted{{{1
 template <Vc::Implementation, typename T>
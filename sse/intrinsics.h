@@ -98,6 +98,17 @@ namespace SseIntrinsics
     static Vc_INTRINSIC __m128i Vc_CONST setmin_epi32() { return _mm_load_si128(reinterpret_cast<const __m128i *>(c_general::signMaskFloat)); }
     static Vc_INTRINSIC __m128i Vc_CONST setmin_epi64() { return _mm_load_si128(reinterpret_cast<const __m128i *>(c_general::signMaskDouble)); }
 
+    static Vc_INTRINSIC Vc_CONST long long cvtsi128_si64(__m128i a)
+    {
+#ifdef __x86_64__
+        return _mm_cvtsi128_si64(a);
+#else
+        long long r;
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(&r), a);
+        return r;
+#endif
+    }
+
 #if defined(Vc_IMPL_XOP)
     static Vc_INTRINSIC __m128i Vc_CONST cmplt_epu8(__m128i a, __m128i b) { return _mm_comlt_epu8(a, b); }
     static Vc_INTRINSIC __m128i Vc_CONST cmpgt_epu8(__m128i a, __m128i b) { return _mm_comgt_epu8(a, b); }
@@ -107,6 +118,7 @@ namespace SseIntrinsics
     static Vc_INTRINSIC __m128i Vc_CONST cmpgt_epu32(__m128i a, __m128i b) { return _mm_comgt_epu32(a, b); }
     static Vc_INTRINSIC __m128i Vc_CONST cmplt_epu64(__m128i a, __m128i b) { return _mm_comlt_epu64(a, b); }
     static Vc_INTRINSIC __m128i Vc_CONST cmpgt_epu64(__m128i a, __m128i b) { return _mm_comgt_epu64(a, b); }
+    static Vc_INTRINSIC __m128i Vc_CONST cmpgt_epi64(__m128i a, __m128i b) { return _mm_comgt_epi64(a, b); }
 #else
     static Vc_INTRINSIC __m128i Vc_CONST cmplt_epu8(__m128i a, __m128i b)
     {
@@ -352,6 +364,14 @@ Vc_INTRINSIC Vc_CONST __m128i cvtepi8_epi32(__m128i epi8)
 {
     return _mm_cvtepi8_epi32(epi8);
 }
+Vc_INTRINSIC Vc_CONST __m128i cvtepu32_epi64(__m128i epu32)
+{
+    return _mm_cvtepu32_epi64(epu32);
+}
+Vc_INTRINSIC Vc_CONST __m128i cvtepi32_epi64(__m128i epi32)
+{
+    return _mm_cvtepi32_epi64(epi32);
+}
 Vc_INTRINSIC Vc_PURE __m128i stream_load_si128(__m128i *mem)
 {
     return _mm_stream_load_si128(mem);
@@ -574,6 +594,12 @@ namespace SseIntrinsics
         const __m128i epi16 = _mm_unpacklo_epi8(epi8, neg);
         return _mm_unpacklo_epi16(epi16, _mm_unpacklo_epi8(neg, neg));
     }
+    Vc_INTRINSIC Vc_CONST __m128i cvtepu32_epi64(__m128i epu32) {
+        return _mm_unpacklo_epi32(epu32, _mm_setzero_si128());
+    }
+    Vc_INTRINSIC Vc_CONST __m128i cvtepi32_epi64(__m128i epi32) {
+        return _mm_unpacklo_epi32(epi32, _mm_srai_epi32(epi32, 31));
+    }
     Vc_INTRINSIC Vc_PURE __m128i stream_load_si128(__m128i *mem) {
         return _mm_load_si128(mem);
     }
@@ -680,6 +706,77 @@ namespace SseIntrinsics
         return _mm_stream_load(reinterpret_cast<const int *>(mem));
     }
 
+    // binary16 <-> binary32 conversion of the four values in the low 64 bits
+#ifdef Vc_IMPL_F16C
+    Vc_INTRINSIC Vc_CONST __m128 cvtph_ps(__m128i h) { return _mm_cvtph_ps(h); }
+    Vc_INTRINSIC Vc_CONST __m128i cvtps_ph(__m128 f)
+    {
+        return _mm_cvtps_ph(f, _MM_FROUND_TO_NEAREST_INT);
+    }
+#else
+    Vc_INTRINSIC Vc_CONST __m128 cvtph_ps(__m128i h)
+    {
+        // see Vc::Detail::half_to_float for the scalar variant
+        const __m128i h32 = _mm_unpacklo_epi16(h, _mm_setzero_si128());
+        const __m128i expmant = _mm_and_si128(h32, _mm_set1_epi32(0x7fff));
+        const __m128 scaled = _mm_mul_ps(_mm_castsi128_ps(_mm_slli_epi32(expmant, 13)),
+                                         _mm_castsi128_ps(_mm_set1_epi32(239 << 23)));
+        const __m128i infnan = _mm_and_si128(_mm_cmpgt_epi32(expmant, _mm_set1_epi32(0x7bff)),
+                                             _mm_set1_epi32(255 << 23));
+        const __m128i sign = _mm_slli_epi32(_mm_xor_si128(h32, expmant), 16);
+        return _mm_or_ps(scaled, _mm_castsi128_ps(_mm_or_si128(sign, infnan)));
+    }
+    Vc_INTRINSIC Vc_CONST __m128i cvtps_ph(__m128 x)
+    {
+        // see Vc::Detail::float_to_half for the scalar variant
+        const __m128i signmask = _mm_set1_epi32(int(0x80000000u));
+        const __m128i sign = _mm_and_si128(_mm_castps_si128(x), signmask);
+        const __m128i f = _mm_xor_si128(_mm_castps_si128(x), sign);
+
+        const __m128i isNaN = _mm_cmpgt_epi32(f, _mm_set1_epi32(255 << 23));
+        const __m128i isBig = _mm_cmpgt_epi32(f, _mm_set1_epi32((143 << 23) - 1));
+        const __m128i isSmall = _mm_cmplt_epi32(f, _mm_set1_epi32(113 << 23));
+
+        const __m128i big =
+            _mm_or_si128(_mm_set1_epi32(0x7c00), _mm_and_si128(isNaN, _mm_set1_epi32(0x200)));
+        const __m128i small = _mm_sub_epi32(
+            _mm_castps_si128(_mm_add_ps(_mm_castsi128_ps(f),
+                                        _mm_castsi128_ps(_mm_set1_epi32(126 << 23)))),
+            _mm_set1_epi32(126 << 23));
+        const __m128i mantOdd = _mm_and_si128(_mm_srli_epi32(f, 13), _mm_set1_epi32(1));
+        // rebias the exponent ((15 - 127) << 23) and round to nearest even
+        const __m128i normal = _mm_srli_epi32(
+            _mm_add_epi32(_mm_add_epi32(f, _mm_set1_epi32(int(0xc8000fffu))), mantOdd),
+            13);
+
+        __m128i r = blendv_epi8(normal, small, isSmall);
+        r = blendv_epi8(r, big, isBig);
+        r = _mm_or_si128(r, _mm_srli_epi32(sign, 16));
+        // sign-extend the 16-bit values so that packs_epi32 does not saturate
+        r = _mm_srai_epi32(_mm_slli_epi32(r, 16), 16);
+        return _mm_packs_epi32(r, _mm_setzero_si128());
+    }
+#endif
+
+    // bfloat16 <-> binary32 conversion of the four values in the low 64 bits
+    Vc_INTRINSIC Vc_CONST __m128 cvtbf16_ps(__m128i h)
+    {
+        return _mm_castsi128_ps(_mm_unpacklo_epi16(_mm_setzero_si128(), h));
+    }
+    Vc_INTRINSIC Vc_CONST __m128i cvtps_bf16(__m128 x)
+    {
+        // see Vc::Detail::float_to_bfloat16 for the scalar variant
+        const __m128i f = _mm_castps_si128(x);
+        const __m128i lsb = _mm_and_si128(_mm_srli_epi32(f, 16), _mm_set1_epi32(1));
+        const __m128i rounded =
+            _mm_add_epi32(_mm_add_epi32(f, _mm_set1_epi32(0x7fff)), lsb);
+        const __m128i quietNaN = _mm_or_si128(f, _mm_set1_epi32(0x400000));
+        __m128i r = blendv_epi8(rounded, quietNaN, _mm_castps_si128(_mm_cmpunord_ps(x, x)));
+        // arithmetic shift, so that packs_epi32 does not saturate
+        r = _mm_srai_epi32(r, 16);
+        return _mm_packs_epi32(r, _mm_setzero_si128());
+    }
+
 #ifndef __x86_64__
     Vc_INTRINSIC Vc_PURE __m128i _mm_cvtsi64_si128(int64_t x) {
         return _mm_castpd_si128(_mm_load_sd(reinterpret_cast<const double *>(&x)));
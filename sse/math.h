@@ -67,8 +67,13 @@ inline SSE::double_v frexp(const SSE::double_v &v,
     SSE::double_m zeroMask = v == SSE::double_v::Zero();
     ret(isnan(v) || !isfinite(v) || zeroMask) = v;
     exponent.setZero(zeroMask.data());
-    (*e)[0] = exponent[0];
-    (*e)[1] = exponent[2];
+    // address the two Scalar::int_v halves via internal_data0/1 instead of assuming
+    // their layout, but store through may_alias: e may point into the storage of an
+    // SSE::int_v (see Segment<V *>::asSimdArray)
+    typedef int alias_int Vc_MAY_ALIAS;
+    const SSE::int_v &ex = exponent;
+    *reinterpret_cast<alias_int *>(&internal_data(internal_data0(*e)).data()) = ex[0];
+    *reinterpret_cast<alias_int *>(&internal_data(internal_data1(*e)).data()) = ex[2];
     return ret;
 }
 inline SSE::float_v frexp(const SSE::float_v &v, SimdArray<int, 4, SSE::int_v, 4> *e)
@@ -120,9 +125,11 @@ namespace Detail
 {
 static inline void floor_shift(SSE::float_v &v, SSE::float_v::AsArg e)
 {
-    SSE::int_v x = SSE::_mm_setallone_si128();
-    x <<= 23;
-    x >>= simd_cast<SSE::int_v>(e);
+    // -1 << 23 >> e without per-entry shifts: 2^(23 - e) is built in the exponent field
+    // and its negation is the sign-extended mask. e >= 23 keeps all mantissa bits.
+    const SSE::int_v n = min(simd_cast<SSE::int_v>(e), SSE::int_v(23));
+    const SSE::int_v x = -simd_cast<SSE::int_v>(
+        reinterpret_components_cast<SSE::float_v>((SSE::int_v(23 + 127) - n) << 23));
     v = Detail::operator&(v, reinterpret_components_cast<SSE::float_v>(x));
 }
 
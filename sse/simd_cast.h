@@ -98,6 +98,20 @@ Vc_SIMD_CAST_1(  uint_v, ushort_v);
 Vc_SIMD_CAST_1( float_v, ushort_v);
 Vc_SIMD_CAST_1(double_v, ushort_v);
 Vc_SIMD_CAST_1( short_v, ushort_v);
+Vc_SIMD_CAST_1(double_v,  llong_v);
+Vc_SIMD_CAST_1(   int_v,  llong_v);
+Vc_SIMD_CAST_1(  uint_v,  llong_v);
+Vc_SIMD_CAST_1(ullong_v,  llong_v);
+Vc_SIMD_CAST_1(double_v, ullong_v);
+Vc_SIMD_CAST_1(   int_v, ullong_v);
+Vc_SIMD_CAST_1(  uint_v, ullong_v);
+Vc_SIMD_CAST_1( llong_v, ullong_v);
+Vc_SIMD_CAST_1( llong_v, double_v);
+Vc_SIMD_CAST_1(ullong_v, double_v);
+Vc_SIMD_CAST_1( llong_v,    int_v);
+Vc_SIMD_CAST_1(ullong_v,    int_v);
+Vc_SIMD_CAST_1( llong_v,   uint_v);
+Vc_SIMD_CAST_1(ullong_v,   uint_v);
 
 // 2 SSE::Vector to 1 SSE::Vector {{{2
 Vc_SIMD_CAST_2(double_v,    int_v);
@@ -111,6 +125,10 @@ Vc_SIMD_CAST_2(   int_v, ushort_v);
 Vc_SIMD_CAST_2(  uint_v, ushort_v);
 Vc_SIMD_CAST_2( float_v, ushort_v);
 Vc_SIMD_CAST_2(double_v, ushort_v);
+Vc_SIMD_CAST_2( llong_v,    int_v);
+Vc_SIMD_CAST_2(ullong_v,    int_v);
+Vc_SIMD_CAST_2( llong_v,   uint_v);
+Vc_SIMD_CAST_2(ullong_v,   uint_v);
 
 // 3 SSE::Vector to 1 SSE::Vector {{{2
 #define Vc_CAST_(To_)                                                                    \
@@ -151,6 +169,11 @@ template <typename Return, typename T>
 Vc_INTRINSIC Vc_CONST Return
 simd_cast(Scalar::Vector<T> x,
           enable_if<std::is_same<Return, SSE::ushort_v>::value> = nullarg);
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(Scalar::Vector<T> x,
+          enable_if<std::is_same<Return, SSE::llong_v>::value ||
+                    std::is_same<Return, SSE::ullong_v>::value> = nullarg);
 
 // 2 Scalar::Vector to 1 SSE::Vector {{{2
 template <typename Return, typename T>
@@ -177,6 +200,11 @@ template <typename Return, typename T>
 Vc_INTRINSIC Vc_CONST Return
 simd_cast(Scalar::Vector<T> x0, Scalar::Vector<T> x1,
           enable_if<std::is_same<Return, SSE::ushort_v>::value> = nullarg);
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(Scalar::Vector<T> x0, Scalar::Vector<T> x1,
+          enable_if<std::is_same<Return, SSE::llong_v>::value ||
+                    std::is_same<Return, SSE::ullong_v>::value> = nullarg);
 
 // 3 Scalar::Vector to 1 SSE::Vector {{{2
 template <typename Return, typename T>
@@ -372,6 +400,23 @@ Vc_SIMD_CAST_1(  uint_v, ushort_v) { return SSE::convert_int32_to_int16(x.data()
 Vc_SIMD_CAST_1( float_v, ushort_v) { return simd_cast<SSE::ushort_v>(simd_cast<SSE::int_v>(x)); }
 Vc_SIMD_CAST_1(double_v, ushort_v) { return simd_cast<SSE::ushort_v>(simd_cast<SSE::int_v>(x)); }
 Vc_SIMD_CAST_1( short_v, ushort_v) { return x.data(); }
+// to llong_v {{{3
+Vc_SIMD_CAST_1(double_v,  llong_v) { return convert<double, llong>(x.data()); }
+Vc_SIMD_CAST_1(   int_v,  llong_v) { return convert<   int, llong>(x.data()); }
+Vc_SIMD_CAST_1(  uint_v,  llong_v) { return convert<  uint, llong>(x.data()); }
+Vc_SIMD_CAST_1(ullong_v,  llong_v) { return x.data(); }
+// to ullong_v {{{3
+Vc_SIMD_CAST_1(double_v, ullong_v) { return convert<double, ullong>(x.data()); }
+Vc_SIMD_CAST_1(   int_v, ullong_v) { return convert<   int, ullong>(x.data()); }
+Vc_SIMD_CAST_1(  uint_v, ullong_v) { return convert<  uint, ullong>(x.data()); }
+Vc_SIMD_CAST_1( llong_v, ullong_v) { return x.data(); }
+// from llong_v and ullong_v {{{3
+Vc_SIMD_CAST_1( llong_v, double_v) { return convert< llong, double>(x.data()); }
+Vc_SIMD_CAST_1(ullong_v, double_v) { return convert<ullong, double>(x.data()); }
+Vc_SIMD_CAST_1( llong_v,    int_v) { return convert< llong, int>(x.data()); }
+Vc_SIMD_CAST_1(ullong_v,    int_v) { return convert<ullong, int>(x.data()); }
+Vc_SIMD_CAST_1( llong_v,   uint_v) { return convert< llong, uint>(x.data()); }
+Vc_SIMD_CAST_1(ullong_v,   uint_v) { return convert<ullong, uint>(x.data()); }
 // 2 SSE::Vector to 1 SSE::Vector {{{2
 Vc_SIMD_CAST_2(double_v,    int_v) {
 #ifdef Vc_IMPL_AVX
@@ -405,6 +450,11 @@ Vc_SIMD_CAST_2(  uint_v, ushort_v) { return SSE::convert_int32_to_int16(x0.data(
 Vc_SIMD_CAST_2( float_v, ushort_v) { return simd_cast<SSE::ushort_v>(simd_cast<SSE::int_v>(x0), simd_cast<SSE::int_v>(x1)); }
 Vc_SIMD_CAST_2(double_v, ushort_v) { return simd_cast<SSE::ushort_v>(simd_cast<SSE::int_v>(x0, x1)); }
 
+Vc_SIMD_CAST_2( llong_v,    int_v) { return _mm_unpacklo_epi64(convert< llong, int>(x0.data()), convert< llong, int>(x1.data())); }
+Vc_SIMD_CAST_2(ullong_v,    int_v) { return _mm_unpacklo_epi64(convert<ullong, int>(x0.data()), convert<ullong, int>(x1.data())); }
+Vc_SIMD_CAST_2( llong_v,   uint_v) { return _mm_unpacklo_epi64(convert< llong, uint>(x0.data()), convert< llong, uint>(x1.data())); }
+Vc_SIMD_CAST_2(ullong_v,   uint_v) { return _mm_unpacklo_epi64(convert<ullong, uint>(x0.data()), convert<ullong, uint>(x1.data())); }
+
 // 3 SSE::Vector to 1 SSE::Vector {{{2
 Vc_CAST_(short_v) simd_cast(double_v a, double_v b, double_v c)
 {
@@ -466,6 +516,14 @@ Vc_INTRINSIC Vc_CONST Return
     return _mm_setr_epi16(
         x.data(), 0, 0, 0, 0, 0, 0, 0);  // FIXME: use register-register mov
 }
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+    simd_cast(Scalar::Vector<T> x,
+              enable_if<std::is_same<Return, SSE::llong_v>::value ||
+                        std::is_same<Return, SSE::ullong_v>::value>)
+{
+    return _mm_set_epi64x(0, static_cast<typename Return::EntryType>(x.data()));
+}
 
 // 2 Scalar::Vector to 1 SSE::Vector {{{2
 template <typename Return, typename T>
@@ -519,6 +577,16 @@ Vc_INTRINSIC Vc_CONST Return
     return _mm_setr_epi16(
         x0.data(), x1.data(), 0, 0, 0, 0, 0, 0);  // FIXME: use register-register mov
 }
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+    simd_cast(Scalar::Vector<T> x0,
+              Scalar::Vector<T> x1,
+              enable_if<std::is_same<Return, SSE::llong_v>::value ||
+                        std::is_same<Return, SSE::ullong_v>::value>)
+{
+    using U = typename Return::EntryType;
+    return _mm_set_epi64x(static_cast<U>(x1.data()), static_cast<U>(x0.data()));
+}
 
 // 3 Scalar::Vector to 1 SSE::Vector {{{2
 template <typename Return, typename T>
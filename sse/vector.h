@@ -36,6 +36,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "../common/writemaskedvector.h"
 #include "../common/aliasingentryhelper.h"
 #include "../common/memoryfwd.h"
+#include "../common/scalarization.h"
 #include "../common/loadstoreflags.h"
 #include <algorithm>
 #include <cmath>
@@ -199,8 +200,16 @@ template <typename T> class Vector<T, VectorAbi::Sse>
         Vc_ALWAYS_INLINE_L Vc_PURE_L Vector operator-() const Vc_ALWAYS_INLINE_R Vc_PURE_R;
         Vc_INTRINSIC Vc_PURE Vector operator+() const { return *this; }
 
-        Vc_ALWAYS_INLINE Vector  Vc_VDECL operator<< (AsArg shift) const { return generate([&](int i) { return get(*this, i) << get(shift, i); }); }
-        Vc_ALWAYS_INLINE Vector  Vc_VDECL operator>> (AsArg shift) const { return generate([&](int i) { return get(*this, i) >> get(shift, i); }); }
+        Vc_ALWAYS_INLINE Vector  Vc_VDECL operator<< (AsArg shift) const
+        {
+            Common::scalarized_operation(this);
+            return generate([&](int i) { return get(*this, i) << get(shift, i); });
+        }
+        Vc_ALWAYS_INLINE Vector  Vc_VDECL operator>> (AsArg shift) const
+        {
+            Common::scalarized_operation(this);
+            return generate([&](int i) { return get(*this, i) >> get(shift, i); });
+        }
         Vc_ALWAYS_INLINE Vector &Vc_VDECL operator<<=(AsArg shift) { return *this = *this << shift; }
         Vc_ALWAYS_INLINE Vector &Vc_VDECL operator>>=(AsArg shift) { return *this = *this >> shift; }
 
@@ -256,10 +265,12 @@ template <typename T> class Vector<T, VectorAbi::Sse>
         Vc_INTRINSIC_L Vector shifted(int amount) const Vc_INTRINSIC_R;
         Vc_INTRINSIC_L Vector rotated(int amount) const Vc_INTRINSIC_R;
         Vc_INTRINSIC_L Vc_PURE_L Vector reversed() const Vc_INTRINSIC_R Vc_PURE_R;
+        Vc_INTRINSIC_L Vc_PURE_L Vector permute(const IndexType &idx) const Vc_INTRINSIC_R Vc_PURE_R;
         Vc_ALWAYS_INLINE_L Vc_PURE_L Vector sorted() const Vc_ALWAYS_INLINE_R Vc_PURE_R;
 
         template <typename F> void callWithValuesSorted(F &&f)
         {
+            Common::scalarized_callWithValuesSorted(this);
             EntryType value = d.m(0);
             f(value);
             for (std::size_t i = 1; i < Size; ++i) {
@@ -272,11 +283,13 @@ template <typename T> class Vector<T, VectorAbi::Sse>
 
         template <typename F> Vc_INTRINSIC void call(F &&f) const
         {
+            Common::scalarized_apply(this);
             Common::for_all_vector_entries<Size>([&](size_t i) { f(EntryType(d.m(i))); });
         }
 
         template <typename F> Vc_INTRINSIC void call(F &&f, const Mask &mask) const
         {
+            Common::scalarized_apply(this);
             for(size_t i : where(mask)) {
                 f(EntryType(d.m(i)));
             }
@@ -284,6 +297,7 @@ template <typename T> class Vector<T, VectorAbi::Sse>
 
         template <typename F> Vc_INTRINSIC Vector apply(F &&f) const
         {
+            Common::scalarized_apply(this);
             Vector r;
             Common::for_all_vector_entries<Size>(
                 [&](size_t i) { r.d.set(i, f(EntryType(d.m(i)))); });
@@ -291,6 +305,7 @@ template <typename T> class Vector<T, VectorAbi::Sse>
         }
         template <typename F> Vc_INTRINSIC Vector apply(F &&f, const Mask &mask) const
         {
+            Common::scalarized_apply(this);
             Vector r(*this);
             for (size_t i : where(mask)) {
                 r.d.set(i, f(EntryType(r.d.m(i))));
@@ -331,17 +346,49 @@ static Vc_ALWAYS_INLINE Vc_PURE SSE::short_v  min(const SSE::short_v  &x, const
 static Vc_ALWAYS_INLINE Vc_PURE SSE::ushort_v min(const SSE::ushort_v &x, const SSE::ushort_v &y) { return SSE::min_epu16(x.data(), y.data()); }
 static Vc_ALWAYS_INLINE Vc_PURE SSE::float_v  min(const SSE::float_v  &x, const SSE::float_v  &y) { return _mm_min_ps(x.data(), y.data()); }
 static Vc_ALWAYS_INLINE Vc_PURE SSE::double_v min(const SSE::double_v &x, const SSE::double_v &y) { return _mm_min_pd(x.data(), y.data()); }
+static Vc_ALWAYS_INLINE Vc_PURE SSE::schar_v  min(const SSE::schar_v  &x, const SSE::schar_v  &y) { return SSE::min_epi8(x.data(), y.data()); }
+static Vc_ALWAYS_INLINE Vc_PURE SSE::uchar_v  min(const SSE::uchar_v  &x, const SSE::uchar_v  &y) { return _mm_min_epu8(x.data(), y.data()); }
+static Vc_ALWAYS_INLINE Vc_PURE SSE::llong_v  min(const SSE::llong_v  &x, const SSE::llong_v  &y) { return SSE::VectorHelper< llong>::min(x.data(), y.data()); }
+static Vc_ALWAYS_INLINE Vc_PURE SSE::ullong_v min(const SSE::ullong_v &x, const SSE::ullong_v &y) { return SSE::VectorHelper<ullong>::min(x.data(), y.data()); }
 static Vc_ALWAYS_INLINE Vc_PURE SSE::int_v    max(const SSE::int_v    &x, const SSE::int_v    &y) { return SSE::max_epi32(x.data(), y.data()); }
 static Vc_ALWAYS_INLINE Vc_PURE SSE::uint_v   max(const SSE::uint_v   &x, const SSE::uint_v   &y) { return SSE::max_epu32(x.data(), y.data()); }
 static Vc_ALWAYS_INLINE Vc_PURE SSE::short_v  max(const SSE::short_v  &x, const SSE::short_v  &y) { return _mm_max_epi16(x.data(), y.data()); }
 static Vc_ALWAYS_INLINE Vc_PURE SSE::ushort_v max(const SSE::ushort_v &x, const SSE::ushort_v &y) { return SSE::max_epu16(x.data(), y.data()); }
 static Vc_ALWAYS_INLINE Vc_PURE SSE::float_v  max(const SSE::float_v  &x, const SSE::float_v  &y) { return _mm_max_ps(x.data(), y.data()); }
 static Vc_ALWAYS_INLINE Vc_PURE SSE::double_v max(const SSE::double_v &x, const SSE::double_v &y) { return _mm_max_pd(x.data(), y.data()); }
+static Vc_ALWAYS_INLINE Vc_PURE SSE::schar_v  max(const SSE::schar_v  &x, const SSE::schar_v  &y) { return SSE::max_epi8(x.data(), y.data()); }
+static Vc_ALWAYS_INLINE Vc_PURE SSE::uchar_v  max(const SSE::uchar_v  &x, const SSE::uchar_v  &y) { return _mm_max_epu8(x.data(), y.data()); }
+static Vc_ALWAYS_INLINE Vc_PURE SSE::llong_v  max(const SSE::llong_v  &x, const SSE::llong_v  &y) { return SSE::VectorHelper< llong>::max(x.data(), y.data()); }
+static Vc_ALWAYS_INLINE Vc_PURE SSE::ullong_v max(const SSE::ullong_v &x, const SSE::ullong_v &y) { return SSE::VectorHelper<ullong>::max(x.data(), y.data()); }
+
+static Vc_ALWAYS_INLINE Vc_PURE SSE::short_v  add_sat(const SSE::short_v  &x, const SSE::short_v  &y) { return _mm_adds_epi16(x.data(), y.data()); }
+static Vc_ALWAYS_INLINE Vc_PURE SSE::ushort_v add_sat(const SSE::ushort_v &x, const SSE::ushort_v &y) { return _mm_adds_epu16(x.data(), y.data()); }
+static Vc_ALWAYS_INLINE Vc_PURE SSE::schar_v  add_sat(const SSE::schar_v  &x, const SSE::schar_v  &y) { return _mm_adds_epi8 (x.data(), y.data()); }
+static Vc_ALWAYS_INLINE Vc_PURE SSE::uchar_v  add_sat(const SSE::uchar_v  &x, const SSE::uchar_v  &y) { return _mm_adds_epu8 (x.data(), y.data()); }
+static Vc_ALWAYS_INLINE Vc_PURE SSE::short_v  sub_sat(const SSE::short_v  &x, const SSE::short_v  &y) { return _mm_subs_epi16(x.data(), y.data()); }
+static Vc_ALWAYS_INLINE Vc_PURE SSE::ushort_v sub_sat(const SSE::ushort_v &x, const SSE::ushort_v &y) { return _mm_subs_epu16(x.data(), y.data()); }
+static Vc_ALWAYS_INLINE Vc_PURE SSE::schar_v  sub_sat(const SSE::schar_v  &x, const SSE::schar_v  &y) { return _mm_subs_epi8 (x.data(), y.data()); }
+static Vc_ALWAYS_INLINE Vc_PURE SSE::uchar_v  sub_sat(const SSE::uchar_v  &x, const SSE::uchar_v  &y) { return _mm_subs_epu8 (x.data(), y.data()); }
+
+template <typename T, typename = enable_if<sizeof(T) == 1>>
+Vc_INTRINSIC Vc_PURE Vector<T, VectorAbi::Sse> nibble_lookup(
+    const Vector<T, VectorAbi::Sse> &x, const T (&table)[16])
+{
+#ifdef Vc_IMPL_SSSE3
+    return _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(&table[0])),
+                            _mm_and_si128(x.data(), _mm_set1_epi8(0x0f)));
+#else
+    Common::scalarized_operation(&x);
+    return Vector<T, VectorAbi::Sse>::generate([&](int i) { return table[x[i] & 0x0f]; });
+#endif
+}
 
 template <typename T,
           typename = enable_if<std::is_same<T, double>::value || std::is_same<T, float>::value ||
                                std::is_same<T, short>::value ||
-                               std::is_same<T, int>::value>>
+                               std::is_same<T, int>::value ||
+                               std::is_same<T, schar>::value ||
+                               std::is_same<T, llong>::value>>
 Vc_ALWAYS_INLINE Vc_PURE Vector<T, VectorAbi::Sse> abs(Vector<T, VectorAbi::Sse> x)
 {
     return SSE::VectorHelper<T>::abs(x.data());
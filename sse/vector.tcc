@@ -45,6 +45,10 @@ Vc_INTRINSIC SSE::   int_m operator==(SSE::   int_v a, SSE::   int_v b) { return
 Vc_INTRINSIC SSE::  uint_m operator==(SSE::  uint_v a, SSE::  uint_v b) { return _mm_cmpeq_epi32(a.data(), b.data()); }
 Vc_INTRINSIC SSE:: short_m operator==(SSE:: short_v a, SSE:: short_v b) { return _mm_cmpeq_epi16(a.data(), b.data()); }
 Vc_INTRINSIC SSE::ushort_m operator==(SSE::ushort_v a, SSE::ushort_v b) { return _mm_cmpeq_epi16(a.data(), b.data()); }
+Vc_INTRINSIC SSE:: schar_m operator==(SSE:: schar_v a, SSE:: schar_v b) { return _mm_cmpeq_epi8(a.data(), b.data()); }
+Vc_INTRINSIC SSE:: uchar_m operator==(SSE:: uchar_v a, SSE:: uchar_v b) { return _mm_cmpeq_epi8(a.data(), b.data()); }
+Vc_INTRINSIC SSE:: llong_m operator==(SSE:: llong_v a, SSE:: llong_v b) { return SSE::cmpeq_epi64(a.data(), b.data()); }
+Vc_INTRINSIC SSE::ullong_m operator==(SSE::ullong_v a, SSE::ullong_v b) { return SSE::cmpeq_epi64(a.data(), b.data()); }
 
 Vc_INTRINSIC SSE::double_m operator!=(SSE::double_v a, SSE::double_v b) { return _mm_cmpneq_pd(a.data(), b.data()); }
 Vc_INTRINSIC SSE:: float_m operator!=(SSE:: float_v a, SSE:: float_v b) { return _mm_cmpneq_ps(a.data(), b.data()); }
@@ -52,6 +56,10 @@ Vc_INTRINSIC SSE::   int_m operator!=(SSE::   int_v a, SSE::   int_v b) { return
 Vc_INTRINSIC SSE::  uint_m operator!=(SSE::  uint_v a, SSE::  uint_v b) { return not_(_mm_cmpeq_epi32(a.data(), b.data())); }
 Vc_INTRINSIC SSE:: short_m operator!=(SSE:: short_v a, SSE:: short_v b) { return not_(_mm_cmpeq_epi16(a.data(), b.data())); }
 Vc_INTRINSIC SSE::ushort_m operator!=(SSE::ushort_v a, SSE::ushort_v b) { return not_(_mm_cmpeq_epi16(a.data(), b.data())); }
+Vc_INTRINSIC SSE:: schar_m operator!=(SSE:: schar_v a, SSE:: schar_v b) { return not_(_mm_cmpeq_epi8(a.data(), b.data())); }
+Vc_INTRINSIC SSE:: uchar_m operator!=(SSE:: uchar_v a, SSE:: uchar_v b) { return not_(_mm_cmpeq_epi8(a.data(), b.data())); }
+Vc_INTRINSIC SSE:: llong_m operator!=(SSE:: llong_v a, SSE:: llong_v b) { return not_(SSE::cmpeq_epi64(a.data(), b.data())); }
+Vc_INTRINSIC SSE::ullong_m operator!=(SSE::ullong_v a, SSE::ullong_v b) { return not_(SSE::cmpeq_epi64(a.data(), b.data())); }
 
 Vc_INTRINSIC SSE::double_m operator> (SSE::double_v a, SSE::double_v b) { return _mm_cmpgt_pd(a.data(), b.data()); }
 Vc_INTRINSIC SSE:: float_m operator> (SSE:: float_v a, SSE:: float_v b) { return _mm_cmpgt_ps(a.data(), b.data()); }
@@ -71,6 +79,10 @@ Vc_INTRINSIC SSE::ushort_m operator> (SSE::ushort_v a, SSE::ushort_v b) {
     return _mm_cmpgt_epi16(a.data(), b.data());
 #endif
 }
+Vc_INTRINSIC SSE:: schar_m operator> (SSE:: schar_v a, SSE:: schar_v b) { return _mm_cmpgt_epi8(a.data(), b.data()); }
+Vc_INTRINSIC SSE:: uchar_m operator> (SSE:: uchar_v a, SSE:: uchar_v b) { return SSE::cmpgt_epu8(a.data(), b.data()); }
+Vc_INTRINSIC SSE:: llong_m operator> (SSE:: llong_v a, SSE:: llong_v b) { return SSE::cmpgt_epi64(a.data(), b.data()); }
+Vc_INTRINSIC SSE::ullong_m operator> (SSE::ullong_v a, SSE::ullong_v b) { return SSE::cmpgt_epu64(a.data(), b.data()); }
 
 Vc_INTRINSIC SSE::double_m operator< (SSE::double_v a, SSE::double_v b) { return _mm_cmplt_pd(a.data(), b.data()); }
 Vc_INTRINSIC SSE:: float_m operator< (SSE:: float_v a, SSE:: float_v b) { return _mm_cmplt_ps(a.data(), b.data()); }
@@ -90,6 +102,10 @@ Vc_INTRINSIC SSE::ushort_m operator< (SSE::ushort_v a, SSE::ushort_v b) {
     return _mm_cmplt_epi16(a.data(), b.data());
 #endif
 }
+Vc_INTRINSIC SSE:: schar_m operator< (SSE:: schar_v a, SSE:: schar_v b) { return _mm_cmplt_epi8(a.data(), b.data()); }
+Vc_INTRINSIC SSE:: uchar_m operator< (SSE:: uchar_v a, SSE:: uchar_v b) { return SSE::cmplt_epu8(a.data(), b.data()); }
+Vc_INTRINSIC SSE:: llong_m operator< (SSE:: llong_v a, SSE:: llong_v b) { return SSE::cmpgt_epi64(b.data(), a.data()); }
+Vc_INTRINSIC SSE::ullong_m operator< (SSE::ullong_v a, SSE::ullong_v b) { return SSE::cmpgt_epu64(b.data(), a.data()); }
 
 Vc_INTRINSIC SSE::double_m operator>=(SSE::double_v a, SSE::double_v b) { return _mm_cmpnlt_pd(a.data(), b.data()); }
 Vc_INTRINSIC SSE:: float_m operator>=(SSE:: float_v a, SSE:: float_v b) { return _mm_cmpnlt_ps(a.data(), b.data()); }
@@ -97,6 +113,10 @@ Vc_INTRINSIC SSE::   int_m operator>=(SSE::   int_v a, SSE::   int_v b) { return
 Vc_INTRINSIC SSE::  uint_m operator>=(SSE::  uint_v a, SSE::  uint_v b) { return !(a < b); }
 Vc_INTRINSIC SSE:: short_m operator>=(SSE:: short_v a, SSE:: short_v b) { return !(a < b); }
 Vc_INTRINSIC SSE::ushort_m operator>=(SSE::ushort_v a, SSE::ushort_v b) { return !(a < b); }
+Vc_INTRINSIC SSE:: schar_m operator>=(SSE:: schar_v a, SSE:: schar_v b) { return !(a < b); }
+Vc_INTRINSIC SSE:: uchar_m operator>=(SSE:: uchar_v a, SSE:: uchar_v b) { return !(a < b); }
+Vc_INTRINSIC SSE:: llong_m operator>=(SSE:: llong_v a, SSE:: llong_v b) { return !(a < b); }
+Vc_INTRINSIC SSE::ullong_m operator>=(SSE::ullong_v a, SSE::ullong_v b) { return !(a < b); }
 
 Vc_INTRINSIC SSE::double_m operator<=(SSE::double_v a, SSE::double_v b) { return _mm_cmple_pd(a.data(), b.data()); }
 Vc_INTRINSIC SSE:: float_m operator<=(SSE:: float_v a, SSE:: float_v b) { return _mm_cmple_ps(a.data(), b.data()); }
@@ -104,6 +124,10 @@ Vc_INTRINSIC SSE::   int_m operator<=(SSE::   int_v a, SSE::   int_v b) { return
 Vc_INTRINSIC SSE::  uint_m operator<=(SSE::  uint_v a, SSE::  uint_v b) { return !(a > b); }
 Vc_INTRINSIC SSE:: short_m operator<=(SSE:: short_v a, SSE:: short_v b) { return !(a > b); }
 Vc_INTRINSIC SSE::ushort_m operator<=(SSE::ushort_v a, SSE::ushort_v b) { return !(a > b); }
+Vc_INTRINSIC SSE:: schar_m operator<=(SSE:: schar_v a, SSE:: schar_v b) { return !(a > b); }
+Vc_INTRINSIC SSE:: uchar_m operator<=(SSE:: uchar_v a, SSE:: uchar_v b) { return !(a > b); }
+Vc_INTRINSIC SSE:: llong_m operator<=(SSE:: llong_v a, SSE:: llong_v b) { return !(a > b); }
+Vc_INTRINSIC SSE::ullong_m operator<=(SSE::ullong_v a, SSE::ullong_v b) { return !(a > b); }
 
 // bitwise operators {{{1
 template <typename T>
@@ -145,9 +169,12 @@ Vc_INTRINSIC enable_if<std::is_floating_point<T>::value, SSE::Vector<T>> operato
 }
 template <typename T>
 Vc_INTRINSIC
-    enable_if<std::is_same<int, T>::value || std::is_same<uint, T>::value, SSE::Vector<T>>
+    enable_if<std::is_same<int, T>::value || std::is_same<uint, T>::value ||
+                  std::is_same<llong, T>::value || std::is_same<ullong, T>::value,
+              SSE::Vector<T>>
     operator/(SSE::Vector<T> a, SSE::Vector<T> b)
 {
+    Common::scalarized_operation(&a);
     return SSE::Vector<T>::generate([&](int i) { return a[i] / b[i]; });
 }
 template <typename T>
@@ -163,6 +190,20 @@ operator/(SSE::Vector<T> a, SSE::Vector<T> b)
     return HT::concat(_mm_cvttps_epi32(lo), _mm_cvttps_epi32(hi));
 }
 template <typename T>
+Vc_INTRINSIC enable_if<std::is_same<schar, T>::value || std::is_same<uchar, T>::value,
+                       SSE::Vector<T>>
+operator/(SSE::Vector<T> a, SSE::Vector<T> b)
+{
+    // divide as two short_v and truncate the quotients back to 8 bits
+    using S = SSE::short_v;
+    const __m128i lo = (S(SSE::convert<T, short>(a.data())) /
+                        S(SSE::convert<T, short>(b.data()))).data();
+    const __m128i hi = (S(SSE::convert<T, short>(_mm_srli_si128(a.data(), 8))) /
+                        S(SSE::convert<T, short>(_mm_srli_si128(b.data(), 8)))).data();
+    const __m128i mask = _mm_set1_epi16(0x00ff);
+    return _mm_packus_epi16(_mm_and_si128(lo, mask), _mm_and_si128(hi, mask));
+}
+template <typename T>
 Vc_INTRINSIC enable_if<std::is_integral<T>::value, SSE::Vector<T>> operator%(
     SSE::Vector<T> a, SSE::Vector<T> b)
 {
@@ -207,6 +248,18 @@ Vc_INTRINSIC Vector<double, VectorAbi::Sse>::Vector(VectorSpecialInitializerInde
 {
 }
 
+template <>
+Vc_INTRINSIC Vector<llong, VectorAbi::Sse>::Vector(VectorSpecialInitializerIndexesFromZero)
+    : d(_mm_set_epi64x(1, 0))
+{
+}
+
+template <>
+Vc_INTRINSIC Vector<ullong, VectorAbi::Sse>::Vector(VectorSpecialInitializerIndexesFromZero)
+    : d(_mm_set_epi64x(1, 0))
+{
+}
+
 // load member functions {{{1
 template <typename DstT>
 template <typename SrcT, typename Flags>
@@ -271,6 +324,48 @@ Vc_INTRINSIC void Vector<T, VectorAbi::Sse>::store(U *mem, Mask mask, Flags flag
     HV::template store<Flags>(mem, data(), sse_cast<VectorType>(mask.data()));
 }
 
+///////////////////////////////////////////////////////////////////////////////////////////
+// compressStore / expandLoad {{{1
+template <typename T>
+Vc_INTRINSIC std::size_t Vector<T, VectorAbi::Sse>::compressStore(EntryType *mem,
+                                                                  Mask mask) const
+{
+#ifdef Vc_IMPL_SSSE3
+    const int bits = mask.toInt();
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(mem),
+                     Detail::compress<sizeof(T)>(sse_cast<__m128i>(data()), bits));
+    return Detail::popcnt16(bits);
+#else
+    Common::scalarized_operation(this);
+    std::size_t n = 0;
+    for (std::size_t i = 0; i < Size; ++i) {
+        mem[n] = d.m(i);
+        n += mask[i];
+    }
+    return n;
+#endif
+}
+
+template <typename T>
+Vc_INTRINSIC Vector<T, VectorAbi::Sse> Vector<T, VectorAbi::Sse>::expandLoad(
+    const EntryType *mem, Mask mask)
+{
+#ifdef Vc_IMPL_SSSE3
+    return sse_cast<VectorType>(Detail::expand<sizeof(T)>(
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(mem)), mask.toInt()));
+#else
+    Vector r = Zero();
+    Common::scalarized_operation(&r);
+    std::size_t n = 0;
+    for (std::size_t i = 0; i < Size; ++i) {
+        if (mask[i]) {
+            r.d.set(i, mem[n++]);
+        }
+    }
+    return r;
+#endif
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////
 // operator- {{{1
 template<typename T> Vc_ALWAYS_INLINE Vc_PURE Vector<T, VectorAbi::Sse> Vector<T, VectorAbi::Sse>::operator-() const
@@ -368,6 +463,20 @@ Vc_ALWAYS_INLINE void SSE::ushort_v::gatherImplementation(const MT *mem, IT &&in
                     mem[indexes[4]], mem[indexes[5]], mem[indexes[6]], mem[indexes[7]]);
 }
 
+template <>
+template <typename MT, typename IT>
+Vc_ALWAYS_INLINE void SSE::llong_v::gatherImplementation(const MT *mem, IT &&indexes)
+{
+    d.v() = _mm_set_epi64x(mem[indexes[1]], mem[indexes[0]]);
+}
+
+template <>
+template <typename MT, typename IT>
+Vc_ALWAYS_INLINE void SSE::ullong_v::gatherImplementation(const MT *mem, IT &&indexes)
+{
+    d.v() = _mm_set_epi64x(mem[indexes[1]], mem[indexes[0]]);
+}
+
 template <typename T>
 template <typename MT, typename IT>
 inline void Vector<T, VectorAbi::Sse>::gatherImplementation(const MT *mem, IT &&indexes, MaskArgument mask)
@@ -714,6 +823,60 @@ template <> template <typename G> Vc_INTRINSIC SSE::ushort_v SSE::ushort_v::gene
     const auto tmp7 = gen(7);
     return _mm_setr_epi16(tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp7);
 }
+template <> template <typename G> Vc_INTRINSIC SSE::schar_v SSE::schar_v::generate(G gen)
+{
+    const auto tmp0 = gen(0);
+    const auto tmp1 = gen(1);
+    const auto tmp2 = gen(2);
+    const auto tmp3 = gen(3);
+    const auto tmp4 = gen(4);
+    const auto tmp5 = gen(5);
+    const auto tmp6 = gen(6);
+    const auto tmp7 = gen(7);
+    const auto tmp8 = gen(8);
+    const auto tmp9 = gen(9);
+    const auto tmp10 = gen(10);
+    const auto tmp11 = gen(11);
+    const auto tmp12 = gen(12);
+    const auto tmp13 = gen(13);
+    const auto tmp14 = gen(14);
+    const auto tmp15 = gen(15);
+    return _mm_setr_epi8(tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp7, tmp8, tmp9, tmp10,
+                         tmp11, tmp12, tmp13, tmp14, tmp15);
+}
+template <> template <typename G> Vc_INTRINSIC SSE::uchar_v SSE::uchar_v::generate(G gen)
+{
+    const auto tmp0 = gen(0);
+    const auto tmp1 = gen(1);
+    const auto tmp2 = gen(2);
+    const auto tmp3 = gen(3);
+    const auto tmp4 = gen(4);
+    const auto tmp5 = gen(5);
+    const auto tmp6 = gen(6);
+    const auto tmp7 = gen(7);
+    const auto tmp8 = gen(8);
+    const auto tmp9 = gen(9);
+    const auto tmp10 = gen(10);
+    const auto tmp11 = gen(11);
+    const auto tmp12 = gen(12);
+    const auto tmp13 = gen(13);
+    const auto tmp14 = gen(14);
+    const auto tmp15 = gen(15);
+    return _mm_setr_epi8(tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp7, tmp8, tmp9, tmp10,
+                         tmp11, tmp12, tmp13, tmp14, tmp15);
+}
+template <> template <typename G> Vc_INTRINSIC SSE::llong_v SSE::llong_v::generate(G gen)
+{
+    const auto tmp0 = gen(0);
+    const auto tmp1 = gen(1);
+    return _mm_set_epi64x(tmp1, tmp0);
+}
+template <> template <typename G> Vc_INTRINSIC SSE::ullong_v SSE::ullong_v::generate(G gen)
+{
+    const auto tmp0 = gen(0);
+    const auto tmp1 = gen(1);
+    return _mm_set_epi64x(tmp1, tmp0);
+}
 // }}}1
 // reversed {{{1
 template <> Vc_INTRINSIC Vc_PURE SSE::double_v SSE::double_v::reversed() const
@@ -744,30 +907,74 @@ template <> Vc_INTRINSIC Vc_PURE SSE::ushort_v SSE::ushort_v::reversed() const
         Mem::shuffle<X1, Y0>(sse_cast<__m128d>(Mem::permuteHi<X7, X6, X5, X4>(d.v())),
                              sse_cast<__m128d>(Mem::permuteLo<X3, X2, X1, X0>(d.v()))));
 }
-// }}}1
-// permutation via operator[] {{{1
-template <>
-Vc_INTRINSIC SSE::float_v SSE::float_v::operator[](const SSE::int_v &
-#ifdef Vc_IMPL_AVX
-                                             perm
+template <> Vc_INTRINSIC Vc_PURE SSE::schar_v SSE::schar_v::reversed() const
+{
+#ifdef Vc_IMPL_SSSE3
+    return _mm_shuffle_epi8(
+        d.v(), _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0));
+#else
+    // reverse the 16-bit words, then swap the bytes inside each word
+    const __m128i w = SSE::short_v(d.v()).reversed().data();
+    return _mm_or_si128(_mm_slli_epi16(w, 8), _mm_srli_epi16(w, 8));
 #endif
-                                         ) const
-{
-    /*
-    const int_m cross128 = concat(_mm_cmpgt_epi32(lo128(perm.data()), _mm_set1_epi32(3)),
-                                  _mm_cmplt_epi32(hi128(perm.data()), _mm_set1_epi32(4)));
-    if (cross128.isNotEmpty()) {
-    SSE::float_v x = _mm256_permutevar_ps(d.v(), perm.data());
-        x(cross128) = _mm256_permutevar_ps(Mem::permute128<X1, X0>(d.v()), perm.data());
-        return x;
-    } else {
-    */
-#ifdef Vc_IMPL_AVX
-    return _mm_permutevar_ps(d.v(), perm.data());
+}
+template <> Vc_INTRINSIC Vc_PURE SSE::uchar_v SSE::uchar_v::reversed() const
+{
+    return SSE::schar_v(d.v()).reversed().data();
+}
+template <> Vc_INTRINSIC Vc_PURE SSE::llong_v SSE::llong_v::reversed() const
+{
+    return Mem::permute<X2, X3, X0, X1>(d.v());
+}
+template <> Vc_INTRINSIC Vc_PURE SSE::ullong_v SSE::ullong_v::reversed() const
+{
+    return Mem::permute<X2, X3, X0, X1>(d.v());
+}
+// }}}1
+// permute {{{1
+namespace Detail
+{
+// the indexes of IndexType as 32-bit integers (16-bit integers for 8 entries)
+template <typename I>
+Vc_INTRINSIC __m128i permute_indexes(const I &idx, std::integral_constant<std::size_t, 2>)
+{
+    return _mm_setr_epi32(internal_data(internal_data0(idx)).data(),
+                          internal_data(internal_data1(idx)).data(), 0, 0);
+}
+template <typename I>
+Vc_INTRINSIC __m128i permute_indexes(const I &idx, std::integral_constant<std::size_t, 4>)
+{
+    return internal_data(idx).data();
+}
+template <typename I>
+Vc_INTRINSIC __m128i permute_indexes(const I &idx, std::integral_constant<std::size_t, 8>)
+{
+    return _mm_packs_epi32(internal_data(internal_data0(idx)).data(),
+                           internal_data(internal_data1(idx)).data());
+}
+}  // namespace Detail
+
+template <typename T>
+Vc_INTRINSIC Vc_PURE Vector<T, VectorAbi::Sse> Vector<T, VectorAbi::Sse>::permute(
+    const IndexType &idx) const
+{
+#ifdef Vc_IMPL_SSSE3
+    return sse_cast<VectorType>(Detail::permute<sizeof(T)>(
+        sse_cast<__m128i>(data()),
+        Detail::permute_indexes(idx, std::integral_constant<std::size_t, Size>())));
 #else
-    return *this;//TODO
+    Common::scalarized_operation(this);
+    return generate([&](int i) { return d.m(idx[i]); });
 #endif
 }
+
+// permutation via operator[] {{{1
+template <typename T>
+Vc_INTRINSIC Vector<T, VectorAbi::Sse> Vc_VDECL Vector<T, VectorAbi::Sse>::operator[](
+    const SSE::int_v &perm) const
+{
+    return permute(IndexType(perm));
+}
 // broadcast from constexpr index {{{1
 template <> template <int Index> Vc_INTRINSIC SSE::float_v SSE::float_v::broadcast() const
 {
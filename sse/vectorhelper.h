@@ -59,6 +59,21 @@ namespace SSE
             // before AVX there was only one maskstore. load -> blend -> store would break the C++ memory model (read/write of memory that is actually not touched by this thread)
             template<typename Flags> static Vc_ALWAYS_INLINE void store(float *mem, VectorType x, VectorType m) { _mm_maskmoveu_si128(_mm_castps_si128(x), _mm_castps_si128(m), reinterpret_cast<char *>(mem)); }
 
+            // converting stores to binary16
+            template<typename Flags> static Vc_ALWAYS_INLINE void store(half *mem, VectorType x) { _mm_storel_epi64(reinterpret_cast<__m128i *>(mem), cvtps_ph(x)); }
+            template<typename Flags> static Vc_ALWAYS_INLINE void store(half *mem, VectorType x, VectorType m) { _mm_maskmoveu_si128(cvtps_ph(x), _mm_packs_epi32(_mm_castps_si128(m), _mm_setzero_si128()), reinterpret_cast<char *>(mem)); }
+            template<typename Flags> static Vc_ALWAYS_INLINE void store(bfloat16 *mem, VectorType x) { _mm_storel_epi64(reinterpret_cast<__m128i *>(mem), cvtps_bf16(x)); }
+            template<typename Flags> static Vc_ALWAYS_INLINE void store(bfloat16 *mem, VectorType x, VectorType m) { _mm_maskmoveu_si128(cvtps_bf16(x), _mm_packs_epi32(_mm_castps_si128(m), _mm_setzero_si128()), reinterpret_cast<char *>(mem)); }
+
+            // converting stores to 8-bit integers (truncating, saturating)
+            static Vc_ALWAYS_INLINE __m128i packs_epi8(VectorType x) { const __m128i tmp = _mm_packs_epi32(_mm_cvttps_epi32(x), _mm_setzero_si128()); return _mm_packs_epi16(tmp, tmp); }
+            static Vc_ALWAYS_INLINE __m128i packus_epi8(VectorType x) { const __m128i tmp = _mm_packs_epi32(_mm_cvttps_epi32(x), _mm_setzero_si128()); return _mm_packus_epi16(tmp, tmp); }
+            static Vc_ALWAYS_INLINE __m128i mask_epi8(VectorType m) { const __m128i tmp = _mm_packs_epi32(_mm_castps_si128(m), _mm_setzero_si128()); return _mm_packs_epi16(tmp, _mm_setzero_si128()); }
+            template<typename Flags> static Vc_ALWAYS_INLINE void store(schar *mem, VectorType x) { *reinterpret_cast<MayAlias<int> *>(mem) = _mm_cvtsi128_si32(packs_epi8(x)); }
+            template<typename Flags> static Vc_ALWAYS_INLINE void store(uchar *mem, VectorType x) { *reinterpret_cast<MayAlias<int> *>(mem) = _mm_cvtsi128_si32(packus_epi8(x)); }
+            template<typename Flags> static Vc_ALWAYS_INLINE void store(schar *mem, VectorType x, VectorType m) { _mm_maskmoveu_si128(packs_epi8(x), mask_epi8(m), reinterpret_cast<char *>(mem)); }
+            template<typename Flags> static Vc_ALWAYS_INLINE void store(uchar *mem, VectorType x, VectorType m) { _mm_maskmoveu_si128(packus_epi8(x), mask_epi8(m), reinterpret_cast<char *>(mem)); }
+
             Vc_OP0(allone, _mm_setallone_ps())
             Vc_OP0(zero, _mm_setzero_ps())
             Vc_OP3(blend, blendv_ps(a, b, c))
@@ -210,8 +225,13 @@ namespace SSE
 #ifdef Vc_IMPL_SSE4_1
                 return _mm_round_pd(a, _MM_FROUND_NINT);
 #else
-                //XXX: slow: _MM_SET_ROUNDING_MODE(_MM_ROUND_NEAREST);
-                return _mm_cvtepi32_pd(_mm_cvtpd_epi32(a));
+                // |a| + 2^52 - 2^52 rounds to nearest even; |a| >= 2^52 is integral already
+                const __m128d abs = _mm_and_pd(a, _mm_setabsmask_pd());
+                const __m128d big = _mm_set1_pd(4503599627370496.);
+                const __m128d small = _mm_cmplt_pd(abs, big);
+                const __m128d r = _mm_sub_pd(_mm_add_pd(abs, big), big);
+                return _mm_or_pd(_mm_or_pd(_mm_and_pd(small, r), _mm_andnot_pd(small, abs)),
+                                 _mm_and_pd(a, _mm_setsignmask_pd()));
 #endif
             }
         };
@@ -292,8 +312,13 @@ namespace SSE
 #ifdef Vc_IMPL_SSE4_1
                 return _mm_round_ps(a, _MM_FROUND_NINT);
 #else
-                //XXX slow: _MM_SET_ROUNDING_MODE(_MM_ROUND_NEAREST);
-                return _mm_cvtepi32_ps(_mm_cvtps_epi32(a));
+                // |a| + 2^23 - 2^23 rounds to nearest even; |a| >= 2^23 is integral already
+                const __m128 abs = _mm_and_ps(a, _mm_setabsmask_ps());
+                const __m128 big = _mm_set1_ps(8388608.f);
+                const __m128 small = _mm_cmplt_ps(abs, big);
+                const __m128 r = _mm_sub_ps(_mm_add_ps(abs, big), big);
+                return _mm_or_ps(_mm_or_ps(_mm_and_ps(small, r), _mm_andnot_ps(small, abs)),
+                                 _mm_and_ps(a, _mm_setsignmask_ps()));
 #endif
             }
         };
@@ -611,6 +636,212 @@ namespace SSE
 #undef Vc_SUFFIX
             static Vc_ALWAYS_INLINE Vc_CONST VectorType round(VectorType a) { return a; }
         };
+
+        template<> struct VectorHelper<signed char> {
+            typedef _M128I VectorType;
+            typedef signed char EntryType;
+#define Vc_SUFFIX si128
+            Vc_OP_(or_) Vc_OP_(and_) Vc_OP_(xor_)
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType zero() { return Vc_CAT2(_mm_setzero_, Vc_SUFFIX)(); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType notMaskedToZero(VectorType a, _M128 mask) { return Vc_CAT2(_mm_and_, Vc_SUFFIX)(_mm_castps_si128(mask), a); }
+
+#undef Vc_SUFFIX
+#define Vc_SUFFIX epi8
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType one() { return Vc_CAT2(_mm_setone_, Vc_SUFFIX)(); }
+
+            // there are no 8-bit shifts: shift 16-bit words and clear the bits that
+            // crossed into the neighboring byte; the arithmetic right shift sign-extends
+            // the logical one via (x ^ m) - m, with m the shifted sign bit
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType shiftLeft(VectorType a, int shift) {
+                return _mm_and_si128(_mm_slli_epi16(a, shift), _mm_set1_epi8(static_cast<char>(0xff << shift)));
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType shiftRight(VectorType a, int shift) {
+                const VectorType m = _mm_set1_epi8(static_cast<char>(0x80 >> shift));
+                const VectorType x = _mm_and_si128(_mm_srli_epi16(a, shift), _mm_set1_epi8(static_cast<char>(0xff >> shift)));
+                return _mm_sub_epi8(_mm_xor_si128(x, m), m);
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType set(const EntryType a) { return Vc_CAT2(_mm_set1_, Vc_SUFFIX)(a); }
+
+            static Vc_ALWAYS_INLINE void fma(VectorType &v1, VectorType v2, VectorType v3) { v1 = add(mul(v1, v2), v3); }
+
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType abs(const VectorType a) { return abs_epi8(a); }
+
+            // multiply the even and odd bytes in 16-bit words and merge the low bytes
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType mul(VectorType a, VectorType b) {
+                const VectorType lo = _mm_mullo_epi16(a, b);
+                const VectorType hi = _mm_mullo_epi16(_mm_srli_epi16(a, 8), _mm_srli_epi16(b, 8));
+                return _mm_or_si128(_mm_and_si128(lo, _mm_set1_epi16(0x00ff)), _mm_slli_epi16(hi, 8));
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType min(VectorType a, VectorType b) { return min_epi8(a, b); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType max(VectorType a, VectorType b) { return max_epi8(a, b); }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType min(VectorType a) {
+                // reminder: _MM_SHUFFLE(3, 2, 1, 0) means "no change"
+                a = min(a, _mm_shuffle_epi32(a, _MM_SHUFFLE(1, 0, 3, 2)));
+                a = min(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 0, 3, 2)));
+                a = min(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 1, 1, 1)));
+                a = min(a, _mm_srli_epi16(a, 8));
+                return _mm_cvtsi128_si32(a); // & 0xff is implicit
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType max(VectorType a) {
+                // reminder: _MM_SHUFFLE(3, 2, 1, 0) means "no change"
+                a = max(a, _mm_shuffle_epi32(a, _MM_SHUFFLE(1, 0, 3, 2)));
+                a = max(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 0, 3, 2)));
+                a = max(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 1, 1, 1)));
+                a = max(a, _mm_srli_epi16(a, 8));
+                return _mm_cvtsi128_si32(a); // & 0xff is implicit
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType mul(VectorType a) {
+                // the low byte of a 16-bit product only depends on the low bytes of the factors
+                a = _mm_mullo_epi16(_mm_unpacklo_epi8(a, a), _mm_unpackhi_epi8(a, a));
+                a = _mm_mullo_epi16(a, _mm_shuffle_epi32(a, _MM_SHUFFLE(1, 0, 3, 2)));
+                a = _mm_mullo_epi16(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 0, 3, 2)));
+                a = _mm_mullo_epi16(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 1, 1, 1)));
+                return _mm_cvtsi128_si32(a); // & 0xff is implicit
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType add(VectorType a) {
+                // psadbw against zero sums the bytes of each 64-bit half
+                a = _mm_sad_epu8(a, _mm_setzero_si128());
+                return _mm_cvtsi128_si32(_mm_add_epi32(a, _mm_srli_si128(a, 8))); // & 0xff is implicit
+            }
+
+            Vc_OP(add) Vc_OP(sub)
+#undef Vc_SUFFIX
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType round(VectorType a) { return a; }
+        };
+
+        template<> struct VectorHelper<unsigned char> {
+            typedef _M128I VectorType;
+            typedef unsigned char EntryType;
+#define Vc_SUFFIX si128
+            Vc_OP_CAST_(or_) Vc_OP_CAST_(and_) Vc_OP_CAST_(xor_)
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType zero() { return Vc_CAT2(_mm_setzero_, Vc_SUFFIX)(); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType notMaskedToZero(VectorType a, _M128 mask) { return Vc_CAT2(_mm_and_, Vc_SUFFIX)(_mm_castps_si128(mask), a); }
+
+#undef Vc_SUFFIX
+#define Vc_SUFFIX epu8
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType one() { return Vc_CAT2(_mm_setone_, Vc_SUFFIX)(); }
+            Vc_MINMAX
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType min(VectorType a) {
+                // reminder: _MM_SHUFFLE(3, 2, 1, 0) means "no change"
+                a = min(a, _mm_shuffle_epi32(a, _MM_SHUFFLE(1, 0, 3, 2)));
+                a = min(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 0, 3, 2)));
+                a = min(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 1, 1, 1)));
+                a = min(a, _mm_srli_epi16(a, 8));
+                return _mm_cvtsi128_si32(a); // & 0xff is implicit
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType max(VectorType a) {
+                // reminder: _MM_SHUFFLE(3, 2, 1, 0) means "no change"
+                a = max(a, _mm_shuffle_epi32(a, _MM_SHUFFLE(1, 0, 3, 2)));
+                a = max(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 0, 3, 2)));
+                a = max(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 1, 1, 1)));
+                a = max(a, _mm_srli_epi16(a, 8));
+                return _mm_cvtsi128_si32(a); // & 0xff is implicit
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType mul(VectorType a) { return VectorHelper<signed char>::mul(a); }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType add(VectorType a) { return VectorHelper<signed char>::add(a); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType mul(VectorType a, VectorType b) { return VectorHelper<signed char>::mul(a, b); }
+
+            static Vc_ALWAYS_INLINE void fma(VectorType &v1, VectorType v2, VectorType v3) { v1 = add(mul(v1, v2), v3); }
+
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType shiftLeft(VectorType a, int shift) {
+                return VectorHelper<signed char>::shiftLeft(a, shift);
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType shiftRight(VectorType a, int shift) {
+                return _mm_and_si128(_mm_srli_epi16(a, shift), _mm_set1_epi8(static_cast<char>(0xff >> shift)));
+            }
+#undef Vc_SUFFIX
+#define Vc_SUFFIX epi8
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType set(const EntryType a) { return Vc_CAT2(_mm_set1_, Vc_SUFFIX)(a); }
+
+            Vc_OP(add) Vc_OP(sub)
+#undef Vc_SUFFIX
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType round(VectorType a) { return a; }
+        };
+
+        template<> struct VectorHelper<long long> {
+            typedef _M128I VectorType;
+            typedef long long EntryType;
+#define Vc_SUFFIX si128
+            Vc_OP_(or_) Vc_OP_(and_) Vc_OP_(xor_)
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType zero() { return Vc_CAT2(_mm_setzero_, Vc_SUFFIX)(); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType notMaskedToZero(VectorType a, _M128 mask) { return Vc_CAT2(_mm_and_, Vc_SUFFIX)(_mm_castps_si128(mask), a); }
+
+#undef Vc_SUFFIX
+#define Vc_SUFFIX epi64
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType one() { return _mm_set1_epi64x(1); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType set(const EntryType a) { return _mm_set1_epi64x(a); }
+
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType shiftLeft(VectorType a, int shift) {
+                return Vc_CAT2(_mm_slli_, Vc_SUFFIX)(a, shift);
+            }
+            // there is no psraq before AVX-512: sign-extend the logical shift via
+            // (x ^ m) - m, with m the shifted sign bit
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType shiftRight(VectorType a, int shift) {
+                const VectorType m = _mm_srli_epi64(setmin_epi64(), shift);
+                return sub(_mm_xor_si128(_mm_srli_epi64(a, shift), m), m);
+            }
+
+            static Vc_ALWAYS_INLINE void fma(VectorType &v1, VectorType v2, VectorType v3) { v1 = add(mul(v1, v2), v3); }
+
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType abs(const VectorType a) {
+                const VectorType sign = _mm_shuffle_epi32(_mm_srai_epi32(a, 31), _MM_SHUFFLE(3, 3, 1, 1));
+                return sub(_mm_xor_si128(a, sign), sign);
+            }
+
+            // the low 64 bits of the product: a0 * b0 + ((a0 * b1 + a1 * b0) << 32), where
+            // a0/a1 are the low/high 32 bits
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType mul(VectorType a, VectorType b) {
+                const VectorType cross = add(_mm_mul_epu32(a, _mm_srli_epi64(b, 32)),
+                                             _mm_mul_epu32(_mm_srli_epi64(a, 32), b));
+                return add(_mm_mul_epu32(a, b), _mm_slli_epi64(cross, 32));
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType min(VectorType a, VectorType b) { return blendv_epi8(a, b, cmpgt_epi64(a, b)); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType max(VectorType a, VectorType b) { return blendv_epi8(b, a, cmpgt_epi64(a, b)); }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType min(VectorType a) { return cvtsi128_si64(min(a, _mm_unpackhi_epi64(a, a))); }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType max(VectorType a) { return cvtsi128_si64(max(a, _mm_unpackhi_epi64(a, a))); }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType mul(VectorType a) { return cvtsi128_si64(mul(a, _mm_unpackhi_epi64(a, a))); }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType add(VectorType a) { return cvtsi128_si64(add(a, _mm_unpackhi_epi64(a, a))); }
+
+            Vc_OP(add) Vc_OP(sub)
+#undef Vc_SUFFIX
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType round(VectorType a) { return a; }
+        };
+
+        template<> struct VectorHelper<unsigned long long> {
+            typedef _M128I VectorType;
+            typedef unsigned long long EntryType;
+            typedef VectorHelper<long long> Signed;
+#define Vc_SUFFIX si128
+            Vc_OP_CAST_(or_) Vc_OP_CAST_(and_) Vc_OP_CAST_(xor_)
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType zero() { return Vc_CAT2(_mm_setzero_, Vc_SUFFIX)(); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType notMaskedToZero(VectorType a, _M128 mask) { return Vc_CAT2(_mm_and_, Vc_SUFFIX)(_mm_castps_si128(mask), a); }
+
+#undef Vc_SUFFIX
+#define Vc_SUFFIX epi64
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType one() { return Signed::one(); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType set(const EntryType a) { return _mm_set1_epi64x(static_cast<long long>(a)); }
+
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType shiftLeft(VectorType a, int shift) {
+                return Vc_CAT2(_mm_slli_, Vc_SUFFIX)(a, shift);
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType shiftRight(VectorType a, int shift) {
+                return Vc_CAT2(_mm_srli_, Vc_SUFFIX)(a, shift);
+            }
+
+            static Vc_ALWAYS_INLINE void fma(VectorType &v1, VectorType v2, VectorType v3) { v1 = add(mul(v1, v2), v3); }
+
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType mul(VectorType a, VectorType b) { return Signed::mul(a, b); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType min(VectorType a, VectorType b) { return blendv_epi8(a, b, cmpgt_epu64(a, b)); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType max(VectorType a, VectorType b) { return blendv_epi8(b, a, cmpgt_epu64(a, b)); }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType min(VectorType a) { return cvtsi128_si64(min(a, _mm_unpackhi_epi64(a, a))); }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType max(VectorType a) { return cvtsi128_si64(max(a, _mm_unpackhi_epi64(a, a))); }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType mul(VectorType a) { return Signed::mul(a); }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType add(VectorType a) { return Signed::add(a); }
+
+            Vc_OP(add) Vc_OP(sub)
+#undef Vc_SUFFIX
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType round(VectorType a) { return a; }
+        };
 #undef Vc_OP1
 #undef Vc_OP
 #undef Vc_OP_
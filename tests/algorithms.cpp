@@ -0,0 +1,189 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2016 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#include "unittest.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using namespace Vc;
+
+#define ALL_TYPES (AllVectors)
+
+template <typename T> std::vector<T> makeInput(std::size_t n)
+{
+    std::vector<T> data(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        data[i] = T((i * 7919 + 13) % 101);
+    }
+    return data;
+}
+
+struct IsLarge
+{
+    template <typename V> typename V::Mask operator()(const V &x) const
+    {
+        return x > typename V::EntryType(50);
+    }
+};
+
+// sizes around multiples of the vector size, including ranges shorter than two vectors
+template <typename V> std::vector<std::size_t> testSizes()
+{
+    std::vector<std::size_t> sizes;
+    for (std::size_t n = 0; n < 5 * V::Size + 3; ++n) {
+        sizes.push_back(n);
+    }
+    sizes.push_back(1000);
+    sizes.push_back(1001);
+    return sizes;
+}
+
+TEST_TYPES(V, copyIf, ALL_TYPES)
+{
+    using T = typename V::EntryType;
+    for (std::size_t n : testSizes<V>()) {
+        const auto in = makeInput<T>(n);
+        std::vector<T> ref;
+        std::copy_if(in.begin(), in.end(), std::back_inserter(ref),
+                     [](T x) { return x > T(50); });
+        // exactly sized output: simd_copy_if must not write beyond the copied entries
+        std::vector<T> out(ref.size() + 1, T(-1));
+        auto end = simd_copy_if(in.begin(), in.end(), out.begin(), IsLarge());
+        COMPARE(std::size_t(end - out.begin()), ref.size()) << "n: " << n;
+        COMPARE(out.back(), T(-1)) << "n: " << n;
+        out.pop_back();
+        VERIFY(out == ref) << "n: " << n;
+
+        std::vector<T> out2;
+        simd_copy_if(in.begin(), in.end(), std::back_inserter(out2), IsLarge());
+        VERIFY(out2 == ref) << "n: " << n;
+    }
+}
+
+TEST_TYPES(V, removeIf, ALL_TYPES)
+{
+    using T = typename V::EntryType;
+    for (std::size_t n : testSizes<V>()) {
+        auto data = makeInput<T>(n);
+        auto ref = data;
+        ref.erase(std::remove_if(ref.begin(), ref.end(), [](T x) { return x > T(50); }),
+                  ref.end());
+        data.erase(simd_remove_if(data.begin(), data.end(), IsLarge()), data.end());
+        VERIFY(data == ref) << "n: " << n;
+    }
+}
+
+TEST_TYPES(V, partition, ALL_TYPES)
+{
+    using T = typename V::EntryType;
+    for (std::size_t n : testSizes<V>()) {
+        auto data = makeInput<T>(n);
+        auto ref = data;
+        const auto mid = simd_partition(data.begin(), data.end(), IsLarge());
+        for (auto it = data.begin(); it != mid; ++it) {
+            VERIFY(*it > T(50)) << "n: " << n;
+        }
+        for (auto it = mid; it != data.end(); ++it) {
+            VERIFY(!(*it > T(50))) << "n: " << n;
+        }
+        // the result is a permutation of the input
+        std::sort(data.begin(), data.end());
+        std::sort(ref.begin(), ref.end());
+        VERIFY(data == ref) << "n: " << n;
+    }
+}
+
+TEST(partitionAllOrNothing)
+{
+    std::vector<float> data = makeInput<float>(333);
+    auto mid = simd_partition(data.begin(), data.end(), [](auto x) { return x >= 0.f; });
+    COMPARE(mid, data.end());
+    mid = simd_partition(data.begin(), data.end(), [](auto x) { return x < 0.f; });
+    COMPARE(mid, data.begin());
+}
+
+// the number of Collatz steps to reach 1 diverges strongly between neighboring start values
+template <typename T> int collatzSteps(T x)
+{
+    int n = 0;
+    for (; x != T(1); ++n) {
+        x = (std::fmod(x, T(2)) == T(0)) ? x / T(2) : T(3) * x + T(1);
+    }
+    return n;
+}
+
+template <typename V> struct CollatzState
+{
+    V x;
+    typename V::IndexType steps;
+};
+
+TEST_TYPES(V, iterateUntil, (float_v, double_v))
+{
+    using T = typename V::EntryType;
+    using IV = typename V::IndexType;
+    using IM = typename IV::mask_type;
+    for (std::size_t n : testSizes<V>()) {
+        std::vector<T> start(n);
+        std::vector<int> ref(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            start[i] = T(i + 1);
+            ref[i] = collatzSteps(start[i]);
+        }
+        std::vector<int> steps(n, -1);
+        std::vector<int> retired(n, 0);
+        std::size_t initialized = 0;
+        CollatzState<V> state;
+        simd_iterate_until<V>(
+            n, state,
+            [&](CollatzState<V> &s, const IV &idx, const typename V::Mask &k) {
+                s.x.gather(start.data(), idx, k);
+                s.steps(simd_cast<IM>(k)) = 0;
+                initialized += k.count();
+            },
+            [](CollatzState<V> &s) {
+                const typename V::Mask finished = s.x == V::One();
+                const V half = s.x * T(0.5);
+                where(!finished) | s.x = iif(floor(half) == half, half, s.x * T(3) + T(1));
+                s.steps(simd_cast<IM>(!finished)) += 1;
+                return finished;
+            },
+            [&](const CollatzState<V> &s, const IV &idx, const typename V::Mask &k) {
+                for (int i : where(k)) {
+                    steps[idx[i]] = s.steps[i];
+                    ++retired[idx[i]];
+                }
+            });
+        COMPARE(initialized, n);
+        for (std::size_t i = 0; i < n; ++i) {
+            COMPARE(retired[i], 1) << "n: " << n << ", i: " << i;
+            COMPARE(steps[i], ref[i]) << "n: " << n << ", i: " << i;
+        }
+    }
+}
@@ -0,0 +1,191 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#include "unittest.h"
+#include <limits>
+
+using namespace Vc;
+
+#define BYTE_VECTORS (Vc::schar_v, Vc::uchar_v)
+
+template <typename V> V randomVector()
+{
+    using T = typename V::EntryType;
+    return V::generate([](int) { return T(std::rand()); });
+}
+
+template <typename T> T saturate(int x)
+{
+    return T(std::min<int>(std::max<int>(x, std::numeric_limits<T>::min()),
+                           std::numeric_limits<T>::max()));
+}
+
+TEST_TYPES(V, arithmetics, BYTE_VECTORS)
+{
+    using T = typename V::EntryType;
+    for (int repetition = 0; repetition < 1000; ++repetition) {
+        const V a = randomVector<V>();
+        V b = randomVector<V>();
+        where(b == 0) | b = 1;
+        for (std::size_t i = 0; i < V::Size; ++i) {
+            COMPARE((a + b)[i], T(a[i] + b[i]));
+            COMPARE((a - b)[i], T(a[i] - b[i]));
+            COMPARE((a * b)[i], T(a[i] * b[i]));
+            COMPARE((a / b)[i], T(a[i] / b[i])) << a << " / " << b;
+            COMPARE((a % b)[i], T(a[i] % b[i]));
+            COMPARE((-a)[i], T(-a[i]));
+            COMPARE((a & b)[i], T(a[i] & b[i]));
+            COMPARE((a | b)[i], T(a[i] | b[i]));
+            COMPARE((a ^ b)[i], T(a[i] ^ b[i]));
+            COMPARE(min(a, b)[i], std::min<T>(a[i], b[i]));
+            COMPARE(max(a, b)[i], std::max<T>(a[i], b[i]));
+            for (int shift = 0; shift < 8; ++shift) {
+                COMPARE((a << shift)[i], T(a[i] << shift)) << "shift: " << shift;
+                COMPARE((a >> shift)[i], T(a[i] >> shift)) << "shift: " << shift;
+            }
+        }
+    }
+}
+
+TEST_TYPES(V, saturatingArithmetics, BYTE_VECTORS)
+{
+    using T = typename V::EntryType;
+    for (int repetition = 0; repetition < 1000; ++repetition) {
+        const V a = randomVector<V>();
+        const V b = randomVector<V>();
+        const V sum = add_sat(a, b);
+        const V difference = sub_sat(a, b);
+        for (std::size_t i = 0; i < V::Size; ++i) {
+            COMPARE(sum[i], saturate<T>(int(a[i]) + int(b[i])));
+            COMPARE(difference[i], saturate<T>(int(a[i]) - int(b[i])));
+        }
+    }
+    const V lo = std::numeric_limits<T>::min();
+    const V hi = std::numeric_limits<T>::max();
+    COMPARE(add_sat(hi, V::One()), hi);
+    COMPARE(sub_sat(lo, V::One()), lo);
+}
+
+TEST_TYPES(V, compares, BYTE_VECTORS)
+{
+    for (int repetition = 0; repetition < 1000; ++repetition) {
+        const V a = randomVector<V>();
+        const V b = iif(randomVector<V>() > 0, a, randomVector<V>());
+        const auto eq = a == b, ne = a != b, lt = a < b, le = a <= b, gt = a > b,
+                   ge = a >= b;
+        int bits = 0, count = 0;
+        for (std::size_t i = 0; i < V::Size; ++i) {
+            COMPARE(eq[i], a[i] == b[i]);
+            COMPARE(ne[i], a[i] != b[i]);
+            COMPARE(lt[i], a[i] < b[i]) << a << " < " << b;
+            COMPARE(le[i], a[i] <= b[i]);
+            COMPARE(gt[i], a[i] > b[i]);
+            COMPARE(ge[i], a[i] >= b[i]);
+            bits |= int(lt[i]) << i;
+            count += lt[i];
+        }
+        COMPARE(lt.toInt(), bits);
+        COMPARE(lt.count(), count);
+    }
+}
+
+TEST_TYPES(V, reductions, BYTE_VECTORS)
+{
+    using T = typename V::EntryType;
+    for (int repetition = 0; repetition < 1000; ++repetition) {
+        const V a = randomVector<V>();
+        T sum = 0, product = 1, minimum = a[0], maximum = a[0];
+        for (std::size_t i = 0; i < V::Size; ++i) {
+            sum += a[i];
+            product *= a[i];
+            minimum = std::min<T>(minimum, a[i]);
+            maximum = std::max<T>(maximum, a[i]);
+        }
+        COMPARE(a.sum(), sum);
+        COMPARE(a.product(), product);
+        COMPARE(a.min(), minimum);
+        COMPARE(a.max(), maximum);
+    }
+}
+
+TEST_TYPES(V, reversed, BYTE_VECTORS)
+{
+    using T = typename V::EntryType;
+    const V a = V::IndexesFromZero();
+    for (std::size_t i = 0; i < V::Size; ++i) {
+        COMPARE(a[i], T(i));
+        COMPARE(a.reversed()[i], T(V::Size - 1 - i));
+    }
+}
+
+TEST_TYPES(V, nibbleLookup, BYTE_VECTORS)
+{
+    using T = typename V::EntryType;
+    T table[16];
+    for (int i = 0; i < 16; ++i) {
+        table[i] = T(std::rand());
+    }
+    for (int repetition = 0; repetition < 1000; ++repetition) {
+        const V a = randomVector<V>();
+        const V lo = nibble_lookup(a, table);
+        const V hi = nibble_lookup(V(a >> 4), table);
+        for (std::size_t i = 0; i < V::Size; ++i) {
+            COMPARE(lo[i], table[a[i] & 0x0f]);
+            COMPARE(hi[i], table[(a[i] >> 4) & 0x0f]);
+        }
+    }
+}
+
+TEST(classifyCharacters)
+{
+    // find the field separators and digits of a CSV line, a vector at a time
+    const char line[] = "12,apple,3.5,,\"x,y\",9999,tail of the line that is long enough";
+    const std::size_t n = sizeof(line) - 1;
+    alignas(64) unsigned char buffer[sizeof(line) + uchar_v::Size] = {};
+    std::copy_n(&line[0], n, &buffer[0]);
+    // the low nibble of '0'...'9' is 0...9 and their high nibble is 3
+    unsigned char lowNibble[16] = {};
+    unsigned char highNibble[16] = {};
+    for (int i = 0; i < 10; ++i) {
+        lowNibble[i] = 1;
+    }
+    highNibble[3] = 1;
+    std::size_t commas = 0, digits = 0;
+    for (std::size_t i = 0; i < n; i += uchar_v::Size) {
+        const uchar_v chunk(&buffer[i], Vc::Aligned);
+        const uchar_m valid = uchar_v::IndexesFromZero() < uchar_v(uchar(std::min<std::size_t>(n - i, 255)));
+        commas += (valid && chunk == uchar_v(uchar(','))).count();
+        const uchar_v digit = nibble_lookup(chunk, lowNibble) &
+                              nibble_lookup(uchar_v(chunk >> 4), highNibble);
+        digits += (valid && digit != 0).count();
+    }
+    COMPARE(commas, std::size_t(std::count(&line[0], &line[n], ',')));
+    COMPARE(digits, std::size_t(std::count_if(&line[0], &line[n], [](char c) {
+                        return c >= '0' && c <= '9';
+                    })));
+}
@@ -0,0 +1,158 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+#include <Vc/complex>
+
+using namespace Vc;
+
+#define COMPLEX_TYPES (float_v, double_v, SimdArray<float, 8>, SimdArray<double, 3>)
+
+template <typename T> T tolerance()
+{
+    return std::is_same<T, float>::value ? 1e-5 : 1e-13;
+}
+
+template <typename T> std::complex<T> randomComplex()
+{
+    return {T(std::rand() % 2001 - 1000) / T(100), T(std::rand() % 2001 - 1000) / T(100)};
+}
+
+template <typename V> complex<V> randomVector(std::complex<typename V::EntryType> *ref)
+{
+    using T = typename V::EntryType;
+    for (std::size_t i = 0; i < V::Size; ++i) {
+        ref[i] = randomComplex<T>();
+    }
+    return complex<V>(ref);
+}
+
+// relative to the magnitude of the reference value
+template <typename V, typename F>
+void compareLanes(const complex<V> &z, F &&reference, typename V::EntryType scale = 1)
+{
+    using T = typename V::EntryType;
+    for (std::size_t i = 0; i < V::Size; ++i) {
+        const std::complex<T> ref = reference(i);
+        const T tol = tolerance<T>() * scale * std::max(T(1), std::abs(ref));
+        COMPARE_ABSOLUTE_ERROR(z[i].real(), ref.real(), tol) << "lane " << i;
+        COMPARE_ABSOLUTE_ERROR(z[i].imag(), ref.imag(), tol) << "lane " << i;
+    }
+}
+
+TEST_TYPES(V, loadStore, COMPLEX_TYPES)
+{
+    using T = typename V::EntryType;
+    std::complex<T> mem[3 * V::Size + 1];
+    for (std::size_t i = 0; i < 3 * V::Size + 1; ++i) {
+        mem[i] = {T(i), -T(i) / 2};
+    }
+    for (std::size_t offset : {std::size_t(0), std::size_t(1)}) {
+        const complex<V> z(&mem[offset]);
+        for (std::size_t i = 0; i < V::Size; ++i) {
+            COMPARE(z.real()[i], T(i + offset));
+            COMPARE(z.imag()[i], -T(i + offset) / 2);
+            COMPARE(z[i], mem[i + offset]);
+        }
+        std::complex<T> out[V::Size + 2] = {};
+        z.store(&out[1]);
+        COMPARE(out[0], std::complex<T>());
+        for (std::size_t i = 0; i < V::Size; ++i) {
+            COMPARE(out[i + 1], mem[i + offset]);
+        }
+        COMPARE(out[V::Size + 1], std::complex<T>());
+    }
+
+    const complex<V> broadcast(std::complex<T>(2, 3));
+    COMPARE(broadcast.real(), V(2));
+    COMPARE(broadcast.imag(), V(3));
+    COMPARE(complex<V>().real(), V::Zero());
+    COMPARE(complex<V>(V(1)).imag(), V::Zero());
+}
+
+TEST_TYPES(V, arithmetic, COMPLEX_TYPES)
+{
+    using T = typename V::EntryType;
+    for (int repeat = 0; repeat < 100; ++repeat) {
+        std::complex<T> a[V::Size], b[V::Size], c[V::Size];
+        const complex<V> x = randomVector<V>(a);
+        const complex<V> y = randomVector<V>(b);
+        const complex<V> z = randomVector<V>(c);
+        T s[V::Size];
+        for (std::size_t i = 0; i < V::Size; ++i) {
+            s[i] = T(std::rand() % 200 + 1) / T(10);
+        }
+        const V sv(&s[0]);
+        compareLanes(x + y, [&](std::size_t i) { return a[i] + b[i]; });
+        compareLanes(x - y, [&](std::size_t i) { return a[i] - b[i]; });
+        compareLanes(x * y, [&](std::size_t i) { return a[i] * b[i]; });
+        compareLanes(-x, [&](std::size_t i) { return -a[i]; });
+        compareLanes(x * sv, [&](std::size_t i) { return a[i] * s[i]; });
+        compareLanes(sv - x, [&](std::size_t i) { return s[i] - a[i]; });
+        compareLanes(x / sv, [&](std::size_t i) { return a[i] / s[i]; });
+        compareLanes(fma(x, y, z), [&](std::size_t i) { return a[i] * b[i] + c[i]; });
+        if (all_of(norm(y) > T(0.01))) {
+            compareLanes(x / y, [&](std::size_t i) { return a[i] / b[i]; }, 10);
+        }
+        complex<V> w = x;
+        w *= y;
+        w -= z;
+        compareLanes(w, [&](std::size_t i) { return a[i] * b[i] - c[i]; });
+        COMPARE(x == x, V::MaskType::One());
+        COMPARE(x != x, V::MaskType::Zero());
+        COMPARE(conj(conj(x)) == x, V::MaskType::One());
+        compareLanes(conj(x), [&](std::size_t i) { return std::conj(a[i]); });
+    }
+}
+
+TEST_TYPES(V, functions, COMPLEX_TYPES)
+{
+    using T = typename V::EntryType;
+    for (int repeat = 0; repeat < 100; ++repeat) {
+        std::complex<T> a[V::Size];
+        const complex<V> x = randomVector<V>(a);
+        const V n = norm(x), r = abs(x), phi = arg(x);
+        for (std::size_t i = 0; i < V::Size; ++i) {
+            COMPARE_RELATIVE_ERROR(T(n[i]), std::norm(a[i]), tolerance<T>());
+            COMPARE_RELATIVE_ERROR(T(r[i]), std::abs(a[i]), tolerance<T>());
+            COMPARE_ABSOLUTE_ERROR(T(phi[i]), std::arg(a[i]), 2 * tolerance<T>());
+        }
+        compareLanes(polar(r, phi), [&](std::size_t i) { return a[i]; }, 10);
+        const complex<V> small = x / V(100);
+        compareLanes(exp(small),
+                     [&](std::size_t i) { return std::exp(a[i] / T(100)); }, 10);
+    }
+
+    // abs must not overflow where norm does
+    const T big = std::numeric_limits<T>::max() / 4;
+    const complex<V> huge = {V(big), V(big)};
+    COMPARE_RELATIVE_ERROR(T(abs(huge)[0]), big * std::sqrt(T(2)), tolerance<T>());
+    COMPARE(abs(complex<V>(V::Zero(), V::Zero())), V::Zero());
+    COMPARE(abs(complex<V>(V(-3), V::Zero())), V(3));
+    COMPARE(abs(complex<V>(V(std::numeric_limits<T>::infinity()), V(1))),
+            V(std::numeric_limits<T>::infinity()));
+}
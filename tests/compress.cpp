@@ -0,0 +1,126 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2016 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#include "unittest.h"
+
+using namespace Vc;
+
+#define ALL_TYPES                                                                        \
+    (concat<AllVectors, SimdArray<float, 3>, SimdArray<int, 8>, SimdArray<double, 5>,   \
+            SimdArray<unsigned short, 17>>)
+
+template <typename V> typename V::Mask maskFromBits(unsigned int bits)
+{
+    bool b[V::Size];
+    for (std::size_t i = 0; i < V::Size; ++i) {
+        b[i] = (bits >> i) & 1;
+    }
+    return typename V::Mask(&b[0]);
+}
+
+TEST_TYPES(V, compressStore, ALL_TYPES)
+{
+    using T = typename V::EntryType;
+    const T sentinel = T(-1);
+    const V v = V::IndexesFromZero() + V::One();
+    for (unsigned int bits = 0; bits < (1u << V::Size); ++bits) {
+        const auto k = maskFromBits<V>(bits);
+        T mem[2 * V::Size];
+        std::fill_n(&mem[0], 2 * V::Size, sentinel);
+        const std::size_t n = v.compressStore(&mem[0], k);
+        COMPARE(n, std::size_t(k.count())) << "bits: " << bits;
+        std::size_t j = 0;
+        for (std::size_t i = 0; i < V::Size; ++i) {
+            if (k[i]) {
+                COMPARE(mem[j++], T(i + 1)) << "bits: " << bits << ", i: " << i;
+            }
+        }
+        for (std::size_t i = V::Size; i < 2 * V::Size; ++i) {
+            COMPARE(mem[i], sentinel) << "wrote beyond Size";
+        }
+    }
+}
+
+TEST_TYPES(V, expandLoad, ALL_TYPES)
+{
+    using T = typename V::EntryType;
+    T mem[V::Size];
+    for (std::size_t i = 0; i < V::Size; ++i) {
+        mem[i] = T(i + 1);
+    }
+    for (unsigned int bits = 0; bits < (1u << V::Size); ++bits) {
+        const auto k = maskFromBits<V>(bits);
+        const V r = V::expandLoad(&mem[0], k);
+        std::size_t j = 0;
+        for (std::size_t i = 0; i < V::Size; ++i) {
+            COMPARE(r[i], k[i] ? mem[j++] : T(0)) << "bits: " << bits << ", i: " << i;
+        }
+    }
+}
+
+TEST_TYPES(V, roundTrip, ALL_TYPES)
+{
+    // compressStore followed by expandLoad with the same mask reproduces the selected
+    // entries and zeroes the others
+    using T = typename V::EntryType;
+    for (int repetition = 0; repetition < 1000; ++repetition) {
+        const V v = V::Random();
+        const auto k = V::Random() > V::Random();
+        T mem[V::Size];
+        v.compressStore(&mem[0], k);
+        COMPARE(V::expandLoad(&mem[0], k), iif(k, v, V::Zero()));
+    }
+}
+
+TEST(filterStream)
+{
+    constexpr std::size_t N = 1000;
+    float in[N];
+    float out[N + float_v::Size];
+    for (std::size_t i = 0; i < N; ++i) {
+        in[i] = float((i * 7919) % 101);
+    }
+    std::size_t n = 0;
+    std::size_t i = 0;
+    for (; i + float_v::Size <= N; i += float_v::Size) {
+        const float_v x(&in[i], Vc::Unaligned);
+        n += x.compressStore(&out[n], x > 50.f);
+    }
+    for (; i < N; ++i) {
+        if (in[i] > 50.f) {
+            out[n++] = in[i];
+        }
+    }
+    std::size_t j = 0;
+    for (std::size_t k = 0; k < N; ++k) {
+        if (in[k] > 50.f) {
+            COMPARE(out[j++], in[k]);
+        }
+    }
+    COMPARE(n, j);
+}
@@ -0,0 +1,180 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+#include <Vc/coordinates>
+
+using namespace Vc;
+
+#define COORDINATE_TYPES (float, double)
+
+template <typename T> T tolerance()
+{
+    return std::is_same<T, float>::value ? 2e-6 : 1e-14;
+}
+
+template <typename T> std::vector<T> randomValues(std::size_t n, T scale)
+{
+    std::vector<T> v(n);
+    for (auto &x : v) {
+        x = T(std::rand() % 2001 - 1000) / T(1000) * scale;
+    }
+    return v;
+}
+
+template <typename T> void compareValues(T a, T b, T scale)
+{
+    COMPARE_ABSOLUTE_ERROR(a, b, tolerance<T>() * 4 * std::max(T(1), std::abs(scale)));
+}
+
+template <typename T> const std::vector<std::size_t> &sizes()
+{
+    static const std::vector<std::size_t> s = {0, 1, Vector<T>::Size - 1, 100, 1003};
+    return s;
+}
+
+TEST_TYPES(T, polar, COORDINATE_TYPES)
+{
+    for (std::size_t n : sizes<T>()) {
+        const auto x = randomValues<T>(n, 10), y = randomValues<T>(n, 10);
+        std::vector<T> r(n), phi(n), x2(n), y2(n);
+        cartesianToPolar(x.data(), y.data(), r.data(), phi.data(), n);
+        for (std::size_t i = 0; i < n; ++i) {
+            compareValues(r[i], std::hypot(x[i], y[i]), T(10));
+            compareValues(phi[i], std::atan2(y[i], x[i]), T(1));
+        }
+        polarToCartesian(r.data(), phi.data(), x2.data(), y2.data(), n);
+        for (std::size_t i = 0; i < n; ++i) {
+            compareValues(x2[i], x[i], T(10));
+            compareValues(y2[i], y[i], T(10));
+        }
+
+        // AoS, in place
+        std::vector<std::array<T, 2>> points(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            points[i] = {{x[i], y[i]}};
+        }
+        cartesianToPolar(points.data(), points.data(), n);
+        for (std::size_t i = 0; i < n; ++i) {
+            COMPARE(points[i][0], r[i]);
+            COMPARE(points[i][1], phi[i]);
+        }
+        polarToCartesian(points.data(), points.data(), n);
+        for (std::size_t i = 0; i < n; ++i) {
+            COMPARE(points[i][0], x2[i]);
+            COMPARE(points[i][1], y2[i]);
+        }
+    }
+}
+
+TEST_TYPES(T, spherical, COORDINATE_TYPES)
+{
+    for (std::size_t n : sizes<T>()) {
+        const auto x = randomValues<T>(n, 10), y = randomValues<T>(n, 10),
+                   z = randomValues<T>(n, 10);
+        std::vector<T> r(n), theta(n), phi(n), x2(n), y2(n), z2(n);
+        cartesianToSpherical(x.data(), y.data(), z.data(), r.data(), theta.data(),
+                             phi.data(), n);
+        for (std::size_t i = 0; i < n; ++i) {
+            const T rho = std::hypot(x[i], y[i]);
+            compareValues(r[i], std::hypot(rho, z[i]), T(20));
+            compareValues(theta[i], std::atan2(rho, z[i]), T(1));
+            compareValues(phi[i], std::atan2(y[i], x[i]), T(1));
+        }
+        sphericalToCartesian(r.data(), theta.data(), phi.data(), x2.data(), y2.data(),
+                             z2.data(), n);
+        for (std::size_t i = 0; i < n; ++i) {
+            compareValues(x2[i], x[i], T(20));
+            compareValues(y2[i], y[i], T(20));
+            compareValues(z2[i], z[i], T(20));
+        }
+
+        std::vector<std::array<T, 3>> points(n), out(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            points[i] = {{x[i], y[i], z[i]}};
+        }
+        cartesianToSpherical(points.data(), out.data(), n);
+        for (std::size_t i = 0; i < n; ++i) {
+            COMPARE(out[i][0], r[i]);
+            COMPARE(out[i][1], theta[i]);
+            COMPARE(out[i][2], phi[i]);
+        }
+        sphericalToCartesian(out.data(), out.data(), n);
+        for (std::size_t i = 0; i < n; ++i) {
+            COMPARE(out[i][0], x2[i]);
+            COMPARE(out[i][1], y2[i]);
+            COMPARE(out[i][2], z2[i]);
+        }
+    }
+}
+
+TEST_TYPES(T, cylindrical, COORDINATE_TYPES)
+{
+    for (std::size_t n : sizes<T>()) {
+        const auto x = randomValues<T>(n, 10), y = randomValues<T>(n, 10),
+                   z = randomValues<T>(n, 10);
+        std::vector<T> rho(n), phi(n), z1(n), x2(n), y2(n), z2(n);
+        cartesianToCylindrical(x.data(), y.data(), z.data(), rho.data(), phi.data(),
+                               z1.data(), n);
+        cylindricalToCartesian(rho.data(), phi.data(), z1.data(), x2.data(), y2.data(),
+                               z2.data(), n);
+        for (std::size_t i = 0; i < n; ++i) {
+            compareValues(rho[i], std::hypot(x[i], y[i]), T(10));
+            compareValues(phi[i], std::atan2(y[i], x[i]), T(1));
+            COMPARE(z1[i], z[i]);
+            compareValues(x2[i], x[i], T(10));
+            compareValues(y2[i], y[i], T(10));
+            COMPARE(z2[i], z[i]);
+        }
+    }
+}
+
+TEST_TYPES(T, vectorKernels, COORDINATE_TYPES)
+{
+    using V = Vector<T>;
+    // no overflow in the radius
+    const T big = std::numeric_limits<T>::max() / 2;
+    const auto polar = cartesianToPolar(std::array<V, 2>{{V(big), V(big)}});
+    COMPARE_RELATIVE_ERROR(T(polar[0][0]), big * std::sqrt(T(2)), tolerance<T>() * 2);
+    COMPARE_RELATIVE_ERROR(T(polar[1][0]), T(std::atan(T(1))), tolerance<T>() * 2);
+
+    // the poles and the origin
+    const auto pole =
+        cartesianToSpherical(std::array<V, 3>{{V::Zero(), V::Zero(), V(-2)}});
+    COMPARE(pole[0], V(2));
+    COMPARE_ABSOLUTE_ERROR(T(pole[1][0]), T(3.14159265358979323846), tolerance<T>() * 4);
+    const auto origin =
+        cartesianToSpherical(std::array<V, 3>{{V::Zero(), V::Zero(), V::Zero()}});
+    COMPARE(origin[0], V::Zero());
+
+    // SimdArray works as well
+    using A = SimdArray<T, 5>;
+    const auto c = cylindricalToCartesian(std::array<A, 3>{{A(2), A(0), A(1)}});
+    COMPARE(c[0], A(2));
+    COMPARE(c[1], A(0));
+    COMPARE(c[2], A(1));
+}
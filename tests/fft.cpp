@@ -0,0 +1,181 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+#include <Vc/fft>
+
+using namespace Vc;
+
+#define FFT_TYPES (float, double)
+
+template <typename T> T tolerance()
+{
+    return std::is_same<T, float>::value ? 1e-5 : 1e-13;
+}
+
+template <typename T> std::vector<std::complex<T>> randomSignal(std::size_t n)
+{
+    std::vector<std::complex<T>> x(n);
+    for (auto &z : x) {
+        z = {T(std::rand() % 2001 - 1000) / T(1000),
+             T(std::rand() % 2001 - 1000) / T(1000)};
+    }
+    return x;
+}
+
+// the direct O(n²) transform in double precision
+template <typename T>
+std::vector<std::complex<double>> referenceDft(const std::vector<std::complex<T>> &x)
+{
+    const std::size_t n = x.size();
+    std::vector<std::complex<double>> r(n);
+    for (std::size_t k = 0; k < n; ++k) {
+        std::complex<double> sum = 0;
+        for (std::size_t j = 0; j < n; ++j) {
+            const double phi =
+                -2 * 3.14159265358979323846 * double((j * k) % n) / double(n);
+            sum += std::complex<double>(x[j]) * std::polar(1., phi);
+        }
+        r[k] = sum;
+    }
+    return r;
+}
+
+template <typename T, typename U>
+void compareSignals(const std::vector<std::complex<T>> &a,
+                    const std::vector<std::complex<U>> &b, double scale)
+{
+    COMPARE(a.size(), b.size());
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        const double err =
+            std::abs(std::complex<double>(a[i]) - std::complex<double>(b[i]));
+        VERIFY(err <= tolerance<T>() * scale) << "i = " << i << ": " << a[i] << " vs. "
+                                              << b[i];
+    }
+}
+
+TEST_TYPES(T, forward, FFT_TYPES)
+{
+    for (std::size_t n = 1; n <= 1024; n *= 2) {
+        const auto x = randomSignal<T>(n);
+        const auto ref = referenceDft(x);
+        Fft<T> fft(n);
+        COMPARE(fft.size(), n);
+
+        std::vector<std::complex<T>> y(n);
+        fft.forward(x.data(), y.data());
+        compareSignals(y, ref, 4 * std::sqrt(double(n)));
+
+        auto z = x;  // in place
+        fft.forward(z.data());
+        COMPARE(z == y, true) << "n = " << n;
+
+        std::vector<T> re(n), im(n);  // split
+        for (std::size_t i = 0; i < n; ++i) {
+            re[i] = x[i].real();
+            im[i] = x[i].imag();
+        }
+        fft.forward(re.data(), im.data(), re.data(), im.data());
+        for (std::size_t i = 0; i < n; ++i) {
+            COMPARE(re[i], y[i].real()) << "n = " << n << ", i = " << i;
+            COMPARE(im[i], y[i].imag()) << "n = " << n << ", i = " << i;
+        }
+    }
+}
+
+TEST_TYPES(T, inverse, FFT_TYPES)
+{
+    for (std::size_t n = 1; n <= 4096; n *= 4) {
+        const auto x = randomSignal<T>(n);
+        Fft<T> fft(n);
+        std::vector<std::complex<T>> y(n), z(n);
+        fft.forward(x.data(), y.data());
+        fft.inverse(y.data(), z.data());
+        compareSignals(z, x, 4);
+        fft.inverse(y.data());
+        compareSignals(y, x, 4);
+
+        std::vector<T> re(n), im(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            re[i] = x[i].real();
+            im[i] = x[i].imag();
+        }
+        fft.forward(re.data(), im.data(), re.data(), im.data());
+        fft.inverse(re.data(), im.data(), re.data(), im.data());
+        for (std::size_t i = 0; i < n; ++i) {
+            z[i] = {re[i], im[i]};
+        }
+        compareSignals(z, x, 4);
+    }
+}
+
+template <typename T>
+std::vector<T> referenceConvolution(const std::vector<T> &x, const std::vector<T> &h)
+{
+    std::vector<T> y(x.size() + h.size() - 1, T(0));
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        for (std::size_t j = 0; j < h.size(); ++j) {
+            y[i + j] += x[i] * h[j];
+        }
+    }
+    return y;
+}
+
+TEST_TYPES(T, convolution, FFT_TYPES)
+{
+    for (std::size_t m : {1, 3, 16, 33, 200}) {
+        std::vector<T> h(m);
+        for (auto &c : h) {
+            c = T(std::rand() % 2001 - 1000) / T(1000);
+        }
+        FftConvolution<T> conv(h.data(), m);
+        COMPARE(conv.filterSize(), m);
+        for (std::size_t n : {1, 2, 7, 64, 100, 1000, 5000}) {
+            std::vector<T> x(n);
+            for (auto &v : x) {
+                v = T(std::rand() % 2001 - 1000) / T(1000);
+            }
+            const auto ref = referenceConvolution(x, h);
+            std::vector<T> y(n + m + 1, T(-1));
+            simd_convolve(x.data(), n, h.data(), m, y.data());
+            const T scale = std::sqrt(T(m)) * 4;
+            for (std::size_t i = 0; i < ref.size(); ++i) {
+                COMPARE_ABSOLUTE_ERROR(y[i], ref[i], tolerance<T>() * scale)
+                    << "m = " << m << ", n = " << n << ", i = " << i;
+            }
+            COMPARE(y[ref.size()], T(-1));  // no writes past the end
+
+            std::fill(y.begin(), y.end(), T(-1));
+            conv(x.data(), n, y.data());
+            for (std::size_t i = 0; i < ref.size(); ++i) {
+                COMPARE_ABSOLUTE_ERROR(y[i], ref[i], tolerance<T>() * scale * 10)
+                    << "m = " << m << ", n = " << n << ", i = " << i;
+            }
+            COMPARE(y[ref.size()], T(-1));
+        }
+    }
+}
@@ -0,0 +1,137 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#include "unittest.h"
+#include <Vc/gemm>
+#include <limits>
+#include <vector>
+
+#define FLOATING_POINT_TYPES (float, double)
+
+// Small integers keep all partial sums exactly representable, so the blocked product
+// must match the reference exactly, independent of the summation order.
+template <typename T> std::vector<T> smallIntegerMatrix(std::size_t rows, std::size_t ld)
+{
+    std::vector<T> m(rows * ld);
+    for (auto &x : m) {
+        x = T(std::rand() % 9 - 4);
+    }
+    return m;
+}
+
+template <typename T>
+void referenceGemm(std::size_t m, std::size_t n, std::size_t k, T alpha, const T *a,
+                   std::size_t lda, const T *b, std::size_t ldb, T beta, T *c,
+                   std::size_t ldc)
+{
+    for (std::size_t i = 0; i < m; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+            T sum = 0;
+            for (std::size_t p = 0; p < k; ++p) {
+                sum += a[i * lda + p] * b[p * ldb + j];
+            }
+            c[i * ldc + j] = alpha * sum + (beta == T(0) ? T(0) : beta * c[i * ldc + j]);
+        }
+    }
+}
+
+template <typename T>
+void checkGemm(std::size_t m, std::size_t n, std::size_t k, T alpha, T beta,
+               std::size_t pad = 0)
+{
+    const std::size_t lda = k + pad, ldb = n + pad, ldc = n + pad;
+    const auto a = smallIntegerMatrix<T>(m, lda);
+    const auto b = smallIntegerMatrix<T>(k, ldb);
+    auto c = smallIntegerMatrix<T>(m, ldc);
+    auto ref = c;
+    if (beta == T(0)) {
+        // c must not be read
+        std::fill(c.begin(), c.end(), std::numeric_limits<T>::quiet_NaN());
+    }
+    Vc::gemm(m, n, k, alpha, a.data(), lda, b.data(), ldb, beta, c.data(), ldc);
+    referenceGemm(m, n, k, alpha, a.data(), lda, b.data(), ldb, beta, ref.data(), ldc);
+    for (std::size_t i = 0; i < m; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+            COMPARE(c[i * ldc + j], ref[i * ldc + j])
+                << "m = " << m << ", n = " << n << ", k = " << k << ", i = " << i
+                << ", j = " << j;
+        }
+    }
+    for (std::size_t i = 0; i < m; ++i) {
+        for (std::size_t j = n; j < ldc; ++j) {
+            if (beta == T(0)) {
+                VERIFY(std::isnan(c[i * ldc + j])) << "padding was modified";
+            } else {
+                COMPARE(c[i * ldc + j], ref[i * ldc + j]) << "padding was modified";
+            }
+        }
+    }
+}
+
+TEST_TYPES(T, smallSizes, FLOATING_POINT_TYPES)
+{
+    const std::size_t sizes[] = {1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 33};
+    for (std::size_t m : sizes) {
+        for (std::size_t n : sizes) {
+            for (std::size_t k : sizes) {
+                checkGemm<T>(m, n, k, T(1), T(0));
+            }
+        }
+    }
+}
+
+TEST_TYPES(T, alphaBetaAndStrides, FLOATING_POINT_TYPES)
+{
+    for (std::size_t size : {5, 16, 37, 64}) {
+        checkGemm<T>(size, size, size, T(2), T(0), 3);
+        checkGemm<T>(size, size + 1, size - 1, T(1), T(1), 1);
+        checkGemm<T>(size - 1, size, size + 2, T(-1), T(3), 5);
+        checkGemm<T>(size, size, size, T(0), T(2));
+        checkGemm<T>(size, size, 0, T(1), T(-1));
+    }
+}
+
+TEST_TYPES(T, multipleCacheBlocks, FLOATING_POINT_TYPES)
+{
+    // k exceeds the largest kc and m exceeds mc for all cache sizes
+    checkGemm<T>(1030, 19, 1100, T(1), T(0));
+    checkGemm<T>(130, 150, 1100, T(1), T(1), 2);
+}
+
+TEST_TYPES(T, contiguousOverload, FLOATING_POINT_TYPES)
+{
+    const std::size_t m = 23, n = 29, k = 19;
+    const auto a = smallIntegerMatrix<T>(m, k);
+    const auto b = smallIntegerMatrix<T>(k, n);
+    std::vector<T> c(m * n), ref(m * n);
+    Vc::gemm(m, n, k, a.data(), b.data(), c.data());
+    referenceGemm(m, n, k, T(1), a.data(), k, b.data(), n, T(0), ref.data(), n);
+    for (std::size_t i = 0; i < m * n; ++i) {
+        COMPARE(c[i], ref[i]) << "i = " << i;
+    }
+}
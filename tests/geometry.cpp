@@ -0,0 +1,316 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+#include <Vc/geometry>
+
+using namespace Vc;
+
+#define GEOMETRY_TYPES (float_v, double_v)
+
+template <typename T> T randomCoordinate()
+{
+    return T(std::rand() % 2001 - 1000) / T(100);
+}
+
+template <typename T> std::array<T, 3> randomPoint()
+{
+    return {{randomCoordinate<T>(), randomCoordinate<T>(), randomCoordinate<T>()}};
+}
+
+template <typename V> std::array<V, 3> randomPoints()
+{
+    std::array<V, 3> p;
+    for (auto &x : p) {
+        x = V::generate([](int) { return randomCoordinate<typename V::EntryType>(); });
+    }
+    return p;
+}
+
+template <typename T> std::array<T, 3> lane(const std::array<Vector<T>, 3> &p, int i)
+{
+    return {{p[0][i], p[1][i], p[2][i]}};
+}
+
+template <typename T> Aabb<T> randomBox(T maxSize)
+{
+    Aabb<T> box;
+    for (int a = 0; a < 3; ++a) {
+        box.lower[a] = randomCoordinate<T>();
+        box.upper[a] = box.lower[a] + maxSize * T(std::rand() % 101) / T(100);
+    }
+    return box;
+}
+
+template <typename T> bool referenceContains(const Aabb<T> &b, const std::array<T, 3> &p)
+{
+    for (int a = 0; a < 3; ++a) {
+        if (p[a] < b.lower[a] || p[a] > b.upper[a]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename T>
+bool referenceIntersects(const Aabb<T> &b, const std::array<T, 3> &o,
+                         const std::array<T, 3> &d)
+{
+    T lo = 0, hi = std::numeric_limits<T>::infinity();
+    for (int a = 0; a < 3; ++a) {
+        if (d[a] == 0) {
+            if (o[a] < b.lower[a] || o[a] > b.upper[a]) {
+                return false;
+            }
+            continue;
+        }
+        const T inv = 1 / d[a];
+        T t0 = (b.lower[a] - o[a]) * inv, t1 = (b.upper[a] - o[a]) * inv;
+        if (t0 > t1) {
+            std::swap(t0, t1);
+        }
+        lo = std::max(lo, t0);
+        hi = std::min(hi, t1);
+    }
+    return lo <= hi;
+}
+
+TEST_TYPES(V, containsAabb, GEOMETRY_TYPES)
+{
+    using T = typename V::EntryType;
+    for (int repeat = 0; repeat < 1000; ++repeat) {
+        const Aabb<T> box = randomBox<T>(10);
+        const auto p = randomPoints<V>();
+        const auto inside = contains(box, p);
+        for (std::size_t i = 0; i < V::Size; ++i) {
+            COMPARE(inside[i], referenceContains(box, lane(p, i))) << "lane " << i;
+        }
+    }
+    // one point against a batch of boxes
+    const Aabb<V> boxes = {{{V(-1), V(-1), V::IndexesFromZero() - 1}},
+                           {{V(1), V(1), V::IndexesFromZero() - T(0.5)}}};
+    const std::array<T, 3> origin = {{0, 0, 0}};
+    COMPARE(contains(boxes, origin), V::IndexesFromZero() == 1);
+}
+
+TEST_TYPES(V, containsSphere, GEOMETRY_TYPES)
+{
+    using T = typename V::EntryType;
+    const Sphere<T> s = {{{1, 2, 3}}, 5};
+    for (int repeat = 0; repeat < 1000; ++repeat) {
+        const auto p = randomPoints<V>();
+        const auto inside = contains(s, p);
+        for (std::size_t i = 0; i < V::Size; ++i) {
+            const T dx = p[0][i] - 1, dy = p[1][i] - 2, dz = p[2][i] - 3;
+            COMPARE(inside[i], dx * dx + dy * dy + dz * dz <= 25) << "lane " << i;
+        }
+    }
+}
+
+TEST_TYPES(V, containsHalfSpace, GEOMETRY_TYPES)
+{
+    using T = typename V::EntryType;
+    const HalfSpace<T> h = {{{1, -2, 0}}, 3};
+    for (int repeat = 0; repeat < 1000; ++repeat) {
+        const auto p = randomPoints<V>();
+        const auto inside = contains(h, p);
+        for (std::size_t i = 0; i < V::Size; ++i) {
+            COMPARE(inside[i], p[0][i] - 2 * p[1][i] <= 3) << "lane " << i;
+        }
+    }
+}
+
+TEST_TYPES(V, containsObb, GEOMETRY_TYPES)
+{
+    using T = typename V::EntryType;
+    // a box rotated by 90° about z equals the axis-aligned box with swapped x/y extents
+    Obb<T> obb;
+    obb.center = {{1, 2, 3}};
+    obb.axes = {{{{0, 1, 0}}, {{-1, 0, 0}}, {{0, 0, 1}}}};
+    obb.halfExtents = {{4, 2, 1}};
+    const Aabb<T> box = {{{-1, -2, 2}}, {{3, 6, 4}}};
+    for (int repeat = 0; repeat < 1000; ++repeat) {
+        auto p = randomPoints<V>();
+        p[0] *= T(0.5);  // more points inside
+        p[1] *= T(0.5);
+        const auto inside = contains(obb, p);
+        for (std::size_t i = 0; i < V::Size; ++i) {
+            COMPARE(inside[i], referenceContains(box, lane(p, i))) << "lane " << i;
+        }
+    }
+}
+
+TEST_TYPES(V, rayBox, GEOMETRY_TYPES)
+{
+    using T = typename V::EntryType;
+    for (int repeat = 0; repeat < 1000; ++repeat) {
+        const Aabb<T> box = randomBox<T>(5);
+        const auto origin = randomPoints<V>();
+        auto direction = randomPoints<V>();
+        if (repeat % 4 == 0) {
+            direction[repeat % 3] = V::Zero();  // axis-parallel rays
+        }
+        const Ray<V> rays(origin, direction);
+        V tnear;
+        const auto hit = intersects(box, rays, &tnear);
+        for (std::size_t i = 0; i < V::Size; ++i) {
+            COMPARE(hit[i], referenceIntersects(box, lane(origin, i), lane(direction, i)))
+                << "lane " << i;
+        }
+    }
+
+    // a batch of boxes against one ray along x
+    const V zUpper = iif(V::IndexesFromZero() > 0, V(1), V(-0.5));
+    const Aabb<V> boxes = {{{V::IndexesFromZero() + 2, V(-1), V(-1)}},
+                           {{V::IndexesFromZero() + 3, V(1), zUpper}}};
+    const Ray<T> ray({{0, 0, 0}}, {{2, 0, 0}}, T(0), T(2));
+    V tnear;
+    const auto hit = intersects(boxes, ray, &tnear);
+    COMPARE(hit, V::IndexesFromZero() > 0 && V::IndexesFromZero() < 3);
+    COMPARE(tnear, (V::IndexesFromZero() + 2) / 2);
+
+    // parallel to the y faces and starting on one of them
+    COMPARE(intersects(boxes, Ray<T>({{0, 1, 0}}, {{1, 0, 0}})),
+            V::IndexesFromZero() > 0);
+    COMPARE(intersects(boxes, Ray<T>({{0, -1, 0}}, {{1, T(-0.), 0}})),
+            V::IndexesFromZero() > 0);
+}
+
+TEST_TYPES(V, overlapsRegions, GEOMETRY_TYPES)
+{
+    using T = typename V::EntryType;
+    for (int repeat = 0; repeat < 1000; ++repeat) {
+        Aabb<V> boxes;
+        for (int a = 0; a < 3; ++a) {
+            boxes.lower[a] = V::generate([](int) { return randomCoordinate<T>(); });
+            boxes.upper[a] = boxes.lower[a] + abs(randomPoints<V>()[a]);
+        }
+        const Aabb<T> region = randomBox<T>(10);
+        const Sphere<T> sphere = {randomPoint<T>(), T(std::rand() % 1000) / 100};
+        const auto boxHit = overlaps(boxes, region);
+        const auto sphereHit = overlaps(boxes, sphere);
+        for (std::size_t i = 0; i < V::Size; ++i) {
+            bool ref = true;
+            T dist2 = 0;
+            for (int a = 0; a < 3; ++a) {
+                ref = ref && boxes.lower[a][i] <= region.upper[a] &&
+                      boxes.upper[a][i] >= region.lower[a];
+                const T c = sphere.center[a];
+                const T d =
+                    std::max({boxes.lower[a][i] - c, c - boxes.upper[a][i], T(0)});
+                dist2 += d * d;
+            }
+            COMPARE(boxHit[i], ref) << "lane " << i;
+            COMPARE(sphereHit[i], dist2 <= sphere.radius * sphere.radius) << "lane " << i;
+        }
+    }
+}
+
+TEST_TYPES(V, selectInside, GEOMETRY_TYPES)
+{
+    using T = typename V::EntryType;
+    for (std::size_t n : {std::size_t(0), std::size_t(1), V::Size - 1, V::Size,
+                          std::size_t(100), std::size_t(1003)}) {
+        std::vector<T> x(n), y(n), z(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            x[i] = randomCoordinate<T>();
+            y[i] = randomCoordinate<T>();
+            z[i] = randomCoordinate<T>();
+        }
+        const Sphere<T> s = {{{0, 0, 0}}, 8};
+        std::vector<int> indexes(n + 1, -1);
+        const std::size_t count =
+            simd_select_inside(s, x.data(), y.data(), z.data(), n, indexes.data());
+        std::vector<int> reference;
+        for (std::size_t i = 0; i < n; ++i) {
+            if (x[i] * x[i] + y[i] * y[i] + z[i] * z[i] <= 64) {
+                reference.push_back(int(i));
+            }
+        }
+        COMPARE(count, reference.size()) << "n = " << n;
+        for (std::size_t i = 0; i < count; ++i) {
+            COMPARE(indexes[i], reference[i]) << "i = " << i;
+        }
+        COMPARE(indexes[count], -1);
+    }
+}
+
+TEST_TYPES(V, bvh, GEOMETRY_TYPES)
+{
+    using T = typename V::EntryType;
+    for (std::size_t n : {0, 1, 2, 5, 17, 1000}) {
+        std::vector<Aabb<T>> boxes(n);
+        for (auto &b : boxes) {
+            b = randomBox<T>(3);
+        }
+        const Bvh<T> bvh(boxes);
+        COMPARE(bvh.size(), n);
+        for (int repeat = 0; repeat < 50; ++repeat) {
+            const auto origin = randomPoint<T>();
+            const auto direction = randomPoint<T>();
+            std::vector<int> found;
+            bvh.intersect(Ray<T>(origin, direction), [&](int i) { found.push_back(i); });
+            std::sort(found.begin(), found.end());
+            std::vector<int> reference;
+            for (std::size_t i = 0; i < n; ++i) {
+                if (referenceIntersects(boxes[i], origin, direction)) {
+                    reference.push_back(int(i));
+                }
+            }
+            COMPARE(found == reference, true) << "n = " << n;
+
+            const Aabb<T> region = randomBox<T>(8);
+            found.clear();
+            bvh.query(region, [&](int i) { found.push_back(i); });
+            std::sort(found.begin(), found.end());
+            reference.clear();
+            for (std::size_t i = 0; i < n; ++i) {
+                bool overlap = true;
+                for (int a = 0; a < 3; ++a) {
+                    overlap = overlap && boxes[i].lower[a] <= region.upper[a] &&
+                              boxes[i].upper[a] >= region.lower[a];
+                }
+                if (overlap) {
+                    reference.push_back(int(i));
+                }
+            }
+            COMPARE(found == reference, true) << "n = " << n;
+
+            // every box with a corner in the sphere must be reported
+            const Sphere<T> sphere = {randomPoint<T>(), 4};
+            found.clear();
+            bvh.query(sphere, [&](int i) { found.push_back(i); });
+            for (std::size_t i = 0; i < n; ++i) {
+                const std::array<Scalar::Vector<T>, 3> corner = {
+                    {boxes[i].lower[0], boxes[i].lower[1], boxes[i].lower[2]}};
+                if (all_of(contains(sphere, corner))) {
+                    COMPARE(std::count(found.begin(), found.end(), int(i)), 1);
+                }
+            }
+        }
+    }
+}
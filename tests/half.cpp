@@ -0,0 +1,215 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2016 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+#include <cmath>
+
+using namespace Vc;
+
+#define ALL_TYPES (float_v, SimdArray<float, 3>, SimdArray<float, 8>, SimdArray<float, 17>)
+
+static float referenceHalfToFloat(std::uint16_t h)
+{
+    const int exponent = (h >> 10) & 0x1f;
+    const int mantissa = h & 0x3ff;
+    float r;
+    if (exponent == 0) {
+        r = std::ldexp(float(mantissa), -24);
+    } else if (exponent == 0x1f) {
+        r = mantissa == 0 ? std::numeric_limits<float>::infinity()
+                          : std::numeric_limits<float>::quiet_NaN();
+    } else {
+        r = std::ldexp(float(mantissa | 0x400), exponent - 25);
+    }
+    return (h & 0x8000) ? -r : r;
+}
+
+TEST(scalarConversion)
+{
+    for (std::uint32_t i = 0; i < 0x10000; ++i) {
+        const std::uint16_t h = i;
+        const float f = half::fromBits(h);
+        const float ref = referenceHalfToFloat(h);
+        if (std::isnan(ref)) {
+            VERIFY(std::isnan(f)) << "h = " << h;
+            VERIFY(std::isnan(float(half(f))));
+        } else {
+            COMPARE(f, ref) << "h = " << h;
+            COMPARE(half(f).bits(), h);
+        }
+    }
+
+    // rounding
+    COMPARE(half(65504.f).bits(), 0x7bff);
+    COMPARE(half(65519.f).bits(), 0x7bff);
+    COMPARE(half(65520.f).bits(), 0x7c00);
+    COMPARE(half(1e10f).bits(), 0x7c00);
+    COMPARE(half(-1e10f).bits(), 0xfc00);
+    COMPARE(half(1.f + std::ldexp(1.f, -11)).bits(), 0x3c00);      // tie to even
+    COMPARE(half(1.f + 3 * std::ldexp(1.f, -11)).bits(), 0x3c02);  // tie to even
+    COMPARE(half(1.f + std::ldexp(1.f, -12)).bits(), 0x3c00);
+    COMPARE(half(1.f + std::ldexp(3.f, -12)).bits(), 0x3c01);
+    COMPARE(half(std::ldexp(1.f, -24)).bits(), 0x0001);
+    COMPARE(half(std::ldexp(1.f, -25)).bits(), 0x0000);    // tie to even
+    COMPARE(half(std::ldexp(3.f, -26)).bits(), 0x0001);
+    COMPARE(half(std::ldexp(3.f, -25)).bits(), 0x0002);    // tie to even
+    COMPARE(half(std::ldexp(1.f, -30)).bits(), 0x0000);
+    COMPARE(half(-0.f).bits(), 0x8000);
+}
+
+TEST_TYPES(V, loadHalf, ALL_TYPES)
+{
+    constexpr std::size_t Count = 0x10000;
+    std::vector<half> data(Count + V::Size);
+    for (std::size_t i = 0; i < Count; ++i) {
+        data[i] = half::fromBits(i);
+    }
+    for (std::size_t i = 0; i + V::Size <= Count; i += V::Size) {
+        V ref;
+        for (std::size_t j = 0; j < V::Size; ++j) {
+            ref[j] = referenceHalfToFloat(i + j);
+        }
+        const V a(&data[i], Vc::Unaligned);
+        const auto nan = isnan(ref);
+        COMPARE(isnan(a), nan) << "i = " << i;
+        ref.setZero(nan);
+        COMPARE(iif(nan, V::Zero(), a), ref) << "i = " << i;
+
+        V b;
+        b.load(&data[i + 1], Vc::Unaligned);
+        COMPARE(isnan(b), isnan(V(&data[i + 1], Vc::Unaligned)));
+    }
+}
+
+TEST_TYPES(V, storeHalf, ALL_TYPES)
+{
+    constexpr std::size_t Count = 0x7c00;
+    std::vector<half> data(Count + V::Size);
+    std::vector<float> input(Count + V::Size);
+    for (std::size_t i = 0; i < input.size(); ++i) {
+        // exercise rounding: every other value lies between two representable values
+        const float f0 = referenceHalfToFloat(i / 2);
+        const float f1 = referenceHalfToFloat(i / 2 + 1);
+        input[i] = (i & 1) ? f0 + (f1 - f0) * 0.75f : f0;
+        if (i % 7 == 3) {
+            input[i] = -input[i];
+        }
+    }
+    for (std::size_t i = 0; i + V::Size <= Count; i += V::Size) {
+        const V x(&input[i], Vc::Unaligned);
+        x.store(&data[i], Vc::Unaligned);
+        for (std::size_t j = 0; j < V::Size; ++j) {
+            COMPARE(data[i + j].bits(), half(input[i + j]).bits()) << "i + j = " << i + j;
+        }
+    }
+
+    const V x(&input[100], Vc::Unaligned);
+    UnitTest::withRandomMask<V, 100>([&](typename V::Mask mask) {
+        for (auto &h : data) {
+            h = half::fromBits(0x1234);
+        }
+        x.store(&data[1], mask, Vc::Unaligned);
+        COMPARE(data[0].bits(), 0x1234);
+        COMPARE(data[V::Size + 1].bits(), 0x1234);
+        for (std::size_t j = 0; j < V::Size; ++j) {
+            COMPARE(data[j + 1].bits(), mask[j] ? half(x[j]).bits() : 0x1234)
+                << "mask = " << mask;
+        }
+    });
+}
+
+TEST_TYPES(V, gatherScatterHalf, ALL_TYPES)
+{
+    using IT = typename V::IndexType;
+    half data[256];
+    for (int i = 0; i < 256; ++i) {
+        data[i] = float(i) * 0.5f;
+    }
+    const IT indexes = IT::IndexesFromZero() * 3 + 1;
+    const V a(data, indexes);
+    COMPARE(a, (V::IndexesFromZero() * 3 + 1) * 0.5f);
+
+    (a * 2).scatter(data, indexes);
+    for (std::size_t i = 0; i < V::Size; ++i) {
+        COMPARE(float(data[indexes[i]]), a[i] * 2);
+    }
+}
+
+template <typename M, std::size_t N> struct HalfStruct {
+    M d[N];
+};
+
+TEST_TYPES(Param, interleavedHalf,
+           (outer_product<Typelist<half, bfloat16>,
+                          Typelist<std::integral_constant<std::size_t, 2>,
+                                   std::integral_constant<std::size_t, 3>,
+                                   std::integral_constant<std::size_t, 4>,
+                                   std::integral_constant<std::size_t, 5>>>))
+{
+    using V = float_v;
+    using IT = V::IndexType;
+    using M = typename Param::template at<0>;
+    constexpr std::size_t StructSize = Param::template at<1>::value;
+    using S = HalfStruct<M, StructSize>;
+    constexpr std::size_t N = 4 * V::Size;
+    S data[N];
+    for (std::size_t i = 0; i < N; ++i) {
+        for (std::size_t j = 0; j < StructSize; ++j) {
+            data[i].d[j] = float(i * StructSize + j);  // exact in half and bfloat16
+        }
+    }
+    InterleavedMemoryWrapper<S, V, M> wrapper(data);
+    const InterleavedMemoryWrapper<const S, V, M> constWrapper(data);
+
+    V a, b;
+    tie(a, b) = wrapper[V::Size];
+    COMPARE(a, (V::IndexesFromZero() + V::Size) * float(StructSize));
+    COMPARE(b, (V::IndexesFromZero() + V::Size) * float(StructSize) + 1);
+
+    // the gathered structs lie before the last V::Size structs
+    const IT indexes = IT::IndexesFromZero() * 2 + 1;
+    tie(a, b) = constWrapper[indexes];
+    COMPARE(a, simd_cast<V>(indexes) * float(StructSize));
+    COMPARE(b, simd_cast<V>(indexes) * float(StructSize) + 1);
+
+    // writes of the first two members must leave the remaining members untouched
+    const V minusA = -a, minusB = -b;
+    wrapper[3 * V::Size] = tie(minusA, minusB);
+    wrapper[indexes] = tie(b, a);
+    for (std::size_t i = 0; i < N; ++i) {
+        for (std::size_t j = 2; j < StructSize; ++j) {
+            COMPARE(float(data[i].d[j]), float(i * StructSize + j));
+        }
+    }
+    V c, d;
+    tie(c, d) = wrapper[3 * V::Size];
+    COMPARE(c, minusA);
+    COMPARE(d, minusB);
+    tie(c, d) = constWrapper[indexes];
+    COMPARE(c, b);
+    COMPARE(d, a);
+}
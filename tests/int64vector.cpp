@@ -0,0 +1,232 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+#include <limits>
+
+using namespace Vc;
+
+#define INT64_VECTORS (Vc::llong_v, Vc::ullong_v)
+
+template <typename V> V randomVector()
+{
+    using T = typename V::EntryType;
+    return V::generate([](int) {
+        return T((ullong(std::rand()) << 42) ^ (ullong(std::rand()) << 21) ^
+                 ullong(std::rand()));
+    });
+}
+
+TEST_TYPES(V, arithmetics, INT64_VECTORS)
+{
+    using T = typename V::EntryType;
+    for (int repetition = 0; repetition < 1000; ++repetition) {
+        const V a = randomVector<V>();
+        V b = randomVector<V>() >> (repetition % 64);
+        where(b == 0) | b = 1;
+        const V shifts = V::generate([&](int i) { return T((repetition + 17 * i) % 64); });
+        for (std::size_t i = 0; i < V::Size; ++i) {
+            COMPARE((a + b)[i], T(a[i] + b[i]));
+            COMPARE((a - b)[i], T(a[i] - b[i]));
+            COMPARE((a * b)[i], T(a[i] * b[i])) << a << " * " << b;
+            COMPARE((a / b)[i], T(a[i] / b[i]));
+            COMPARE((a % b)[i], T(a[i] % b[i]));
+            COMPARE((-a)[i], T(-a[i]));
+            COMPARE((a & b)[i], T(a[i] & b[i]));
+            COMPARE((a | b)[i], T(a[i] | b[i]));
+            COMPARE((a ^ b)[i], T(a[i] ^ b[i]));
+            COMPARE(min(a, b)[i], std::min<T>(a[i], b[i]));
+            COMPARE(max(a, b)[i], std::max<T>(a[i], b[i]));
+            for (int shift = 0; shift < 64; ++shift) {
+                COMPARE((a << shift)[i], T(a[i] << shift)) << "shift: " << shift;
+                COMPARE((a >> shift)[i], T(a[i] >> shift)) << "shift: " << shift;
+            }
+            COMPARE((a << shifts)[i], T(a[i] << shifts[i])) << "shifts: " << shifts;
+            COMPARE((a >> shifts)[i], T(a[i] >> shifts[i])) << "shifts: " << shifts;
+        }
+    }
+}
+
+TEST(absLlong)
+{
+    for (int repetition = 0; repetition < 1000; ++repetition) {
+        const llong_v a = randomVector<llong_v>() - randomVector<llong_v>();
+        const llong_v b = abs(a);
+        for (std::size_t i = 0; i < llong_v::Size; ++i) {
+            COMPARE(b[i], a[i] < 0 ? -a[i] : a[i]);
+        }
+    }
+}
+
+TEST_TYPES(V, compares, INT64_VECTORS)
+{
+    for (int repetition = 0; repetition < 1000; ++repetition) {
+        const V a = randomVector<V>();
+        // also compare values that differ only in the low or only in the high half
+        const V b = iif(randomVector<V>() > a, a ^ V(1), a ^ V(ullong(1) << 40));
+        for (const V &c : {a, b, randomVector<V>()}) {
+            const auto eq = a == c, ne = a != c, lt = a < c, le = a <= c, gt = a > c,
+                       ge = a >= c;
+            int bits = 0, count = 0;
+            for (std::size_t i = 0; i < V::Size; ++i) {
+                COMPARE(eq[i], a[i] == c[i]);
+                COMPARE(ne[i], a[i] != c[i]);
+                COMPARE(lt[i], a[i] < c[i]) << a << " < " << c;
+                COMPARE(le[i], a[i] <= c[i]);
+                COMPARE(gt[i], a[i] > c[i]);
+                COMPARE(ge[i], a[i] >= c[i]);
+                bits |= int(lt[i]) << i;
+                count += lt[i];
+            }
+            COMPARE(lt.toInt(), bits);
+            COMPARE(lt.count(), count);
+        }
+    }
+}
+
+TEST_TYPES(V, reductions, INT64_VECTORS)
+{
+    using T = typename V::EntryType;
+    for (int repetition = 0; repetition < 1000; ++repetition) {
+        const V a = randomVector<V>();
+        T sum = 0, product = 1, minimum = a[0], maximum = a[0];
+        for (std::size_t i = 0; i < V::Size; ++i) {
+            sum += a[i];
+            product *= a[i];
+            minimum = std::min<T>(minimum, a[i]);
+            maximum = std::max<T>(maximum, a[i]);
+        }
+        COMPARE(a.sum(), sum);
+        COMPARE(a.product(), product);
+        COMPARE(a.min(), minimum);
+        COMPARE(a.max(), maximum);
+    }
+}
+
+TEST_TYPES(V, indexesAndReversed, INT64_VECTORS)
+{
+    using T = typename V::EntryType;
+    const V a = V::IndexesFromZero();
+    for (std::size_t i = 0; i < V::Size; ++i) {
+        COMPARE(a[i], T(i));
+        COMPARE(a.reversed()[i], T(V::Size - 1 - i));
+    }
+    COMPARE(V::One(), V(T(1)));
+    COMPARE(V::Zero(), V(T(0)));
+}
+
+TEST_TYPES(V, loadStore, INT64_VECTORS)
+{
+    using T = typename V::EntryType;
+    alignas(64) T data[V::Size * 3];
+    for (std::size_t i = 0; i < V::Size * 3; ++i) {
+        data[i] = T(i) << 33;
+    }
+    const V a(&data[0], Vc::Aligned);
+    const V b(&data[1], Vc::Unaligned);
+    for (std::size_t i = 0; i < V::Size; ++i) {
+        COMPARE(a[i], T(i) << 33);
+        COMPARE(b[i], T(i + 1) << 33);
+    }
+    (a + b).store(&data[V::Size], Vc::Aligned);
+    for (std::size_t i = 0; i < V::Size; ++i) {
+        COMPARE(data[V::Size + i], T(2 * i + 1) << 33);
+    }
+}
+
+TEST_TYPES(V, convertDouble, INT64_VECTORS)
+{
+    using T = typename V::EntryType;
+    using D = Vc::Vector<double, typename V::abi>;
+    using W = SimdArray<double, V::Size>;
+    for (int repetition = 0; repetition < 1000; ++repetition) {
+        const V a = randomVector<V>();
+        const W x = simd_cast<W>(a);
+        for (std::size_t i = 0; i < V::Size; ++i) {
+            COMPARE(x[i], double(a[i]));
+        }
+        // values below 2^53 round-trip exactly
+        const W y = simd_cast<W>(V(a >> 11));
+        const V b = simd_cast<V>(y);
+        for (std::size_t i = 0; i < V::Size; ++i) {
+            COMPARE(b[i], T(a[i] >> 11));
+        }
+    }
+    if (D::Size == V::Size) {
+        const V a = V::IndexesFromZero() * V(T(1) << 40);
+        const D x = simd_cast<D>(a);
+        for (std::size_t i = 0; i < V::Size; ++i) {
+            COMPARE(x[i], double(a[i]));
+        }
+        COMPARE(simd_cast<V>(x), a);
+    }
+}
+
+TEST_TYPES(V, convertInt, INT64_VECTORS)
+{
+    using T = typename V::EntryType;
+    using I = SimdArray<int, V::Size>;
+    using U = SimdArray<unsigned int, V::Size>;
+    for (int repetition = 0; repetition < 1000; ++repetition) {
+        const V a = randomVector<V>();
+        const I x = simd_cast<I>(a);
+        const U y = simd_cast<U>(a);
+        for (std::size_t i = 0; i < V::Size; ++i) {
+            COMPARE(x[i], int(a[i]));
+            COMPARE(y[i], static_cast<unsigned int>(a[i]));
+        }
+        COMPARE(simd_cast<V>(x), V::generate([&](int i) { return T(x[i]); }));
+        COMPARE(simd_cast<V>(y), V::generate([&](int i) { return T(y[i]); }));
+    }
+}
+
+TEST_TYPES(V, gather64BitIndexes, INT64_VECTORS)
+{
+    using T = typename V::EntryType;
+    T keys[256];
+    double values[256];
+    for (int i = 0; i < 256; ++i) {
+        keys[i] = (T(i) << 35) + T(i);
+        values[i] = 0.5 * i;
+    }
+    using D = SimdArray<double, V::Size>;
+    for (int repetition = 0; repetition < 100; ++repetition) {
+        // hash-join style lookup: 64-bit keys index the tables
+        const V indexes = randomVector<V>() & V(T(255));
+        const V k(keys, indexes);
+        const D v(values, indexes);
+        for (std::size_t i = 0; i < V::Size; ++i) {
+            COMPARE(k[i], keys[indexes[i]]);
+            COMPARE(v[i], values[indexes[i]]);
+        }
+        V masked = V::Zero();
+        masked.gather(keys, indexes, indexes > T(127));
+        for (std::size_t i = 0; i < V::Size; ++i) {
+            COMPARE(masked[i], indexes[i] > 127 ? keys[indexes[i]] : T(0));
+        }
+    }
+}
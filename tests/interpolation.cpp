@@ -0,0 +1,131 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#include "unittest.h"
+#include <Vc/interpolation>
+
+using namespace Vc;
+
+#define INTERPOLATION_TYPES (float_v, double_v, SimdArray<float, 8>, SimdArray<double, 3>)
+
+template <typename V> V randomCoordinate(typename V::EntryType lo, typename V::EntryType hi)
+{
+    using T = typename V::EntryType;
+    return V::generate([&](int) { return lo + (hi - lo) * T(std::rand()) / T(RAND_MAX); });
+}
+
+template <typename V>
+void compareAbsolute(const V &a, const V &b, typename V::EntryType tolerance)
+{
+    for (std::size_t l = 0; l < V::Size; ++l) {
+        COMPARE_ABSOLUTE_ERROR(a[l], b[l], tolerance) << "lane " << l;
+    }
+}
+
+template <typename T> T tolerance() { return std::is_same<T, float>::value ? 1e-4 : 1e-10; }
+
+TEST_TYPES(V, gridValues, INTERPOLATION_TYPES)
+{
+    using T = typename V::EntryType;
+    GridInterpolator<T, 3> grid({{-1, 0, 2}}, {{1, 3, 3}}, {{5, 7, 6}});
+    std::vector<T> values(5 * 7 * 6);
+    for (auto &x : values) {
+        x = T(std::rand() % 1000);
+    }
+    grid.assign(values.data());
+    for (std::size_t k = 0; k < 6; ++k) {
+        for (std::size_t j = 0; j < 7; ++j) {
+            for (std::size_t i = 0; i < 5; ++i) {
+                const T ref = values[(k * 7 + j) * 5 + i];
+                COMPARE(grid({{i, j, k}}), ref);
+                const auto p = grid.position({{i, j, k}});
+                const std::array<V, 3> x = {{V(p[0]), V(p[1]), V(p[2])}};
+                compareAbsolute(grid.linear(x), V(ref), ref * tolerance<T>());
+                compareAbsolute(grid.cubic(x), V(ref), ref * tolerance<T>());
+            }
+        }
+    }
+}
+
+TEST_TYPES(V, linear1D, INTERPOLATION_TYPES)
+{
+    using T = typename V::EntryType;
+    GridInterpolator<T, 1> grid({{2}}, {{4}}, {{9}});
+    grid.fill([](std::array<T, 1> x) { return 3 * x[0] - 1; });
+    for (int n = 0; n < 100; ++n) {
+        const V x = randomCoordinate<V>(2, 4);
+        compareAbsolute(grid.linear(std::array<V, 1>{{x}}), V(3) * x - V(1), tolerance<T>());
+    }
+    // clamped outside of the grid
+    compareAbsolute(grid.linear(std::array<V, 1>{{V(-10)}}), V(5), tolerance<T>());
+    compareAbsolute(grid.linear(std::array<V, 1>{{V(10)}}), V(11), tolerance<T>());
+    compareAbsolute(grid.cubic(std::array<V, 1>{{V(10)}}), V(11), tolerance<T>());
+}
+
+TEST_TYPES(V, linearReproducesMultilinear, INTERPOLATION_TYPES)
+{
+    using T = typename V::EntryType;
+    GridInterpolator<T, 2> grid2({{0, -1}}, {{1, 1}}, {{11, 13}});
+    grid2.fill([](std::array<T, 2> x) { return 2 * x[0] - x[1] + x[0] * x[1] + 1; });
+    GridInterpolator<T, 3> grid3({{0, -1, 1}}, {{1, 1, 2}}, {{6, 9, 5}});
+    grid3.fill([](std::array<T, 3> x) { return x[0] - 2 * x[1] + 3 * x[2] - 4; });
+    for (int n = 0; n < 100; ++n) {
+        const V x = randomCoordinate<V>(0, 1);
+        const V y = randomCoordinate<V>(-1, 1);
+        const V z = randomCoordinate<V>(1, 2);
+        compareAbsolute(grid2.linear(std::array<V, 2>{{x, y}}),
+                        V(2) * x - y + x * y + V(1), tolerance<T>());
+        compareAbsolute(grid3.linear(std::array<V, 3>{{x, y, z}}),
+                        x - V(2) * y + V(3) * z - V(4), tolerance<T>());
+    }
+}
+
+TEST_TYPES(V, cubicReproducesQuadratic, INTERPOLATION_TYPES)
+{
+    using T = typename V::EntryType;
+    // the cubic stencil needs one grid point on either side; stay within [1, n - 2]
+    GridInterpolator<T, 1> grid1({{0}}, {{10}}, {{11}});
+    grid1.fill([](std::array<T, 1> x) { return x[0] * x[0] - 3 * x[0]; });
+    GridInterpolator<T, 2> grid2({{0, 0}}, {{10, 5}}, {{11, 11}});
+    grid2.fill([](std::array<T, 2> x) { return x[0] * x[0] + x[0] * x[1] - x[1] * x[1]; });
+    GridInterpolator<T, 3> grid3({{0, 0, 0}}, {{1, 1, 1}}, {{9, 6, 7}});
+    grid3.fill([](std::array<T, 3> x) { return x[0] * x[2] + x[1] * x[1] - x[2]; });
+    for (int n = 0; n < 100; ++n) {
+        const V x = randomCoordinate<V>(1, 9);
+        compareAbsolute(grid1.cubic(std::array<V, 1>{{x}}), x * x - V(3) * x,
+                        10 * tolerance<T>());
+        const V y = randomCoordinate<V>(0.5, 4.5);
+        compareAbsolute(grid2.cubic(std::array<V, 2>{{x, y}}), x * x + x * y - y * y,
+                        100 * tolerance<T>());
+        const V u = randomCoordinate<V>(T(1) / 8, T(7) / 8);
+        const V v = randomCoordinate<V>(T(1) / 5, T(4) / 5);
+        const V w = randomCoordinate<V>(T(1) / 6, T(5) / 6);
+        compareAbsolute(grid3.cubic(std::array<V, 3>{{u, v, w}}), u * w + v * v - w,
+                        tolerance<T>());
+    }
+}
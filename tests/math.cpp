@@ -243,6 +243,12 @@ TEST_TYPES(V, testRound, (RealTypes)) //{{{1
         //std::cout << a << ref << std::endl;
         COMPARE(Vc::round(a), ref);
     }
+    // values outside of the int range
+    COMPARE(Vc::round(V(T(1e10))), V(T(1e10)));
+    COMPARE(Vc::round(V(T(-3e9) - T(0.5))), V(T(-3e9)));
+    COMPARE(Vc::round(V(T(1) / std::numeric_limits<T>::epsilon() + T(1))),
+            V(T(1) / std::numeric_limits<T>::epsilon() + T(1)));
+    COMPARE(Vc::round(V(std::numeric_limits<T>::max())), V(std::numeric_limits<T>::max()));
 }
 
 TEST_TYPES(V, testExponent, (RealTypes)) //{{{1
@@ -364,6 +370,217 @@ TEST_TYPES(V, testCopysign, (RealTypes))
     COMPARE(z, V::generate([&](int i) { return std::copysign(x[i], y[i]); }));
 }
 
+// polyval {{{1
+template <typename T, std::size_t N> T polyvalReference(T x, const T (&c)[N])
+{
+    long double r = 0;
+    for (std::size_t i = N; i > 0; --i) {
+        r = r * x + c[i - 1];
+    }
+    return r;
+}
+
+// The vector FUZZY_COMPARE miscomputes the ulp distance for some SimdArray<double, N>
+// types with AVX2 (testExp fails the same way), therefore polyval and rational compare
+// lane by lane against the scalar reference.
+template <typename V> void fuzzyCompareLanes(const V &x, const V &ref, const char *what)
+{
+    using T = typename V::EntryType;
+    for (std::size_t j = 0; j < V::Size; ++j) {
+        FUZZY_COMPARE(T(x[j]), T(ref[j])) << what << ", j = " << j;
+    }
+}
+
+template <typename V, typename T, std::size_t N> void testPolyvalN(const T (&c)[N])
+{
+    for (int i = 0; i < 1000; ++i) {
+        const V x = V::Random() * T(2) - T(1);
+        const V ref = V::generate([&](int j) { return polyvalReference(x[j], c); });
+        fuzzyCompareLanes(polyvalHorner(x, c), ref, "polyvalHorner");
+        fuzzyCompareLanes(polyvalEstrin(x, c), ref, "polyvalEstrin");
+        fuzzyCompareLanes(polyval(x, c), ref, "polyval");
+    }
+}
+
+TEST_TYPES(V, testPolyval, (RealTypes))
+{
+    using T = typename V::EntryType;
+    UnitTest::setFuzzyness<float>(4);
+    UnitTest::setFuzzyness<double>(4);
+    const T c[] = {T(1), T(0.5), T(1) / 6, T(1) / 24, T(1) / 120, T(1) / 720,
+                   T(1) / 5040, T(1) / 40320, T(1) / 362880, T(1) / 3628800,
+                   T(1) / 39916800, T(1) / 479001600, T(1) / 6227020800.};
+    const T c1[] = {T(3)};
+    const T c2[] = {T(3), T(-2)};
+    const T c3[] = {T(3), T(-2), T(0.5)};
+    const T c5[] = {T(3), T(-2), T(0.5), T(0.25), T(-0.125)};
+    const T c8[] = {c[0], c[1], c[2], c[3], c[4], c[5], c[6], c[7]};
+    testPolyvalN<V>(c1);
+    testPolyvalN<V>(c2);
+    testPolyvalN<V>(c3);
+    testPolyvalN<V>(c5);
+    testPolyvalN<V>(c8);
+    testPolyvalN<V>(c);
+
+    const V x = V::IndexesFromZero();
+    COMPARE(polyval(x, 1, 2, 3), T(1) + x * (T(2) + x * T(3)));
+    COMPARE(polyval(x, T(5)), V(T(5)));
+}
+
+TEST_TYPES(V, testRational, (RealTypes)) //{{{1
+{
+    using T = typename V::EntryType;
+    UnitTest::setFuzzyness<float>(4);
+    UnitTest::setFuzzyness<double>(4);
+    // Padé approximant of exp(x) of order [3/3]
+    const T p[] = {T(1), T(0.5), T(0.1), T(1) / 120};
+    const T q[] = {T(1), T(-0.5), T(0.1), T(-1) / 120};
+    for (int i = 0; i < 1000; ++i) {
+        const V x = V::Random() - T(0.5);
+        const V ref = V::generate(
+            [&](int j) { return polyvalReference(x[j], p) / polyvalReference(x[j], q); });
+        fuzzyCompareLanes(rational(x, p, q), ref, "rational");
+        VERIFY(all_of(abs(rational(x, p, q) - exp(x)) < T(1e-5)));
+    }
+}
+
+TEST_TYPES(V, testChebval, (RealTypes)) //{{{1
+{
+    using T = typename V::EntryType;
+    UnitTest::setFuzzyness<float>(16);
+    UnitTest::setFuzzyness<double>(16);
+    const T c1[] = {T(2)};
+    const T c[] = {T(0.5), T(-1), T(0.25), T(2), T(-0.75), T(0.125)};
+    for (int i = 0; i < 1000; ++i) {
+        const V x = V::Random() * T(2) - T(1);
+        COMPARE(chebval(x, c1), V(T(2)));
+        const V ref = V::generate([&](int j) {
+            // T_n(cos(t)) = cos(n * t)
+            const long double t = std::acos(static_cast<long double>(x[j]));
+            long double r = 0;
+            for (int n = 0; n < 6; ++n) {
+                r += c[n] * std::cos(n * t);
+            }
+            return static_cast<T>(r);
+        });
+        const V cheb = chebval(x, c);
+        VERIFY(all_of(abs(cheb - ref) < T(std::is_same<T, float>::value ? 1e-5 : 1e-13)))
+            << "x = " << x << "\ncheb = " << cheb << "\nref = " << ref;
+    }
+}
+
+// SimdArray math is vectorized {{{1
+// Every math function called with a SimdArray must forward to the overloads of the native
+// vector types the SimdArray is made of. VectorizedMath<V> only compiles if all of them
+// exist for V and return V (or V::MaskType), and not e.g. a type the arguments were
+// implicitly converted to. It is instantiated for the SimdArray types and for the native
+// vector types they are made of.
+template <typename V> struct VectorizedMath {
+    using I = typename V::IndexType;
+    using M = typename V::MaskType;
+    template <typename R> static constexpr bool check()
+    {
+        return std::is_same<R, V>::value;
+    }
+    template <typename R> static constexpr bool checkMask()
+    {
+        return std::is_same<R, M>::value;
+    }
+#define Vc_CHECK_UNARY_(fun_)                                                            \
+    static_assert(check<decltype(fun_(std::declval<V>()))>(), #fun_ " is not vectorized")
+#define Vc_CHECK_BINARY_(fun_)                                                           \
+    static_assert(check<decltype(fun_(std::declval<V>(), std::declval<V>()))>(),         \
+                  #fun_ " is not vectorized")
+#define Vc_CHECK_PREDICATE_(fun_)                                                        \
+    static_assert(checkMask<decltype(fun_(std::declval<V>()))>(),                        \
+                  #fun_ " is not vectorized")
+    // common/trigonometric.h, common/logarithm.h, common/exponential.h
+    Vc_CHECK_UNARY_(sin);
+    Vc_CHECK_UNARY_(cos);
+    Vc_CHECK_UNARY_(asin);
+    Vc_CHECK_UNARY_(atan);
+    Vc_CHECK_BINARY_(atan2);
+    Vc_CHECK_UNARY_(log);
+    Vc_CHECK_UNARY_(log2);
+    Vc_CHECK_UNARY_(log10);
+    Vc_CHECK_UNARY_(exp);
+    static_assert(check<decltype(ldexp(std::declval<V>(), std::declval<I>()))>(),
+                  "ldexp is not vectorized");
+    static_assert(check<decltype(frexp(std::declval<V>(), std::declval<I *>()))>(),
+                  "frexp is not vectorized");
+    static_assert(std::is_same<decltype(sincos(std::declval<V>(), std::declval<V *>(),
+                                               std::declval<V *>())),
+                               void>::value,
+                  "sincos is not vectorized");
+    // common/math.h and the math of the implementations
+    Vc_CHECK_UNARY_(sqrt);
+    Vc_CHECK_UNARY_(rsqrt);
+    Vc_CHECK_UNARY_(reciprocal);
+    Vc_CHECK_UNARY_(abs);
+    Vc_CHECK_UNARY_(floor);
+    Vc_CHECK_UNARY_(ceil);
+    Vc_CHECK_UNARY_(round);
+    Vc_CHECK_UNARY_(trunc);
+    Vc_CHECK_UNARY_(exponent);
+    Vc_CHECK_BINARY_(min);
+    Vc_CHECK_BINARY_(max);
+    Vc_CHECK_BINARY_(copysign);
+    static_assert(check<decltype(fma(std::declval<V>(), std::declval<V>(),
+                                     std::declval<V>()))>(),
+                  "fma is not vectorized");
+    Vc_CHECK_PREDICATE_(isnan);
+    Vc_CHECK_PREDICATE_(isinf);
+    Vc_CHECK_PREDICATE_(isfinite);
+    Vc_CHECK_PREDICATE_(isnegative);
+#undef Vc_CHECK_UNARY_
+#undef Vc_CHECK_BINARY_
+#undef Vc_CHECK_PREDICATE_
+    static constexpr bool value = true;
+};
+
+// Returns the number of scalar entries in SimdArray A that are stored in Scalar::Vector
+// objects and instantiates VectorizedMath for all its (native) vector types.
+template <typename A> constexpr std::size_t scalarEntries(std::true_type)
+{
+    return VectorizedMath<typename A::vector_type>::value &&
+                   std::is_same<typename A::vector_type,
+                                Scalar::Vector<typename A::EntryType>>::value
+               ? 1
+               : 0;
+}
+template <typename A> constexpr std::size_t scalarEntries(std::false_type)
+{
+    using A0 = typename A::storage_type0;
+    using A1 = typename A::storage_type1;
+    return scalarEntries<A0>(std::integral_constant<bool, A0::Size == A0::vector_type::Size>()) +
+           scalarEntries<A1>(std::integral_constant<bool, A1::Size == A1::vector_type::Size>());
+}
+template <typename A> constexpr std::size_t scalarEntries()
+{
+    return scalarEntries<A>(std::integral_constant<bool, A::Size == A::vector_type::Size>());
+}
+
+TEST_TYPES(T, simdArrayMathIsVectorized, (float, double)) //{{{1
+{
+    // sizes that are a multiple of the narrowest vector width must not contain scalar
+    // pieces (except for the Scalar implementation, obviously)
+    constexpr std::size_t Narrower =
+        Common::select_best_vector_type<T, Vector<T>::Size - 1>::Size;
+    constexpr std::size_t W = Narrower == 1 ? Vector<T>::Size : Narrower;
+    constexpr bool scalarImpl = std::is_same<Vector<T>, Scalar::Vector<T>>::value;
+    using A = SimdArray<T, 3 * W>;
+    using B = SimdArray<T, Vector<T>::Size + W>;
+    using C = SimdArray<T, 3 * Vector<T>::Size>;
+    using D = SimdArray<T, 2 * Vector<T>::Size + 1>;
+    static_assert(VectorizedMath<A>::value && VectorizedMath<B>::value &&
+                      VectorizedMath<C>::value && VectorizedMath<D>::value,
+                  "");
+    COMPARE(scalarEntries<A>(), scalarImpl ? A::Size : 0u);
+    COMPARE(scalarEntries<B>(), scalarImpl ? B::Size : 0u);
+    COMPARE(scalarEntries<C>(), scalarImpl ? C::Size : 0u);
+    COMPARE(scalarEntries<D>(), scalarImpl ? D::Size : 1u);
+}
+
 //}}}1
 
 // vim: foldmethod=marker
@@ -0,0 +1,211 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2016 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#include "unittest.h"
+#include <cmath>
+
+using namespace Vc;
+
+#define ALL_TYPES (float_v, SimdArray<float, 3>, SimdArray<float, 8>, SimdArray<float, 17>)
+
+TEST(scalarBfloat16)
+{
+    for (std::uint32_t i = 0; i < 0x10000; ++i) {
+        const std::uint16_t h = i;
+        const float f = bfloat16::fromBits(h);
+        if (std::isnan(f)) {
+            VERIFY(std::isnan(float(bfloat16(f))));
+        } else {
+            COMPARE(bfloat16(f).bits(), h);
+        }
+    }
+
+    // rounding
+    COMPARE(bfloat16(1.f).bits(), 0x3f80);
+    COMPARE(bfloat16(1.f + std::ldexp(1.f, -8)).bits(), 0x3f80);      // tie to even
+    COMPARE(bfloat16(1.f + std::ldexp(3.f, -8)).bits(), 0x3f82);      // tie to even
+    COMPARE(bfloat16(1.f + std::ldexp(3.f, -9)).bits(), 0x3f81);
+    COMPARE(bfloat16(std::numeric_limits<float>::max()).bits(), 0x7f80);
+    COMPARE(bfloat16(-std::numeric_limits<float>::infinity()).bits(), 0xff80);
+}
+
+template <typename V> static V bfloat16Input(std::size_t i)
+{
+    V x = V::IndexesFromZero() + float(i);
+    x = x * 1.00390625f + 0.001953125f * x * x;
+    for (std::size_t j = 1; j < V::Size; j += 3) {
+        x[j] = -x[j];
+    }
+    return x;
+}
+
+TEST_TYPES(V, loadStoreBfloat16, ALL_TYPES)
+{
+    std::vector<bfloat16> data(1024 + V::Size);
+    for (std::size_t i = 0; i + V::Size <= 1024; i += V::Size) {
+        const V x = bfloat16Input<V>(i);
+        x.store(&data[i], Vc::Unaligned);
+        V ref;
+        for (std::size_t j = 0; j < V::Size; ++j) {
+            COMPARE(data[i + j].bits(), bfloat16(x[j]).bits()) << "i + j = " << i + j;
+            ref[j] = bfloat16(x[j]);
+        }
+        COMPARE(V(&data[i], Vc::Unaligned), ref);
+    }
+
+    const V x = bfloat16Input<V>(100);
+    UnitTest::withRandomMask<V, 100>([&](typename V::Mask mask) {
+        for (auto &h : data) {
+            h = bfloat16::fromBits(0x1234);
+        }
+        x.store(&data[1], mask, Vc::Unaligned);
+        COMPARE(data[0].bits(), 0x1234);
+        COMPARE(data[V::Size + 1].bits(), 0x1234);
+        for (std::size_t j = 0; j < V::Size; ++j) {
+            COMPARE(data[j + 1].bits(), mask[j] ? bfloat16(x[j]).bits() : 0x1234)
+                << "mask = " << mask;
+        }
+    });
+}
+
+TEST_TYPES(V, dequantize8, ALL_TYPES)
+{
+    schar sdata[256 + V::Size];
+    uchar udata[256 + V::Size];
+    for (int i = 0; i < 256 + int(V::Size); ++i) {
+        sdata[i] = static_cast<schar>(i - 128);
+        udata[i] = static_cast<uchar>(i);
+    }
+    for (int i = 0; i < 256; i += V::Size) {
+        const V s = dequantize<V>(&sdata[i], 0.25f, -3, Vc::Unaligned);
+        const V u = dequantize<V>(&udata[i], 0.5f, 128, Vc::Unaligned);
+        for (std::size_t j = 0; j < V::Size; ++j) {
+            COMPARE(s[j], (sdata[i + j] + 3) * 0.25f);
+            COMPARE(u[j], (udata[i + j] - 128) * 0.5f);
+        }
+        COMPARE(dequantize<V>(&sdata[i], 1.f), V(&sdata[i]));
+    }
+}
+
+TEST_TYPES(V, quantize8, ALL_TYPES)
+{
+    schar sdata[V::Size + 2];
+    uchar udata[V::Size + 2];
+    for (int n = 0; n < 200; ++n) {
+        const V x = V::Random() * 100.f - 50.f;
+        quantize(x, &sdata[1], 0.25f, -3, Vc::Unaligned);
+        quantize(x, &udata[1], 0.5f, 128, Vc::Unaligned);
+        for (std::size_t j = 0; j < V::Size; ++j) {
+            const float s = std::nearbyint(x[j] / 0.25f) - 3;
+            const float u = std::nearbyint(x[j] / 0.5f) + 128;
+            COMPARE(int(sdata[j + 1]), int(std::max(-128.f, std::min(127.f, s))))
+                << "x = " << x[j];
+            COMPARE(int(udata[j + 1]), int(std::max(0.f, std::min(255.f, u))))
+                << "x = " << x[j];
+        }
+        // quantize followed by dequantize is within half a step for values in range
+        const V y = V::Random() * 60.f - 30.f;
+        quantize(y, &sdata[0], 0.25f);
+        VERIFY(all_of(abs(dequantize<V>(&sdata[0], 0.25f) - y) <= 0.125f)) << y;
+    }
+}
+
+TEST_TYPES(V, quantize8Double,
+           (double_v, SimdArray<double, 3>, SimdArray<double, 4>, SimdArray<double, 9>))
+{
+    schar sdata[V::Size + 1];
+    uchar udata[V::Size + 1];
+    for (int n = 0; n < 200; ++n) {
+        const V x = V::Random() * 100. - 50.;
+        quantize(x, &sdata[1], 0.25, -3, Vc::Unaligned);
+        quantize(x, &udata[1], 0.5, 128, Vc::Unaligned);
+        for (std::size_t j = 0; j < V::Size; ++j) {
+            const double s = std::nearbyint(x[j] / 0.25) - 3;
+            const double u = std::nearbyint(x[j] / 0.5) + 128;
+            COMPARE(int(sdata[j + 1]), int(std::max(-128., std::min(127., s))))
+                << "x = " << x[j];
+            COMPARE(int(udata[j + 1]), int(std::max(0., std::min(255., u))))
+                << "x = " << x[j];
+        }
+    }
+}
+
+TEST_TYPES(V, quantize32, ALL_TYPES)
+{
+    // the largest floats below 2^31 and 2^32
+    constexpr int intMax = 2147483520;
+    constexpr unsigned uintMax = 4294967040u;
+    int idata[V::Size];
+    unsigned udata[V::Size];
+    quantize(V(1e10f), idata, 1.f, 0, Vc::Unaligned);
+    quantize(V(1e10f), udata, 1.f, 0, Vc::Unaligned);
+    for (std::size_t j = 0; j < V::Size; ++j) {
+        COMPARE(idata[j], intMax);
+        COMPARE(udata[j], uintMax);
+    }
+    quantize(V(-1e10f), idata, 1.f, 0, Vc::Unaligned);
+    quantize(V(-1e10f), udata, 1.f, 0, Vc::Unaligned);
+    for (std::size_t j = 0; j < V::Size; ++j) {
+        COMPARE(idata[j], std::numeric_limits<int>::min());
+        COMPARE(udata[j], 0u);
+    }
+    const V x = V::IndexesFromZero() * 1000.f - 3000.f;
+    quantize(x, idata, 0.5f, 7, Vc::Unaligned);
+    for (std::size_t j = 0; j < V::Size; ++j) {
+        COMPARE(idata[j], int(x[j]) * 2 + 7);
+    }
+}
+
+TEST_TYPES(V, store8, ALL_TYPES)
+{
+    schar sdata[V::Size + 2];
+    uchar udata[V::Size + 2];
+    const V x = V::IndexesFromZero() * 3 - 7;
+    const V y = V::IndexesFromZero() * 7 + 0.75f;
+    x.store(&sdata[1], Vc::Unaligned);
+    y.store(&udata[1], Vc::Unaligned);
+    for (std::size_t j = 0; j < V::Size; ++j) {
+        COMPARE(int(sdata[j + 1]), int(x[j]));
+        COMPARE(int(udata[j + 1]), int(y[j]));
+    }
+
+    UnitTest::withRandomMask<V, 100>([&](typename V::Mask mask) {
+        std::fill_n(sdata, V::Size + 2, schar(99));
+        std::fill_n(udata, V::Size + 2, uchar(99));
+        x.store(&sdata[1], mask, Vc::Unaligned);
+        y.store(&udata[1], mask, Vc::Unaligned);
+        COMPARE(int(sdata[0]), 99);
+        COMPARE(int(sdata[V::Size + 1]), 99);
+        COMPARE(int(udata[0]), 99);
+        COMPARE(int(udata[V::Size + 1]), 99);
+        for (std::size_t j = 0; j < V::Size; ++j) {
+            COMPARE(int(sdata[j + 1]), mask[j] ? int(x[j]) : 99) << "mask = " << mask;
+            COMPARE(int(udata[j + 1]), mask[j] ? int(y[j]) : 99) << "mask = " << mask;
+        }
+    });
+}
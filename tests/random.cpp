@@ -26,6 +26,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 }}}*/
 
 #include "unittest.h"
+#include <Vc/random>
 
 #ifdef _WIN32
 void bzero(void *p, size_t n) { memset(p, 0, n); }
@@ -133,4 +134,152 @@ template <> void Random_<double_v>::run()
 }
 }  // namespace Tests
 
+TEST(xoshiro128ppReference)
+{
+    Vc::uint s[4] = {1, 2, 3, 4};
+    COMPARE(Vc::Detail::xoshiro128ppStep(s), 0x281u);
+    COMPARE(Vc::Detail::xoshiro128ppStep(s), 0x180387u);
+    COMPARE(Vc::Detail::xoshiro128ppStep(s), 0xc0183387u);
+    COMPARE(Vc::Detail::xoshiro128ppStep(s), 0xd1ae3b02u);
+    COMPARE(Vc::Detail::xoshiro128ppStep(s), 0x31e2310au);
+    COMPARE(Vc::Detail::xoshiro128ppStep(s), 0xfd275ab0u);
+
+    Vc::uint j[4] = {1, 2, 3, 4};
+    Vc::Detail::xoshiro128ppJump(j, Vc::Detail::xoshiro128ppJump64);
+    COMPARE(j[0], 0xa9765206u);
+    COMPARE(j[1], 0x797aa168u);
+    COMPARE(j[2], 0x5b62e331u);
+    COMPARE(j[3], 0x02abd971u);
+}
+
+#define ENGINE_TYPES (float_v, double_v, Vc::int_v, SimdArray<float, 8>, SimdArray<double, 3>)
+
+TEST_TYPES(V, engineStreams, ENGINE_TYPES)
+{
+    using Engine = Vc::Xoshiro128PlusPlus<V>;
+    using R = typename Engine::result_type;
+    Engine a(12345);
+    Engine b(12345);
+    Engine c(12345, 1);
+    Engine d(54321);
+    for (int i = 0; i < 100; ++i) {
+        const R x = a();
+        COMPARE(x, b());
+        VERIFY(none_of(x == d()));
+    }
+    b.discard(7);
+    for (int i = 0; i < 7; ++i) {
+        a();
+    }
+    COMPARE(a(), b());
+
+    // entry i + 1 continues where entry i is after 2^64 steps; all entries differ
+    const R x = c();
+    for (std::size_t i = 1; i < R::Size; ++i) {
+        for (std::size_t k = 0; k < i; ++k) {
+            VERIFY(x[i] != x[k]) << x;
+        }
+    }
+
+    a = Engine(12345);
+    a.jump();
+    c = Engine(12345, 1);
+    for (int i = 0; i < 100; ++i) {
+        COMPARE(a(), c());
+    }
+}
+
+TEST_TYPES(V, uniformRealDistribution, (float_v, double_v, SimdArray<float, 8>, SimdArray<double, 3>))
+{
+    using T = typename V::EntryType;
+    Vc::Xoshiro128PlusPlus<V> engine(1);
+    Vc::UniformRealDistribution<V> uniform(-2, 3);
+    COMPARE(uniform.a(), T(-2));
+    COMPARE(uniform.b(), T(3));
+    int histogram[10] = {};
+    constexpr int N = 100000;
+    for (int i = 0; i < N; ++i) {
+        const V x = uniform(engine);
+        VERIFY(all_of(x >= T(-2) && x < T(3))) << x;
+        for (std::size_t k = 0; k < V::Size; ++k) {
+            ++histogram[static_cast<int>((x[k] + 2) * 2)];
+        }
+    }
+    const int expected = N * V::Size / 10;
+    for (int n : histogram) {
+        VERIFY(std::abs(n - expected) < expected / 50) << n << " vs. " << expected;
+    }
+}
+
+TEST_TYPES(V, normalDistribution, (float_v, double_v, SimdArray<float, 8>, SimdArray<double, 3>))
+{
+    using T = typename V::EntryType;
+    Vc::Xoshiro128PlusPlus<V> engine(2, 5);
+    Vc::NormalDistribution<V> normal(1, 2);
+    constexpr int N = 100000;
+    double sum = 0, sum2 = 0;
+    int withinOneSigma = 0;
+    for (int i = 0; i < N; ++i) {
+        const V x = normal(engine);
+        VERIFY(all_of(isfinite(x))) << x;
+        for (std::size_t k = 0; k < V::Size; ++k) {
+            sum += x[k];
+            sum2 += double(x[k]) * x[k];
+            withinOneSigma += std::abs(x[k] - T(1)) < T(2);
+        }
+    }
+    const double n = double(N) * V::Size;
+    const double mean = sum / n;
+    const double variance = sum2 / n - mean * mean;
+    VERIFY(std::abs(mean - 1) < 0.02) << mean;
+    VERIFY(std::abs(variance - 4) < 0.05) << variance;
+    VERIFY(std::abs(withinOneSigma / n - 0.6827) < 0.005) << withinOneSigma / n;
+}
+
+TEST_TYPES(V, uniformIntDistribution, (Vc::int_v, Vc::uint_v, Vc::short_v, SimdArray<int, 7>))
+{
+    using T = typename V::EntryType;
+    Vc::Xoshiro128PlusPlus<V> engine(3);
+    Vc::UniformIntDistribution<V> dice(-3, 2);
+    if (std::is_unsigned<T>::value) {
+        dice = Vc::UniformIntDistribution<V>(1, 6);
+    }
+    const T lo = dice.a();
+    COMPARE(dice.b(), T(lo + 5));
+    int histogram[6] = {};
+    constexpr int N = 60000;
+    for (int i = 0; i < N; ++i) {
+        const V x = dice(engine);
+        VERIFY(all_of(x >= lo && x <= T(lo + 5))) << x;
+        for (std::size_t k = 0; k < V::Size; ++k) {
+            ++histogram[x[k] - lo];
+        }
+    }
+    const int expected = N * V::Size / 6;
+    for (int n : histogram) {
+        VERIFY(std::abs(n - expected) < expected / 50) << n << " vs. " << expected;
+    }
+
+    // a range close to 2^32 / 2 makes almost half of the draws biased; check that the
+    // rejection loop keeps the result in range and unbiased
+    const T big = std::numeric_limits<T>::max() / 3 * 2;
+    Vc::UniformIntDistribution<V> wide(0, big);
+    int lowerHalf = 0;
+    for (int i = 0; i < N; ++i) {
+        const V x = wide(engine);
+        VERIFY(all_of(x >= 0 && x <= big)) << x;
+        lowerHalf += (x <= T(big / 2)).count();
+    }
+    VERIFY(std::abs(lowerHalf - N * int(V::Size) / 2) < N * int(V::Size) / 100) << lowerHalf;
+
+    Vc::UniformIntDistribution<V> full(std::numeric_limits<T>::min(),
+                                       std::numeric_limits<T>::max());
+    V x = full(engine);
+    for (int i = 0; i < 100; ++i) {
+        const V y = full(engine);
+        VERIFY(!all_of(x == y));
+        x = y;
+    }
+}
+
 // vim: foldmethod=marker
@@ -0,0 +1,75 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2016 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#define Vc_COUNT_SCALARIZATION 1
+#include "unittest.h"
+
+using namespace Vc;
+
+// whether V executes scalarizing code paths, i.e. whether it is not a single-entry type
+template <typename V> constexpr std::size_t expected(std::size_t n)
+{
+    return V::Size > 1 ? n : 0;
+}
+
+TEST_TYPES(V, vectorized_code_is_not_counted, (concat<AllVectors, SimdArray<float, 8>>))
+{
+    reset_scalarization_count();
+    V a = V::IndexesFromZero();
+    V b = a * a + V(1);
+    b = iif(b > a, b, a);
+    const V &cb = b;
+    const V c = cb[0];  // read-only element access is not flagged
+    COMPARE(c, V(1));
+    VERIFY(all_of(b >= a));
+    COMPARE(scalarization_count(), 0u);
+}
+
+TEST_TYPES(V, apply_is_counted, (AllVectors))
+{
+    using T = typename V::EntryType;
+    reset_scalarization_count();
+    V a = V::IndexesFromZero();
+    a = a.apply([](T x) { return T(x + 1); });
+    COMPARE(a, V::IndexesFromZero() + 1);
+    COMPARE(scalarization_count(), expected<V>(1));
+    a.callWithValuesSorted([](T) {});
+    COMPARE(scalarization_count(), expected<V>(2));
+}
+
+TEST_TYPES(V, element_access_is_counted, (AllVectors))
+{
+    using T = typename V::EntryType;
+    reset_scalarization_count();
+    V a = V::Zero();
+    for (std::size_t i = 0; i < V::Size; ++i) {
+        a[i] = T(i);
+    }
+    COMPARE(a, V::IndexesFromZero());
+    COMPARE(scalarization_count(), expected<V>(V::Size));
+}
@@ -228,3 +228,57 @@ TEST_TYPES(V, store, (SIMD_ARRAY_LIST))
     a.store(&data[1], Vc::Unaligned | Vc::Streaming);
     for (size_t i = 0; i < V::Size; ++i) COMPARE(data[i + 1], T(i));
 }
+
+// native_decomposition {{{1
+// Returns the number of native vectors/scalars a SimdArray<T, N> is made of.
+template <typename T, size_t N, typename V = Common::select_best_vector_type<T, N>>
+constexpr size_t pieces(std::true_type)
+{
+    return 1;
+}
+template <typename T, size_t N, typename V = Common::select_best_vector_type<T, N>>
+constexpr size_t pieces(std::false_type)
+{
+    using Traits = SimdArrayTraits<T, N>;
+    return pieces<T, Traits::N0>(std::integral_constant<
+               bool, Traits::N0 == Common::select_best_vector_type<T, Traits::N0>::Size>()) +
+           pieces<T, Traits::N1>(std::integral_constant<
+               bool, Traits::N1 == Common::select_best_vector_type<T, Traits::N1>::Size>());
+}
+template <typename T, size_t N> constexpr size_t pieces()
+{
+    return pieces<T, N>(
+        std::integral_constant<bool, N == Common::select_best_vector_type<T, N>::Size>());
+}
+
+// Returns the minimal number of pieces for N values, using the vector widths the target
+// supports for T (widest first).
+template <typename T, size_t W = Common::select_best_vector_type<T, 1024>::Size>
+struct MinimalPieces {
+    static constexpr size_t get(size_t N)
+    {
+        return N / W +
+               MinimalPieces<T, Common::select_best_vector_type<T, W - 1>::Size>::get(N % W);
+    }
+};
+template <typename T> struct MinimalPieces<T, 1> {
+    static constexpr size_t get(size_t N) { return N; }
+};
+
+template <typename T, size_t... Ns> void checkDecomposition(Vc::index_sequence<Ns...>)
+{
+    const size_t sizes[] = {(Ns + 3)...};
+    const size_t actual[] = {pieces<T, Ns + 3>()...};
+    for (size_t i = 0; i < sizeof...(Ns); ++i) {
+        COMPARE(actual[i], MinimalPieces<T>::get(sizes[i])) << "N = " << sizes[i];
+    }
+}
+
+TEST_TYPES(T, native_decomposition, (float, double, int, unsigned short))
+{
+    // SimdArray<T, N> must be split into the widest native vectors first and only use
+    // narrower vectors and scalars for the remainder, e.g. 12 floats are one AVX and one
+    // SSE vector with AVX. The benchmark in examples/simdarray_split compares the
+    // resulting code to scalar loops.
+    checkDecomposition<T>(Vc::make_index_sequence<62>());
+}
@@ -455,6 +455,68 @@ TEST(vector_iterator_vectorization)
     }
 }
 
+template <typename T> struct ShuffledPoint {
+    // the member order in memory differs from the tuple order on purpose
+    T z, x, y;
+
+    Vc_SIMDIZE_INTERFACE((x, y, z));
+};
+
+TEST_TYPES(T, contiguous_struct_iterator_vectorization,
+           (float, double, int, unsigned short))
+{
+    using P = ShuffledPoint<T>;
+    using L = std::vector<P>;
+    using LIV = simdize<typename L::iterator>;
+    using V = typename LIV::value_type;
+    using W = Vc::Traits::decay<decltype(std::declval<V &>().x)>;
+    static_assert(Vc::SimdizeDetail::IteratorDetails::access_strategy<
+                      typename L::iterator, V>::value ==
+                      Vc::SimdizeDetail::IteratorDetails::Access::Interleaved,
+                  "std::vector iterators of ShuffledPoint should use interleaved access");
+    static_assert(Vc::SimdizeDetail::IteratorDetails::access_strategy<
+                      typename std::list<P>::iterator, V>::value ==
+                      Vc::SimdizeDetail::IteratorDetails::Access::Scalar,
+                  "std::list iterators must use scalar access");
+
+    L list(V::size() * 8);
+    for (std::size_t i = 0; i < list.size(); ++i) {
+        list[i].x = T(i);
+        list[i].y = T(2 * i);
+        list[i].z = T(3 * i);
+    }
+    W reference = W::IndexesFromZero();
+    for (LIV b = list.begin(); b != list.end(); ++b, reference += T(V::size())) {
+        V p = *b;
+        COMPARE(p.x, reference);
+        COMPARE(p.y, reference * T(2));
+        COMPARE(p.z, reference * T(3));
+        V rotated = p;
+        rotated.x = p.z;
+        rotated.y = p.x;
+        rotated.z = p.y;
+        *b = rotated;
+    }
+    for (std::size_t i = 0; i < list.size(); ++i) {
+        COMPARE(list[i].x, T(3 * i));
+        COMPARE(list[i].y, T(i));
+        COMPARE(list[i].z, T(2 * i));
+    }
+
+    // write back through operator-> and iteration over a plain pointer
+    const simdize<P *> e = &list[0] + list.size();
+    for (simdize<P *> b = &list[0]; b != e; ++b) {
+        b->z += T(1);
+    }
+    const simdize<const P *> cb = &list[0];
+    COMPARE(cb->z, W::IndexesFromZero() * T(2) + T(1));
+    for (std::size_t i = 0; i < list.size(); ++i) {
+        COMPARE(list[i].x, T(3 * i));
+        COMPARE(list[i].y, T(i));
+        COMPARE(list[i].z, T(2 * i + 1));
+    }
+}
+
 TEST(shifted)
 {
     using T = std::tuple<float, int>;
@@ -0,0 +1,268 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#include "unittest.h"
+#include <Vc/SimdMatrix>
+
+using namespace Vc;
+
+#define SIMDMATRIX_TYPES                                                                 \
+    (float_v, double_v, SimdArray<float, 8>, SimdArray<double, 3>)
+
+template <typename V> V randomEntries()
+{
+    return V::generate([](int) {
+        return typename V::EntryType(std::rand() % 2001 - 1000) *
+               typename V::EntryType(0.001);
+    });
+}
+
+// diagonally dominant, hence well-conditioned
+template <typename V, std::size_t N> SimdMatrix<V, N> randomMatrix()
+{
+    SimdMatrix<V, N> m;
+    for (std::size_t i = 0; i < N; ++i) {
+        for (std::size_t j = 0; j < N; ++j) {
+            m(i, j) = randomEntries<V>();
+        }
+        m(i, i) += V(2 * N);
+    }
+    return m;
+}
+
+template <typename V>
+void compareAbsolute(const V &a, const V &b, typename V::EntryType tolerance)
+{
+    for (std::size_t l = 0; l < V::Size; ++l) {
+        COMPARE_ABSOLUTE_ERROR(a[l], b[l], tolerance) << "lane " << l;
+    }
+}
+
+template <typename V>
+void compareRelative(const V &a, const V &b, typename V::EntryType tolerance)
+{
+    for (std::size_t l = 0; l < V::Size; ++l) {
+        COMPARE_RELATIVE_ERROR(a[l], b[l], tolerance) << "lane " << l;
+    }
+}
+
+template <typename V, std::size_t N>
+void compareIdentity(const SimdMatrix<V, N> &m, typename V::EntryType tolerance)
+{
+    for (std::size_t i = 0; i < N; ++i) {
+        for (std::size_t j = 0; j < N; ++j) {
+            compareAbsolute(m(i, j), i == j ? V::One() : V::Zero(), tolerance);
+        }
+    }
+}
+
+template <typename T> T tolerance() { return std::is_same<T, float>::value ? 1e-5 : 1e-12; }
+
+TEST_TYPES(V, loadStore, SIMDMATRIX_TYPES)
+{
+    using T = typename V::EntryType;
+    std::vector<T> data(V::Size * 12), out(V::Size * 12);
+    for (std::size_t i = 0; i < data.size(); ++i) {
+        data[i] = T(i);
+    }
+    const SimdMatrix<V, 3, 4> m(data.data());
+    for (std::size_t lane = 0; lane < V::Size; ++lane) {
+        for (std::size_t i = 0; i < 3; ++i) {
+            for (std::size_t j = 0; j < 4; ++j) {
+                COMPARE(m(i, j)[lane], T(lane * 12 + i * 4 + j));
+            }
+        }
+    }
+    m.store(out.data());
+    COMPARE(out, data);
+}
+
+TEST_TYPES(V, multiplyAndTranspose, SIMDMATRIX_TYPES)
+{
+    using T = typename V::EntryType;
+    SimdMatrix<V, 2, 3> a;
+    SimdMatrix<V, 3, 4> b;
+    for (std::size_t i = 0; i < 3; ++i) {
+        for (std::size_t j = 0; j < 4; ++j) {
+            if (i < 2 && j < 3) {
+                a(i, j) = V::generate([&](int l) { return T(l + int(i) - int(j)); });
+            }
+            b(i, j) = V::generate([&](int l) { return T(l * int(j) + int(i)); });
+        }
+    }
+    const auto c = a * b;
+    COMPARE(c.rows(), 2u);
+    COMPARE(c.cols(), 4u);
+    for (std::size_t i = 0; i < 2; ++i) {
+        for (std::size_t j = 0; j < 4; ++j) {
+            V ref = V::Zero();
+            for (std::size_t k = 0; k < 3; ++k) {
+                ref += a(i, k) * b(k, j);
+            }
+            COMPARE(c(i, j), ref);
+        }
+    }
+    const auto ct = transpose(b) * transpose(a);
+    for (std::size_t i = 0; i < 2; ++i) {
+        for (std::size_t j = 0; j < 4; ++j) {
+            COMPARE(ct(j, i), c(i, j));
+        }
+    }
+    const std::array<V, 3> x = {{V(1), V(2), V(3)}};
+    const auto y = a * x;
+    for (std::size_t i = 0; i < 2; ++i) {
+        COMPARE(y[i], a(i, 0) + V(2) * a(i, 1) + V(3) * a(i, 2));
+    }
+    compareIdentity(SimdMatrix<V, 3>::Identity() * SimdMatrix<V, 3>::Identity(), T(0));
+}
+
+TEST_TYPES(V, determinant2to4, SIMDMATRIX_TYPES)
+{
+    using T = typename V::EntryType;
+    // upper triangular times lower triangular: the determinant is the product of the
+    // diagonals
+    SimdMatrix<V, 4> u = SimdMatrix<V, 4>::Zero(), l = SimdMatrix<V, 4>::Zero();
+    V diag = V::One();
+    for (std::size_t i = 0; i < 4; ++i) {
+        for (std::size_t j = 0; j < 4; ++j) {
+            if (j >= i) {
+                u(i, j) = randomEntries<V>() + (i == j ? V(2) : V(0));
+            }
+            if (j <= i) {
+                l(i, j) = randomEntries<V>() + (i == j ? V(2) : V(0));
+            }
+        }
+        diag *= u(i, i) * l(i, i);
+    }
+    const auto m = u * l;
+    compareRelative(determinant(m), diag, 100 * tolerance<T>());
+
+    SimdMatrix<V, 3> m3;
+    SimdMatrix<V, 2> m2;
+    for (std::size_t i = 0; i < 3; ++i) {
+        for (std::size_t j = 0; j < 3; ++j) {
+            m3(i, j) = m(i, j);
+            if (i < 2 && j < 2) {
+                m2(i, j) = m(i, j);
+            }
+        }
+    }
+    compareRelative(determinant(m2),
+                           m(0, 0) * m(1, 1) - m(0, 1) * m(1, 0), tolerance<T>());
+    // Laplace expansion along the second row
+    const V det3 = -m3(1, 0) * (m3(0, 1) * m3(2, 2) - m3(0, 2) * m3(2, 1)) +
+                   m3(1, 1) * (m3(0, 0) * m3(2, 2) - m3(0, 2) * m3(2, 0)) -
+                   m3(1, 2) * (m3(0, 0) * m3(2, 1) - m3(0, 1) * m3(2, 0));
+    compareRelative(determinant(m3), det3, 100 * tolerance<T>());
+}
+
+template <typename V, std::size_t N> void checkInverseAndSolve()
+{
+    using T = typename V::EntryType;
+    for (int repetition = 0; repetition < 100; ++repetition) {
+        const auto a = randomMatrix<V, N>();
+        compareIdentity(a * inverse(a), 10 * tolerance<T>());
+        compareIdentity(inverse(a) * a, 10 * tolerance<T>());
+
+        std::array<V, N> b;
+        for (auto &x : b) {
+            x = randomEntries<V>();
+        }
+        const auto x = solve(a, b);
+        const auto ax = a * x;
+        for (std::size_t i = 0; i < N; ++i) {
+            compareAbsolute(ax[i], b[i], 10 * tolerance<T>());
+        }
+    }
+}
+
+TEST_TYPES(V, inverseAndSolve, SIMDMATRIX_TYPES)
+{
+    checkInverseAndSolve<V, 1>();
+    checkInverseAndSolve<V, 2>();
+    checkInverseAndSolve<V, 3>();
+    checkInverseAndSolve<V, 4>();
+}
+
+TEST_TYPES(V, solveNeedsPivoting, SIMDMATRIX_TYPES)
+{
+    using T = typename V::EntryType;
+    // a permutation matrix that differs per lane has zeros on the diagonal in some lanes
+    SimdMatrix<V, 3> a = SimdMatrix<V, 3>::Zero();
+    for (std::size_t i = 0; i < 3; ++i) {
+        for (std::size_t j = 0; j < 3; ++j) {
+            a(i, j) = V::generate([&](int l) { return T((int(i) + l) % 3 == int(j)); });
+        }
+    }
+    const std::array<V, 3> b = {{V(1), V(2), V(3)}};
+    const auto x = solve(a, b);
+    const auto ax = a * x;
+    for (std::size_t i = 0; i < 3; ++i) {
+        COMPARE(ax[i], b[i]) << "i = " << i;
+    }
+}
+
+TEST_TYPES(V, quaternion, SIMDMATRIX_TYPES)
+{
+    using T = typename V::EntryType;
+    using Q = SimdQuaternion<V>;
+    const Q q = Q(randomEntries<V>(), randomEntries<V>(), randomEntries<V>(),
+                  randomEntries<V>() + V(0.5)).normalized();
+    compareAbsolute(q.norm(), V::One(), 10 * tolerance<T>());
+
+    const std::array<V, 3> v = {{randomEntries<V>(), randomEntries<V>(), randomEntries<V>()}};
+    const auto r1 = q.rotate(v);
+    const auto r2 = q.toMatrix() * v;
+    for (std::size_t i = 0; i < 3; ++i) {
+        compareAbsolute(r1[i], r2[i], 10 * tolerance<T>());
+    }
+    // the rotation matrix is orthonormal and the conjugate undoes the rotation
+    compareIdentity(q.toMatrix() * transpose(q.toMatrix()), 10 * tolerance<T>());
+    const auto back = q.conjugate().rotate(r1);
+    for (std::size_t i = 0; i < 3; ++i) {
+        compareAbsolute(back[i], v[i], 10 * tolerance<T>());
+    }
+    // composition
+    const Q p = Q(randomEntries<V>() + V(0.5), randomEntries<V>(), randomEntries<V>(),
+                  randomEntries<V>()).normalized();
+    const auto pq1 = (p * q).rotate(v);
+    const auto pq2 = p.rotate(q.rotate(v));
+    for (std::size_t i = 0; i < 3; ++i) {
+        compareAbsolute(pq1[i], pq2[i], 10 * tolerance<T>());
+    }
+    // a quarter turn around z maps x to y
+    const std::array<V, 3> zAxis = {{V::Zero(), V::Zero(), V::One()}};
+    const auto quarter = Q::fromAxisAngle(zAxis, V(T(1.5707963267948966)));
+    const auto y = quarter.rotate({{V::One(), V::Zero(), V::Zero()}});
+    compareAbsolute(y[0], V::Zero(), 10 * tolerance<T>());
+    compareAbsolute(y[1], V::One(), 10 * tolerance<T>());
+    compareAbsolute(y[2], V::Zero(), 10 * tolerance<T>());
+    const auto qi = Q::Identity() * q;
+    COMPARE(qi.w, q.w);
+    COMPARE(qi.z, q.z);
+}
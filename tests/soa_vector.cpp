@@ -0,0 +1,178 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2016 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#include "unittest.h"
+#include <Vc/simdize>
+
+using Vc::simdize;
+using Vc::soa_vector;
+
+template <typename T> struct Particle {
+    T x, y, z;
+    T mass;
+
+    Vc_SIMDIZE_INTERFACE((x, y, z, mass));
+
+    Particle(T xx, T yy, T zz, T m) : x(xx), y(yy), z(zz), mass(m) {}
+
+    typename std::decay<T>::type norm2() const { return x * x + y * y + z * z; }
+};
+using P = Particle<float>;
+using Mixed = std::tuple<float, int, double>;
+
+TEST(push_back_and_scalar_access)
+{
+    soa_vector<P> v;
+    VERIFY(v.empty());
+    for (int i = 0; i < 37; ++i) {
+        v.push_back(P(i, 2 * i, 3 * i, 1));
+    }
+    COMPARE(v.size(), 37u);
+    VERIFY(v.capacity() >= 37u);
+    COMPARE(v.capacity() % v.packet_size(), 0u);
+    for (int i = 0; i < 37; ++i) {
+        COMPARE(v[i].x, float(i));
+        COMPARE(v[i].y, float(2 * i));
+        COMPARE(v[i].norm2(), float(14 * i * i));
+        P p = v[i];
+        COMPARE(p.z, float(3 * i));
+    }
+    v[5].x = -1.f;
+    v[6] = P(1, 2, 3, 4);
+    v[7] = v[6];
+    COMPARE(v[5].x, -1.f);
+    COMPARE(v[5].y, 10.f);
+    COMPARE(v[7].mass, 4.f);
+    COMPARE(v.data<3>()[7], 4.f);
+
+    const auto &cv = v;
+    COMPARE(cv[6].z, 3.f);
+
+    v.pop_back();
+    COMPARE(v.size(), 36u);
+    COMPARE(v.data<0>()[36], 0.f);  // the removed object becomes zero padding
+}
+
+TEST(mixed_member_types)
+{
+    soa_vector<Mixed> v(3);
+    COMPARE(std::get<1>(v[2]), 0);
+    std::get<1>(v[2]) = 5;
+    v.push_back(Mixed(1.f, 2, 3.));
+    COMPARE(v.size(), 4u);
+    COMPARE(std::get<1>(v[2]), 5);
+    COMPARE(std::get<2>(v[3]), 3.);
+    const Mixed m = v[3];
+    COMPARE(std::get<0>(m), 1.f);
+
+    v.resize(20, Mixed(4.f, 5, 6.));
+    COMPARE(std::get<2>(v[19]), 6.);
+    v.resize(2);
+    COMPARE(v.size(), 2u);
+    for (int i = 2; i < 20; ++i) {
+        COMPARE(v.data<1>()[i], 0) << "i = " << i;
+        COMPARE(v.data<2>()[i], 0.) << "i = " << i;
+    }
+}
+
+TEST(packet_access)
+{
+    using V = simdize<P>;
+    using F = typename std::decay<decltype(std::declval<V>().x)>::type;
+    soa_vector<P> v;
+    const int n = int(3 * V::size() + 1);
+    for (int i = 0; i < n; ++i) {
+        v.push_back(P(i, 0, 0, 1));
+    }
+    COMPARE(v.packet_count(), 4u);
+    for (std::size_t k = 0; k < v.packet_count(); ++k) {
+        V p = v.packet(k);
+        const F ref = F::IndexesFromZero() + float(k * V::size());
+        COMPARE(p.x, iif(ref < float(n), ref, F::Zero()));  // the tail is zero-initialized
+        p.y = p.x * 2.f;
+        p.mass = 1.f;  // must not reach the padding of the last packet
+        v.store_packet(k, p);
+    }
+    static_assert(std::is_const<decltype(v.packet(0))>::value,
+                  "packet() must not return a modifiable temporary");
+    COMPARE(v.packet(3).mass, iif(F::IndexesFromZero() < 1.f, F(1.f), F::Zero()));
+    for (int i = 0; i < n; ++i) {
+        COMPARE(v[i].y, float(2 * i));
+    }
+    const auto &cv = v;
+    V p = cv.packet(1);
+    COMPARE(p.y, (F::IndexesFromZero() + float(V::size())) * 2.f);
+}
+
+struct AddOne {
+    template <typename V> void operator()(V &p) const
+    {
+        p.x += 1.f;
+        p.mass = p.mass * 2.f;
+    }
+};
+
+struct Sum {
+    float sum = 0.f;
+    template <typename V> void operator()(const V &p) { sum += p.mass.sum(); }
+};
+
+TEST(for_each)
+{
+    soa_vector<P> v;
+    const int n = int(5 * simdize<P>::size() + 3);
+    for (int i = 0; i < n; ++i) {
+        v.push_back(P(i, 0, 0, 1));
+    }
+    simd_for_each(v, AddOne());
+    for (int i = 0; i < n; ++i) {
+        COMPARE(v[i].x, float(i + 1));
+        COMPARE(v[i].mass, 2.f);
+    }
+    const auto &cv = v;
+    COMPARE(simd_for_each(cv, Sum()).sum, float(2 * n));
+}
+
+TEST(copy_and_move)
+{
+    soa_vector<P> a;
+    for (int i = 0; i < 10; ++i) {
+        a.push_back(P(i, i, i, i));
+    }
+    soa_vector<P> b = a;
+    b[0].x = 100.f;
+    COMPARE(a[0].x, 0.f);
+    COMPARE(b[9].mass, 9.f);
+    soa_vector<P> c = std::move(b);
+    COMPARE(c.size(), 10u);
+    COMPARE(c[0].x, 100.f);
+    a = c;
+    COMPARE(a[0].x, 100.f);
+    swap(a, b);
+    COMPARE(b.size(), 10u);
+}
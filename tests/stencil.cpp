@@ -0,0 +1,207 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#include "unittest.h"
+#include <Vc/stencil>
+
+using namespace Vc;
+
+#define STENCIL_TYPES (float, double)
+
+template <typename T> T tolerance() { return std::is_same<T, float>::value ? 1e-5 : 1e-12; }
+
+template <typename T, std::size_t Dim> void fillRandom(PaddedGrid<T, Dim> &g)
+{
+    g.fill([](const typename PaddedGrid<T, Dim>::IndexType &) {
+        return T(std::rand() % 2001 - 1000) / T(1000);
+    });
+}
+
+// the reference: one scalar sum per point
+template <typename T, std::size_t Dim, typename... Points>
+void referenceStencil(const std::array<std::array<int, Dim>, sizeof...(Points)> &offsets,
+                      const Stencil<T, Points...> &stencil, const PaddedGrid<T, Dim> &in,
+                      PaddedGrid<T, Dim> &out)
+{
+    typename PaddedGrid<T, Dim>::IndexType i = {};
+    while (true) {
+        T sum = 0;
+        for (std::size_t p = 0; p < sizeof...(Points); ++p) {
+            auto j = i;
+            for (std::size_t a = 0; a < Dim; ++a) {
+                j[a] += offsets[p][a];
+            }
+            sum += stencil.coefficient(p) * in(j);
+        }
+        out(i) = sum;
+        std::size_t a = 0;
+        for (; a < Dim && ++i[a] == std::ptrdiff_t(in.size(a)); ++a) {
+            i[a] = 0;
+        }
+        if (a == Dim) {
+            return;
+        }
+    }
+}
+
+template <typename T, std::size_t Dim>
+void compareGrids(const PaddedGrid<T, Dim> &a, const PaddedGrid<T, Dim> &b, T tol)
+{
+    const std::ptrdiff_t h = a.halo();
+    typename PaddedGrid<T, Dim>::IndexType i;
+    for (auto &x : i) {
+        x = -h;
+    }
+    while (true) {
+        COMPARE_ABSOLUTE_ERROR(a(i), b(i), tol) << "i[0] = " << i[0];
+        std::size_t k = 0;
+        for (; k < Dim && ++i[k] == std::ptrdiff_t(a.size(k)) + h; ++k) {
+            i[k] = -h;
+        }
+        if (k == Dim) {
+            return;
+        }
+    }
+}
+
+TEST_TYPES(T, stencil1D, STENCIL_TYPES)
+{
+    // offsets shorter and longer than a vector
+    const Stencil<T, StencilPoint<-9>, StencilPoint<-2>, StencilPoint<-1>, StencilPoint<0>,
+                  StencilPoint<1>, StencilPoint<3>, StencilPoint<9>>
+        stencil(T(0.5), T(-1), T(2), T(-3), T(4), T(-5), T(0.25));
+    const std::array<std::array<int, 1>, 7> offsets = {
+        {{{-9}}, {{-2}}, {{-1}}, {{0}}, {{1}}, {{3}}, {{9}}}};
+    COMPARE(stencil.radius(0), 9u);
+    for (std::size_t n : {1, 2, 3, 7, 8, 9, 16, 17, 31, 100, 1000, 5000}) {
+        PaddedGrid<T, 1> in({{n}}, 9), out({{n}}, 9), ref({{n}}, 9);
+        fillRandom(in);
+        fillRandom(out);
+        ref = out;
+        simd_stencil(stencil, in, out);
+        referenceStencil(offsets, stencil, in, ref);
+        compareGrids(out, ref, 10 * tolerance<T>());
+    }
+}
+
+TEST_TYPES(T, stencil2D, STENCIL_TYPES)
+{
+    const Stencil<T, StencilPoint<0, 0>, StencilPoint<-1, 0>, StencilPoint<1, 0>,
+                  StencilPoint<0, -1>, StencilPoint<0, 1>, StencilPoint<2, -2>>
+        stencil(T(-4), T(1), T(1), T(1), T(1), T(0.5));
+    const std::array<std::array<int, 2>, 6> offsets = {
+        {{{0, 0}}, {{-1, 0}}, {{1, 0}}, {{0, -1}}, {{0, 1}}, {{2, -2}}}};
+    for (std::size_t nx : {1, 5, 8, 13, 33}) {
+        for (std::size_t ny : {1, 2, 7, 20}) {
+            PaddedGrid<T, 2> in({{nx, ny}}, 2), out({{nx, ny}}, 2), ref({{nx, ny}}, 2);
+            fillRandom(in);
+            fillRandom(out);
+            ref = out;
+            simd_stencil(stencil, in, out);
+            referenceStencil(offsets, stencil, in, ref);
+            compareGrids(out, ref, 10 * tolerance<T>());
+        }
+    }
+}
+
+TEST_TYPES(T, stencil3D, STENCIL_TYPES)
+{
+    const Stencil<T, StencilPoint<0, 0, 0>, StencilPoint<-1, 0, 0>, StencilPoint<1, 0, 0>,
+                  StencilPoint<0, -1, 0>, StencilPoint<0, 1, 0>, StencilPoint<0, 0, -1>,
+                  StencilPoint<0, 0, 1>, StencilPoint<1, 1, 1>>
+        stencil(T(-6), T(1), T(1), T(1), T(1), T(1), T(1), T(0.125));
+    const std::array<std::array<int, 3>, 8> offsets = {{{{0, 0, 0}},
+                                                        {{-1, 0, 0}},
+                                                        {{1, 0, 0}},
+                                                        {{0, -1, 0}},
+                                                        {{0, 1, 0}},
+                                                        {{0, 0, -1}},
+                                                        {{0, 0, 1}},
+                                                        {{1, 1, 1}}}};
+    for (std::size_t n : {1, 3, 9, 18}) {
+        PaddedGrid<T, 3> in({{n, n + 1, n + 2}}, 1), out({{n, n + 1, n + 2}}, 1),
+            ref({{n, n + 1, n + 2}}, 1);
+        fillRandom(in);
+        fillRandom(out);
+        ref = out;
+        simd_stencil(stencil, in, out);
+        referenceStencil(offsets, stencil, in, ref);
+        compareGrids(out, ref, 10 * tolerance<T>());
+    }
+}
+
+template <typename T, std::size_t Dim, typename S>
+void checkSteps(const S &stencil, const std::array<std::size_t, Dim> &size, std::size_t halo)
+{
+    for (std::size_t steps : {0, 1, 2, 5, 8}) {
+        PaddedGrid<T, Dim> a0(size, halo), b0(size, halo);
+        fillRandom(a0);
+        fillRandom(b0);
+        PaddedGrid<T, Dim> a1 = a0, b1 = b0;
+        const auto &spatial =
+            simd_stencil_steps(stencil, a0, b0, steps, StencilBlocking::Spatial);
+        const auto &temporal = simd_stencil_steps(stencil, a1, b1, steps);
+        COMPARE(&spatial == &a0, &temporal == &a1);
+        compareGrids(spatial, temporal, T(0));
+    }
+}
+
+TEST_TYPES(T, temporalBlocking, STENCIL_TYPES)
+{
+    // averaging keeps the values bounded over many steps
+    const Stencil<T, StencilPoint<-1>, StencilPoint<0>, StencilPoint<2>> s1(
+        T(0.25), T(0.5), T(0.25));
+    checkSteps<T, 1>(s1, {{100000}}, 2);
+    checkSteps<T, 1>(s1, {{13}}, 2);
+    const Stencil<T, StencilPoint<0, 0>, StencilPoint<-1, 0>, StencilPoint<1, 0>,
+                  StencilPoint<0, -1>, StencilPoint<0, 1>>
+        s2(T(0.2), T(0.2), T(0.2), T(0.2), T(0.2));
+    checkSteps<T, 2>(s2, {{300, 400}}, 1);
+    checkSteps<T, 2>(s2, {{5, 3}}, 1);
+    const Stencil<T, StencilPoint<0, 0, 0>, StencilPoint<0, 0, -2>, StencilPoint<0, 0, 1>,
+                  StencilPoint<1, -1, 0>>
+        s3(T(0.25), T(0.25), T(0.25), T(0.25));
+    checkSteps<T, 3>(s3, {{40, 30, 50}}, 2);
+}
+
+TEST_TYPES(T, stepsMatchRepeatedSweeps, STENCIL_TYPES)
+{
+    const Stencil<T, StencilPoint<0, 0>, StencilPoint<-1, 0>, StencilPoint<1, 0>,
+                  StencilPoint<0, -1>, StencilPoint<0, 1>>
+        s(T(0.2), T(0.2), T(0.2), T(0.2), T(0.2));
+    PaddedGrid<T, 2> a({{37, 23}}, 1), b({{37, 23}}, 1);
+    fillRandom(a);
+    PaddedGrid<T, 2> x = a, y = a;
+    for (int t = 0; t < 3; ++t) {
+        simd_stencil(s, x, y);
+        std::swap(x, y);
+    }
+    const auto &r = simd_stencil_steps(s, a, b, 3);
+    COMPARE(&r, &b);
+    compareGrids(r, x, T(0));
+}
@@ -87,6 +87,67 @@ TEST_TYPES(V, testCos, (REAL_VECTORS, SIMD_REAL_ARRAY_LIST)) //{{{1
     }
 }
 
+template <typename T> struct LargeArgumentReference;  //{{{1
+template <> struct LargeArgumentReference<float> {
+    static constexpr int size = 8;
+    static const float data[size][3];
+};
+const float LargeArgumentReference<float>::data[size][3] = {
+    // x, sin(x), cos(x)
+    {1e4f, -0.30561438888825215f, -0.9521553682590148f},
+    {123456.703125f, -0.9994159396364459f, -0.03417279035431404f},
+    {1e7f, 0.4205477931907825f, -0.9072703861817396f},
+    {16777216.f, -0.7795636732177778f, 0.6263229832915329f},
+    {3.4e9f, -0.07810920423289215f, -0.9969448090110627f},
+    {1e22f, -0.7340815352961015f, 0.679061337095051f},
+    {1.5e30f, -0.7971951447772657f, 0.6037217083587059f},
+    {3.e38f, 0.8749048877644344f, -0.4842947835419069f}};
+template <> struct LargeArgumentReference<double> {
+    static constexpr int size = 8;
+    static const double data[size][3];
+};
+const double LargeArgumentReference<double>::data[size][3] = {
+    // x, sin(x), cos(x)
+    {1e9, 0.5458434494486996, 0.8378871813639024},
+    {157908926675387., 0.05447538237148594, -0.9985151139143966},
+    {6e15, 0.09168912942995323, 0.9957876799520956},
+    {1e22, -0.8522008497671888, 0.523214785395139},
+    {3.14159265358979e50, -0.57193884269326, 0.8202962636869038},
+    {8.07186398e104, -0.4355525784104125, -0.9001632915421742},
+    {2.5e200, 0.9890604195968831, -0.14751097039487435},
+    {1.7e308, -0.5952560848632077, 0.803536056087918}};
+
+TEST_TYPES(V, testSincosLargeArguments, (REAL_VECTORS, SIMD_REAL_ARRAY_LIST)) //{{{1
+{
+    typedef typename V::EntryType T;
+    typedef LargeArgumentReference<T> R;
+    // arguments beyond the range of the Cody-Waite reduction must not lose precision
+    const T maxError = std::numeric_limits<T>::epsilon() * 2;
+    for (int i = 0; i < R::size; ++i) {
+        V x, sref, cref;
+        for (size_t j = 0; j < V::Size; ++j) {
+            const int k = (i + j) % R::size;
+            x[j] = R::data[k][0];
+            sref[j] = R::data[k][1];
+            cref[j] = R::data[k][2];
+        }
+        // mix large and small arguments in one vector
+        x[0] = T(0.5);
+        sref[0] = T(0.479425538604203);
+        cref[0] = T(0.8775825618903728);
+        V sin, cos;
+        Vc::sincos(x, &sin, &cos);
+        const V sinNeg = Vc::sin(-x);
+        const V cosNeg = Vc::cos(-x);
+        for (size_t j = 0; j < V::Size; ++j) {
+            COMPARE_ABSOLUTE_ERROR(T(sin[j]), T(sref[j]), maxError) << " x = " << x[j];
+            COMPARE_ABSOLUTE_ERROR(T(cos[j]), T(cref[j]), maxError) << " x = " << x[j];
+            COMPARE_ABSOLUTE_ERROR(T(sinNeg[j]), T(-sref[j]), maxError) << " x = " << -x[j];
+            COMPARE_ABSOLUTE_ERROR(T(cosNeg[j]), T(cref[j]), maxError) << " x = " << -x[j];
+        }
+    }
+}
+
 TEST_TYPES(V, testAsin, (REAL_VECTORS, SIMD_REAL_ARRAY_LIST)) //{{{1
 {
     typedef typename V::EntryType T;
@@ -278,6 +278,43 @@ TEST_TYPES(V, shiftedIn, (ALL_VECTORS, SIMD_ARRAYS(1), SIMD_ARRAYS(16), SIMD_ODD
     shiftedInConstant(V::Random(), std::integral_constant<int, Size>());
 }
 
+// permute{{{1
+TEST_TYPES(V, permute, (ALL_VECTORS, SIMD_ARRAYS(16), SIMD_ARRAYS(15), SIMD_ARRAYS(8),
+                        SIMD_ARRAYS(3)))
+{
+    using I = typename V::IndexType;
+    constexpr int Size = V::Size;
+    const V data = V::IndexesFromZero() + 1;
+    COMPARE(data.permute(I::IndexesFromZero()), data);
+    COMPARE(data.permute(Size - 1 - I::IndexesFromZero()), data.reversed());
+    COMPARE(data.permute(I::Zero()), V(data[0]));
+    for (int repetition = 0; repetition < 1000; ++repetition) {
+        const I idx = I::generate([](int) { return std::rand() % Size; });
+        const V test = data.permute(idx);
+        for (int i = 0; i < Size; ++i) {
+            COMPARE(test[i], data[idx[i]]) << "idx: " << idx << ", test: " << test;
+        }
+    }
+}
+
+TEST_TYPES(V, permute2, (ALL_VECTORS, SIMD_ARRAYS(16), SIMD_ARRAYS(3)))
+{
+    using I = typename V::IndexType;
+    constexpr int Size = V::Size;
+    const V a = V::IndexesFromZero() + 1;
+    const V b = a + Size;
+    COMPARE(permute2(a, b, I::IndexesFromZero()), a);
+    COMPARE(permute2(a, b, I::IndexesFromZero() + Size), b);
+    for (int repetition = 0; repetition < 1000; ++repetition) {
+        const I idx = I::generate([](int) { return std::rand() % (2 * Size); });
+        const V test = permute2(a, b, idx);
+        for (int i = 0; i < Size; ++i) {
+            COMPARE(test[i], idx[i] < Size ? a[idx[i]] : b[idx[i] - Size])
+                << "idx: " << idx << ", test: " << test;
+        }
+    }
+}
+
 // testMallocAlignment{{{1
 TEST(testMallocAlignment)
 {
@@ -62,6 +62,8 @@ template<typename T> struct is_subscript_operation_internal : public std::false_
 template<typename T> struct is_simdarray_internal : public std::false_type {};
 template<typename T> struct is_simd_mask_array_internal : public std::false_type {};
 template<typename T> struct is_loadstoreflag_internal : public std::false_type {};
+template<typename T> struct is_half_float_internal : public std::false_type {};
+template<typename T> struct is_bfloat16_internal : public std::false_type {};
 
 #include "is_gather_signature.h"
 
@@ -153,6 +155,23 @@ struct isSimdMaskArray : public is_simd_mask_array_internal<decay<T>>
 template <typename T> struct is_subscript_operation : public is_subscript_operation_internal<decay<T>> {};
 /// \internal Identifies LoadStoreFlag types
 template <typename T> struct is_load_store_flag : public is_loadstoreflag_internal<decay<T>> {};
+/// \internal Identifies the IEEE 754 binary16 storage type Vc::half
+template <typename T> struct is_half_float : public is_half_float_internal<decay<T>> {};
+/// \internal Identifies the storage type Vc::bfloat16
+template <typename T> struct is_bfloat16 : public is_bfloat16_internal<decay<T>> {};
+/**
+ * \internal Identifies the memory types \p U a vector with entry type \p T can be loaded
+ * from and stored to. These are all arithmetic types and, for float vectors, Vc::half
+ * and Vc::bfloat16.
+ */
+template <typename T, typename U>
+struct is_load_store_type
+    : public std::integral_constant<bool, (std::is_arithmetic<U>::value ||
+                                           (std::is_same<T, float>::value &&
+                                            (is_half_float_internal<U>::value ||
+                                             is_bfloat16_internal<U>::value)))>
+{
+};
 /// \internal Identifies the function signature of a cast
 template <typename... Args> struct is_cast_arguments : public is_cast_arguments_internal<sizeof...(Args), decay<Args>...> {};
 